@@ -0,0 +1,228 @@
+/**
+ * @file bench_aggregation.c
+ * @brief Fault Aggregation Path Benchmark (two-pass vs single-pass)
+ *
+ * Compares the cycles per aggregation of:
+ *  - two_pass: the former fault_aggregate() sequence - busy flag,
+ *    fsm_get_status() copy, DCLS verification, priority if-chain, then a
+ *    second verification and commit in fsm_aggregate_faults(), timestamp
+ *  - single_pass: fault_aggregate() on the fused fsm_aggregate() engine
+ *
+ * Each path is measured with no fault active (FSM in NORMAL) and with a
+ * fault latched (FSM in FAULT), both through the wrapper (lock and
+ * timestamp included) and at engine level (verification, aggregation and
+ * commit only). On the host the wrapper cases include a CLOCK_MONOTONIC
+ * read; the engine cases isolate the fused path. The worst-case
+ * aggregator lock hold seen over the run is reported alongside. Results
+ * are JSON on stdout.
+ *
+ * Usage: bench_aggregation [iterations]   (default 1000000 per case)
+ *
+ * Compliance:
+ *  - TSR-002 (< 5ms software response to fault)
+ *  - ASPICE CL3 D.6.1 (Metrics and measurement)
+ */
+
+#include <stdlib.h>
+#include "bench_common.h"
+#include "hal/timebase.h"
+#include "safety/safety_fsm.h"
+#include "safety/fault_aggregator.h"
+
+/* ============================================================================
+ * Configuration
+ * ============================================================================ */
+
+/** @brief Default timed aggregations per case */
+#define AGG_BENCH_DEFAULT_ITERATIONS 1000000UL
+
+/** @brief Untimed warm-up aggregations */
+#define AGG_BENCH_WARMUP 10000UL
+
+/* ============================================================================
+ * Reference: two-pass aggregation (pre-fusion fault_aggregate sequence)
+ * ============================================================================ */
+
+/** @brief Bookkeeping of the reference path (mirrors fault_aggregator.c) */
+static volatile bool g_ref_busy = false;
+static volatile uint32_t g_ref_attempts = 0;
+static volatile uint32_t g_ref_last_ticks = 0;
+
+static bool two_pass_engine(fault_type_t *aggregated_faults)
+{
+    safety_status_t status;
+    fault_type_t result;
+    uint32_t flags;
+
+    /* Pass 1: full status copy and verification */
+    if (!fsm_get_status(&status)) {
+        return false;
+    }
+
+    flags = status.fault_flags.word;
+    if (!VERIFY_FAULT_FLAGS(flags)) {
+        return false;
+    }
+    result = (fault_type_t)(flags & FAULT_FLAGS_MASK);
+
+    if (result & FAULT_TYPE_VDD) {
+        *aggregated_faults = FAULT_TYPE_VDD;
+    } else if (result & FAULT_TYPE_CLK) {
+        *aggregated_faults = FAULT_TYPE_CLK;
+    } else if (result & FAULT_TYPE_MEM_ECC) {
+        *aggregated_faults = FAULT_TYPE_MEM_ECC;
+    } else {
+        *aggregated_faults = FAULT_TYPE_NONE;
+    }
+
+    /* Pass 2: re-read, re-verify and commit */
+    return fsm_aggregate_faults();
+}
+
+static bool two_pass_aggregate(fault_type_t *aggregated_faults)
+{
+    bool ok;
+
+    if (g_ref_busy) {
+        return false;
+    }
+    g_ref_busy = true;
+    g_ref_attempts++;
+
+    ok = two_pass_engine(aggregated_faults);
+    if (ok) {
+        g_ref_last_ticks = timebase_ticks32();
+    }
+
+    g_ref_busy = false;
+    return ok;
+}
+
+/* ============================================================================
+ * Single-pass engine (fsm_aggregate without the wrapper bookkeeping)
+ * ============================================================================ */
+
+static bool single_pass_engine(fault_type_t *aggregated_faults)
+{
+    fsm_aggregation_t result;
+
+    if (!fsm_aggregate(&result)) {
+        return false;
+    }
+    *aggregated_faults = result.highest;
+    return true;
+}
+
+/* ============================================================================
+ * Benchmark
+ * ============================================================================ */
+
+/** @brief Benchmark cases, measured in order (pairs: two_pass, single_pass) */
+static const struct {
+    const char *name;
+    bool (*aggregate)(fault_type_t *);
+    bool fault_active;
+} g_cases[] = {
+    { "two_pass_no_fault",               two_pass_aggregate, false },
+    { "single_pass_no_fault",            fault_aggregate,    false },
+    { "two_pass_engine_no_fault",        two_pass_engine,    false },
+    { "single_pass_engine_no_fault",     single_pass_engine, false },
+    { "two_pass_fault_active",           two_pass_aggregate, true },
+    { "single_pass_fault_active",        fault_aggregate,    true },
+    { "two_pass_engine_fault_active",    two_pass_engine,    true },
+    { "single_pass_engine_fault_active", single_pass_engine, true },
+};
+
+#define AGG_BENCH_CASES (sizeof(g_cases) / sizeof(g_cases[0]))
+
+static bench_stats_t g_stats[AGG_BENCH_CASES];
+
+static void bench_path(bool (*aggregate)(fault_type_t *), bench_stats_t *stats,
+                       unsigned long iterations, uint32_t overhead)
+{
+    fault_type_t fault;
+    unsigned long i;
+
+    for (i = 0; i < AGG_BENCH_WARMUP; i++) {
+        (void)aggregate(&fault);
+    }
+
+    for (i = 0; i < iterations; i++) {
+        uint32_t t0 = hal_cycle_count();
+        (void)aggregate(&fault);
+        uint32_t t1 = hal_cycle_count();
+        uint32_t cycles = t1 - t0;
+
+        bench_stats_record(stats, (cycles > overhead) ? (cycles - overhead) : 0U);
+    }
+}
+
+/** @brief Mean reduction of single_pass vs two_pass in 1/100 percent */
+static int64_t reduction_x100(const bench_stats_t *two, const bench_stats_t *one)
+{
+    int64_t two_mean = (int64_t)(two->sum / (two->count ? two->count : 1U));
+    int64_t one_mean = (int64_t)(one->sum / (one->count ? one->count : 1U));
+
+    if (two_mean == 0) {
+        return 0;
+    }
+    return ((two_mean - one_mean) * 10000) / two_mean;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long iterations = AGG_BENCH_DEFAULT_ITERATIONS;
+    uint64_t hz;
+    uint32_t overhead;
+    size_t i;
+
+    if (argc > 1) {
+        iterations = strtoul(argv[1], NULL, 0);
+        if (iterations == 0UL) {
+            iterations = AGG_BENCH_DEFAULT_ITERATIONS;
+        }
+    }
+
+    timebase_init();
+    (void)fsm_init();
+    (void)fsm_transition(SAFETY_STATE_NORMAL);
+
+    hz = bench_cycle_hz();
+    overhead = bench_timer_overhead();
+
+    for (i = 0; i < AGG_BENCH_CASES; i++) {
+        if (g_cases[i].fault_active) {
+            /* Latch a fault: FSM moves to and stays in FAULT */
+            fsm_set_fault_flag(FAULT_TYPE_CLK);
+        }
+        bench_stats_init(&g_stats[i], g_cases[i].name);
+        bench_path(g_cases[i].aggregate, &g_stats[i], iterations, overhead);
+    }
+
+    printf("{\n");
+    printf("  \"benchmark\": \"bench_aggregation\",\n");
+    printf("  \"cycle_hz\": %llu,\n", (unsigned long long)hz);
+    printf("  \"timer_overhead_cycles\": %lu,\n", (unsigned long)overhead);
+    printf("  \"iterations\": %lu,\n", iterations);
+    printf("  \"max_lock_hold_us\": %lu,\n", (unsigned long)fault_get_max_lock_hold_us());
+    printf("  \"paths\": [\n");
+    for (i = 0; i < AGG_BENCH_CASES; i++) {
+        bench_stats_print_json(&g_stats[i], hz, 0U);
+        printf("%s\n", (i + 1U < AGG_BENCH_CASES) ? "," : "");
+    }
+    printf("  ],\n");
+    printf("  \"mean_reduction_percent\": {\n");
+    for (i = 0; i < AGG_BENCH_CASES; i += 2U) {
+        int64_t red = reduction_x100(&g_stats[i], &g_stats[i + 1U]);
+        int64_t mag = (red < 0) ? -red : red;
+        printf("    \"%s\": %s%lld.%02lld%s\n",
+               g_cases[i + 1U].name + (sizeof("single_pass_") - 1U),
+               (red < 0) ? "-" : "",
+               (long long)(mag / 100), (long long)(mag % 100),
+               (i + 2U < AGG_BENCH_CASES) ? "," : "");
+    }
+    printf("  }\n");
+    printf("}\n");
+
+    return 0;
+}
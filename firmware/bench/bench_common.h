@@ -0,0 +1,202 @@
+/**
+ * @file bench_common.h
+ * @brief Cycle-counter statistics helpers for firmware benchmarks
+ *
+ * Collects per-invocation cycle counts into a fixed-size histogram so the
+ * same code runs on the Cortex-M4 target (DWT_CYCCNT, no large buffers)
+ * and on the host build (rdtsc). Reports min/mean/p99/max as JSON.
+ *
+ * Compliance:
+ *  - TSR-002 (ISR framework with < 5μs latency)
+ *  - ASPICE CL3 D.6.1 (Metrics and measurement)
+ */
+
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "hal/hal_cpu.h"
+
+#if defined(FIRMWARE_HOST_BUILD)
+#include <time.h>
+#endif
+
+/* ============================================================================
+ * Configuration
+ * ============================================================================ */
+
+/** @brief Target core clock (ARM Cortex-M4 SSD controller) */
+#define BENCH_TARGET_CPU_HZ 400000000ULL
+
+/** @brief Histogram bins (bin width = 1 << BENCH_HIST_SHIFT cycles) */
+#define BENCH_HIST_BINS  4096U
+#define BENCH_HIST_SHIFT 2U
+
+/* ============================================================================
+ * Cycle Statistics
+ * ============================================================================ */
+
+/**
+ * @struct bench_stats_t
+ * @brief Running cycle statistics for one benchmarked code path
+ */
+typedef struct {
+    const char *name;                   /*!< Code path name (JSON key) */
+    uint64_t count;                     /*!< Number of samples */
+    uint64_t sum;                       /*!< Sum of cycles (for mean) */
+    uint32_t min;                       /*!< Minimum cycles */
+    uint32_t max;                       /*!< Maximum cycles */
+    uint32_t hist[BENCH_HIST_BINS];     /*!< Cycle histogram (last = overflow) */
+} bench_stats_t;
+
+/**
+ * @brief Reset statistics before a run
+ */
+static inline void bench_stats_init(bench_stats_t *stats, const char *name)
+{
+    memset(stats, 0, sizeof(*stats));
+    stats->name = name;
+    stats->min = UINT32_MAX;
+}
+
+/**
+ * @brief Record one sample (cycles already corrected for timer overhead)
+ */
+static inline void bench_stats_record(bench_stats_t *stats, uint32_t cycles)
+{
+    uint32_t bin = cycles >> BENCH_HIST_SHIFT;
+
+    if (bin >= BENCH_HIST_BINS) {
+        bin = BENCH_HIST_BINS - 1U;
+    }
+
+    stats->hist[bin]++;
+    stats->count++;
+    stats->sum += cycles;
+    if (cycles < stats->min) {
+        stats->min = cycles;
+    }
+    if (cycles > stats->max) {
+        stats->max = cycles;
+    }
+}
+
+/**
+ * @brief Percentile from the histogram (upper edge of the bin)
+ *
+ * @param permille Percentile in 1/1000 (990 = p99, 999 = p99.9)
+ */
+static inline uint32_t bench_stats_percentile(const bench_stats_t *stats,
+                                              uint32_t permille)
+{
+    uint64_t target = (stats->count * permille + 999U) / 1000U;
+    uint64_t seen = 0;
+    uint32_t bin;
+
+    for (bin = 0; bin < BENCH_HIST_BINS; bin++) {
+        seen += stats->hist[bin];
+        if (seen >= target) {
+            break;
+        }
+    }
+
+    if (bin >= BENCH_HIST_BINS - 1U) {
+        return stats->max;  /* Overflow bin: best bound is the max */
+    }
+
+    uint32_t edge = ((bin + 1U) << BENCH_HIST_SHIFT) - 1U;
+    return (edge < stats->max) ? edge : stats->max;
+}
+
+/* ============================================================================
+ * Timer Calibration
+ * ============================================================================ */
+
+/**
+ * @brief Cycle counter frequency in Hz
+ *
+ * Target: core clock. Host: TSC calibrated against CLOCK_MONOTONIC.
+ */
+static inline uint64_t bench_cycle_hz(void)
+{
+#if defined(FIRMWARE_HOST_BUILD) && (defined(__x86_64__) || defined(__i386__))
+    struct timespec t0, t1;
+    uint64_t c0, c1, ns;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &t0);
+    c0 = __rdtsc();
+    do {
+        (void)clock_gettime(CLOCK_MONOTONIC, &t1);
+        ns = (uint64_t)(t1.tv_sec - t0.tv_sec) * 1000000000ULL +
+             (uint64_t)t1.tv_nsec - (uint64_t)t0.tv_nsec;
+    } while (ns < 50000000ULL);  /* 50ms window */
+    c1 = __rdtsc();
+
+    return (c1 - c0) * 1000000000ULL / ns;
+#elif defined(FIRMWARE_HOST_BUILD)
+    return 1000000000ULL;  /* CLOCK_MONOTONIC fallback counts ns */
+#else
+    return BENCH_TARGET_CPU_HZ;
+#endif
+}
+
+/**
+ * @brief Fixed cost of a back-to-back hal_cycle_count() pair
+ *
+ * Subtracted from every sample so results reflect the code under test.
+ */
+static inline uint32_t bench_timer_overhead(void)
+{
+    uint32_t best = UINT32_MAX;
+
+    for (uint32_t i = 0; i < 10000U; i++) {
+        uint32_t t0 = hal_cycle_count();
+        uint32_t t1 = hal_cycle_count();
+        if ((t1 - t0) < best) {
+            best = t1 - t0;
+        }
+    }
+
+    return best;
+}
+
+/** @brief Convert cycles to nanoseconds */
+static inline uint64_t bench_cycles_to_ns(uint64_t cycles, uint64_t hz)
+{
+    return (cycles * 1000000000ULL) / hz;
+}
+
+/* ============================================================================
+ * JSON Report
+ * ============================================================================ */
+
+/**
+ * @brief Print one stats object as a JSON object (no trailing newline)
+ *
+ * @param budget_ns Latency budget; within_budget compares p99 against it
+ */
+static inline void bench_stats_print_json(const bench_stats_t *stats,
+                                          uint64_t hz, uint64_t budget_ns)
+{
+    uint32_t p99 = bench_stats_percentile(stats, 990U);
+    uint64_t mean_x100 = stats->count ? (stats->sum * 100U) / stats->count : 0;
+
+    printf("    {\"name\": \"%s\", \"samples\": %llu, "
+           "\"min_cycles\": %lu, \"mean_cycles\": %llu.%02llu, "
+           "\"p99_cycles\": %lu, \"max_cycles\": %lu, "
+           "\"p99_ns\": %llu, \"max_ns\": %llu, \"within_budget\": %s}",
+           stats->name, (unsigned long long)stats->count,
+           (unsigned long)stats->min,
+           (unsigned long long)(mean_x100 / 100U),
+           (unsigned long long)(mean_x100 % 100U),
+           (unsigned long)p99, (unsigned long)stats->max,
+           (unsigned long long)bench_cycles_to_ns(p99, hz),
+           (unsigned long long)bench_cycles_to_ns(stats->max, hz),
+           (budget_ns == 0U || bench_cycles_to_ns(p99, hz) <= budget_ns)
+               ? "true" : "false");
+}
+
+#endif /* BENCH_COMMON_H */
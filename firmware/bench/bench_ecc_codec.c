@@ -0,0 +1,152 @@
+/**
+ * @file bench_ecc_codec.c
+ * @brief Software SEC/DED Codec Throughput Benchmark
+ *
+ * Measures ecc_encode64_batch() and ecc_decode64_batch() throughput for
+ * every implementation available on this build and CPU (TABLE, WORD,
+ * AVX2, AVX512) over a buffer of random words with sparse injected
+ * single-bit errors. Throughput is data bytes per second, best of the
+ * repetitions (wall clock, timebase nanoseconds). Results are JSON on
+ * stdout; "meets_target" compares the fastest path with 1 GB/s.
+ *
+ * Usage: bench_ecc_codec [repetitions]   (default 50 over a 1 MiB buffer)
+ *
+ * Compliance:
+ *  - ASPICE CL3 D.6.1 (Metrics and measurement)
+ */
+
+#include <stdlib.h>
+#include "bench_common.h"
+#include "hal/timebase.h"
+#include "memory/ecc_codec.h"
+
+/* ============================================================================
+ * Configuration
+ * ============================================================================ */
+
+/** @brief Default repetitions per path and direction */
+#define ECC_BENCH_DEFAULT_REPETITIONS 50UL
+
+/** @brief Words per buffer (1 MiB of data) */
+#define ECC_BENCH_WORDS (1024U * 1024U / 8U)
+
+/** @brief One injected single-bit error every N words */
+#define ECC_BENCH_ERROR_INTERVAL 1024U
+
+/** @brief Throughput target (bytes per second) */
+#define ECC_BENCH_TARGET_BPS 1000000000ULL
+
+static const struct {
+    const char *name;
+    ecc_codec_path_t path;
+} g_paths[] = {
+    { "table",  ECC_CODEC_PATH_TABLE },
+    { "word",   ECC_CODEC_PATH_WORD },
+    { "avx2",   ECC_CODEC_PATH_AVX2 },
+    { "avx512", ECC_CODEC_PATH_AVX512 },
+};
+
+#define ECC_BENCH_PATHS (sizeof(g_paths) / sizeof(g_paths[0]))
+
+static uint64_t g_data[ECC_BENCH_WORDS];
+static uint64_t g_out[ECC_BENCH_WORDS];
+static uint8_t g_ecc[ECC_BENCH_WORDS];
+
+/** @brief Bytes per second for one buffer pass of @p ns nanoseconds */
+static uint64_t bench_bps(uint64_t ns)
+{
+    return (ns == 0U) ? 0U : ((uint64_t)sizeof(g_data) * 1000000000ULL) / ns;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long repetitions = ECC_BENCH_DEFAULT_REPETITIONS;
+    uint64_t rng = 0x9E3779B97F4A7C15ULL;
+    uint64_t best_bps = 0;
+    ecc_batch_stats_t stats = { 0U, 0U, 0U };
+    bool first = true;
+    size_t p, i;
+
+    if (argc > 1) {
+        repetitions = strtoul(argv[1], NULL, 0);
+        if (repetitions == 0UL) {
+            repetitions = ECC_BENCH_DEFAULT_REPETITIONS;
+        }
+    }
+
+    timebase_init();
+
+    for (i = 0; i < ECC_BENCH_WORDS; i++) {
+        rng ^= rng << 13;
+        rng ^= rng >> 7;
+        rng ^= rng << 17;
+        g_data[i] = rng;
+    }
+
+    printf("{\n");
+    printf("  \"benchmark\": \"bench_ecc_codec\",\n");
+    printf("  \"buffer_bytes\": %lu,\n", (unsigned long)sizeof(g_data));
+    printf("  \"repetitions\": %lu,\n", repetitions);
+    printf("  \"paths\": [\n");
+
+    for (p = 0; p < ECC_BENCH_PATHS; p++) {
+        uint64_t enc_ns = UINT64_MAX;
+        uint64_t dec_ns = UINT64_MAX;
+        unsigned long r;
+
+        if (!ecc_codec_select_path(g_paths[p].path)) {
+            continue;
+        }
+
+        for (r = 0; r < repetitions; r++) {
+            uint64_t t0 = timebase_ticks64();
+            ecc_encode64_batch(g_data, g_ecc, ECC_BENCH_WORDS);
+            uint64_t t1 = timebase_ticks64();
+
+            if (t1 - t0 < enc_ns) {
+                enc_ns = t1 - t0;
+            }
+        }
+
+        /* Sparse single-bit errors for the decode pass */
+        for (i = 0; i < ECC_BENCH_WORDS; i += ECC_BENCH_ERROR_INTERVAL) {
+            g_data[i] ^= 1ULL << (i % 64U);
+        }
+
+        for (r = 0; r < repetitions; r++) {
+            uint64_t t0 = timebase_ticks64();
+            ecc_decode64_batch(g_data, g_ecc, g_out, ECC_BENCH_WORDS, &stats);
+            uint64_t t1 = timebase_ticks64();
+
+            if (t1 - t0 < dec_ns) {
+                dec_ns = t1 - t0;
+            }
+        }
+
+        for (i = 0; i < ECC_BENCH_WORDS; i += ECC_BENCH_ERROR_INTERVAL) {
+            g_data[i] ^= 1ULL << (i % 64U);
+        }
+
+        if (bench_bps(enc_ns) > best_bps) {
+            best_bps = bench_bps(enc_ns);
+        }
+        if (bench_bps(dec_ns) > best_bps) {
+            best_bps = bench_bps(dec_ns);
+        }
+
+        printf("%s    {\"name\": \"%s\", \"encode_mb_s\": %llu, \"decode_mb_s\": %llu, "
+               "\"sbe_count\": %lu, \"mbe_count\": %lu}",
+               first ? "" : ",\n", g_paths[p].name,
+               (unsigned long long)(bench_bps(enc_ns) / 1000000ULL),
+               (unsigned long long)(bench_bps(dec_ns) / 1000000ULL),
+               (unsigned long)stats.sbe_count, (unsigned long)stats.mbe_count);
+        first = false;
+    }
+
+    printf("\n  ],\n");
+    printf("  \"target_mb_s\": %llu,\n", (unsigned long long)(ECC_BENCH_TARGET_BPS / 1000000ULL));
+    printf("  \"meets_target\": %s\n", (best_bps >= ECC_BENCH_TARGET_BPS) ? "true" : "false");
+    printf("}\n");
+
+    return 0;
+}
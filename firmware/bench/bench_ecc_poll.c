@@ -0,0 +1,246 @@
+/**
+ * @file bench_ecc_poll.c
+ * @brief ECC SBE Handling CPU Load: Interrupt vs Polling Mode
+ *
+ * Times the real handler paths with the cycle counter and projects the
+ * CPU load of each SBE handling mode over a range of SBE rates:
+ *  - irq:           one ecc_fault_isr() per SBE (no coalescing)
+ *  - irq_coalesced: default IRQ_COAL (8 SBEs or 10μs per interrupt)
+ *  - poll:          ecc_fault_poll_task() every 1ms, SBE interrupts masked
+ *  - hybrid:        what ecc_handler selects (poll at or above
+ *                   ECC_POLL_ENTER_SBE_PER_MS, coalesced interrupts below)
+ *
+ * Measured costs (mean cycles): ISR with an empty error FIFO, ISR with a
+ * full burst (per-entry cost = difference / burst), poll task with an
+ * empty FIFO. A poll drains at most one FIFO (8 addresses); counts beyond
+ * that come from the counters only. Results are JSON on stdout.
+ *
+ * Usage: bench_ecc_poll [iterations]   (default 200000 per path)
+ *
+ * Exit code is non-zero if polling is not cheaper than one interrupt per
+ * SBE at the highest rate. Hardware exception entry/exit (12 cycles
+ * stacking on Cortex-M4) is not included, which favours interrupt mode.
+ *
+ * Compliance:
+ *  - ASPICE CL3 D.6.1 (Metrics and measurement)
+ */
+
+#include <stdlib.h>
+#include "bench_common.h"
+#include "hal/reg_access.h"
+#include "hal/timebase.h"
+#include "memory/ecc_handler.h"
+#include "memory/ecc_service.h"
+#include "safety/fault_event_queue.h"
+
+/* ============================================================================
+ * Configuration
+ * ============================================================================ */
+
+/** @brief Default timed invocations per path */
+#define POLL_BENCH_DEFAULT_ITERATIONS 200000UL
+
+/** @brief Timed invocations between untimed fault event queue drains */
+#define POLL_BENCH_DRAIN_INTERVAL 32UL
+
+/** @brief Poll task period */
+#define POLL_BENCH_POLLS_PER_S 1000ULL
+
+/** @brief Error FIFO depth of ecc_controller.v (addresses per poll) */
+#define POLL_BENCH_FIFO_DEPTH 8ULL
+
+/** @brief Default coalescing timeout in seconds: 4000 cycles @ 400MHz */
+#define POLL_BENCH_COAL_TIMEOUT_NS 10000ULL
+
+/** @brief Projected SBE rates (per second) */
+static const uint64_t g_rates[] = { 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U };
+
+#define POLL_BENCH_RATES (sizeof(g_rates) / sizeof(g_rates[0]))
+
+#define FIFO_POP_ADDR (ECC_BASE_ADDR + ECC_FIFO_POP_OFFSET)
+
+static bench_stats_t g_isr_empty;
+static bench_stats_t g_isr_full;
+static bench_stats_t g_poll_empty;
+
+/** @brief Scratch buffer for untimed queue drains */
+static fault_event_t g_drain_buf[FAULT_EVENT_QUEUE_DEPTH];
+
+/* ============================================================================
+ * Measurement
+ * ============================================================================ */
+
+/**
+ * @brief Time ecc_fault_isr() or ecc_fault_poll_task()
+ */
+static void bench_path(bool poll, bench_stats_t *stats,
+                       unsigned long iterations, uint32_t overhead)
+{
+    for (unsigned long i = 0; i < iterations; i++) {
+        if ((i % POLL_BENCH_DRAIN_INTERVAL) == 0UL) {
+            while (fault_event_drain(g_drain_buf, FAULT_EVENT_QUEUE_DEPTH) != 0U) {
+            }
+        }
+
+        uint32_t t0 = hal_cycle_count();
+        if (poll) {
+            (void)ecc_fault_poll_task();
+        } else {
+            ecc_fault_isr();
+        }
+        uint32_t t1 = hal_cycle_count();
+        uint32_t cycles = t1 - t0;
+
+        bench_stats_record(stats, (cycles > overhead) ? (cycles - overhead) : 0U);
+    }
+}
+
+/** @brief Mean cycles of a path */
+static uint64_t bench_mean(const bench_stats_t *stats)
+{
+    return stats->count ? stats->sum / stats->count : 0U;
+}
+
+/* ============================================================================
+ * Load Model
+ * ============================================================================ */
+
+/** @brief Cycles per second spent by interrupts of k SBEs each */
+static uint64_t irq_cycles_per_s(uint64_t rate, uint64_t k,
+                                 uint64_t isr_base, uint64_t per_entry)
+{
+    return (rate * (isr_base + k * per_entry)) / k;
+}
+
+/** @brief SBEs per coalesced interrupt: those arriving within the timeout */
+static uint64_t coalesced_burst(uint64_t rate)
+{
+    uint64_t k = 1U + (rate * POLL_BENCH_COAL_TIMEOUT_NS) / 1000000000ULL;
+
+    return (k > ECC_IRQ_COAL_DEFAULT_COUNT) ? ECC_IRQ_COAL_DEFAULT_COUNT : k;
+}
+
+/** @brief Cycles per second spent by the 1ms poll task */
+static uint64_t poll_cycles_per_s(uint64_t rate, uint64_t poll_base,
+                                  uint64_t per_entry)
+{
+    uint64_t per_poll = rate / POLL_BENCH_POLLS_PER_S;
+
+    if (per_poll > POLL_BENCH_FIFO_DEPTH) {
+        per_poll = POLL_BENCH_FIFO_DEPTH;
+    }
+
+    return POLL_BENCH_POLLS_PER_S * (poll_base + per_poll * per_entry);
+}
+
+/** @brief CPU load in ppm */
+static uint64_t load_ppm(uint64_t cycles_per_s, uint64_t hz)
+{
+    return (cycles_per_s * 1000000ULL) / hz;
+}
+
+/** @brief Print a ppm load as a percentage with 4 decimals */
+static void print_pct(const char *key, uint64_t ppm, const char *sep)
+{
+    printf("\"%s\": %llu.%04llu%s", key,
+           (unsigned long long)(ppm / 10000U),
+           (unsigned long long)(ppm % 10000U), sep);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long iterations = POLL_BENCH_DEFAULT_ITERATIONS;
+    uint64_t hz, isr_base, per_entry, poll_base;
+    bool poll_wins = true;
+    uint32_t overhead;
+    size_t r;
+
+    if (argc > 1) {
+        iterations = strtoul(argv[1], NULL, 0);
+        if (iterations == 0UL) {
+            iterations = POLL_BENCH_DEFAULT_ITERATIONS;
+        }
+    }
+
+    hal_sim_reg_reset();
+    timebase_init();
+    fault_event_queue_init();
+    (void)ecc_init();
+    (void)ecc_handler_init();
+
+    hz = bench_cycle_hz();
+    overhead = bench_timer_overhead();
+
+    /* Interrupt mode only while timing the ISR */
+    (void)ecc_fault_set_poll_thresholds(0U, 0U);
+
+    bench_stats_init(&g_isr_empty, "ecc_fault_isr_fifo_empty");
+    hal_sim_reg_poke(FIFO_POP_ADDR, 0U);
+    bench_path(false, &g_isr_empty, iterations, overhead);
+
+    /* The simulated FIFO_POP has no pop side effect: every drain is a full
+     * burst of ECC_FIFO_DRAIN_PER_IRQ entries */
+    bench_stats_init(&g_isr_full, "ecc_fault_isr_fifo_burst");
+    hal_sim_reg_poke(FIFO_POP_ADDR, 0x80000100U | 21U);
+    bench_path(false, &g_isr_full, iterations, overhead);
+
+    /* Enter polling with one burst, then time empty polls (exit rate 0:
+     * stays in polling mode) */
+    (void)ecc_fault_set_poll_thresholds(1U, 0U);
+    ecc_fault_isr();
+    hal_sim_reg_poke(FIFO_POP_ADDR, 0U);
+    bench_stats_init(&g_poll_empty, "ecc_fault_poll_task_fifo_empty");
+    bench_path(true, &g_poll_empty, iterations, overhead);
+
+    isr_base = bench_mean(&g_isr_empty);
+    poll_base = bench_mean(&g_poll_empty);
+    per_entry = (bench_mean(&g_isr_full) > isr_base) ?
+                (bench_mean(&g_isr_full) - isr_base) / ECC_FIFO_DRAIN_PER_IRQ : 0U;
+
+    printf("{\n");
+    printf("  \"benchmark\": \"bench_ecc_poll\",\n");
+#if defined(FIRMWARE_HOST_BUILD)
+    printf("  \"platform\": \"host\",\n");
+#else
+    printf("  \"platform\": \"cortex-m4\",\n");
+#endif
+    printf("  \"cycle_hz\": %llu,\n", (unsigned long long)hz);
+    printf("  \"iterations\": %lu,\n", iterations);
+    printf("  \"paths\": [\n");
+    bench_stats_print_json(&g_isr_empty, hz, 0U);
+    printf(",\n");
+    bench_stats_print_json(&g_isr_full, hz, 0U);
+    printf(",\n");
+    bench_stats_print_json(&g_poll_empty, hz, 0U);
+    printf("\n  ],\n");
+    printf("  \"per_entry_cycles\": %llu,\n", (unsigned long long)per_entry);
+    printf("  \"enter_sbe_per_s\": %llu,\n",
+           (unsigned long long)ECC_POLL_ENTER_SBE_PER_MS * 1000ULL);
+    printf("  \"load_pct\": [\n");
+
+    for (r = 0; r < POLL_BENCH_RATES; r++) {
+        uint64_t rate = g_rates[r];
+        uint64_t irq = load_ppm(irq_cycles_per_s(rate, 1U, isr_base, per_entry), hz);
+        uint64_t coal = load_ppm(irq_cycles_per_s(rate, coalesced_burst(rate),
+                                                  isr_base, per_entry), hz);
+        uint64_t poll = load_ppm(poll_cycles_per_s(rate, poll_base, per_entry), hz);
+        uint64_t hybrid = (rate >= ECC_POLL_ENTER_SBE_PER_MS * 1000ULL) ? poll : coal;
+
+        printf("    {\"sbe_per_s\": %llu, ", (unsigned long long)rate);
+        print_pct("irq", irq, ", ");
+        print_pct("irq_coalesced", coal, ", ");
+        print_pct("poll", poll, ", ");
+        print_pct("hybrid", hybrid, "}");
+        printf("%s\n", (r + 1U < POLL_BENCH_RATES) ? "," : "");
+
+        if (r + 1U == POLL_BENCH_RATES && poll >= irq) {
+            poll_wins = false;
+        }
+    }
+
+    printf("  ],\n");
+    printf("  \"poll_beats_irq_at_max_rate\": %s\n", poll_wins ? "true" : "false");
+    printf("}\n");
+
+    return poll_wins ? 0 : 1;
+}
@@ -0,0 +1,161 @@
+/**
+ * @file bench_isr.c
+ * @brief ISR Latency Benchmark against the 5μs TSR-002 budget
+ *
+ * Times every fault ISR with the cycle counter (DWT_CYCCNT on target,
+ * rdtsc on the host build) over millions of invocations and reports
+ * min/mean/p99/max per handler as JSON on stdout.
+ *
+ * Usage: bench_isr [iterations]   (default 2000000 per handler)
+ *
+ * Exit code is non-zero if any handler's p99 exceeds the budget, so the
+ * benchmark can gate CI. Max is reported but not gated: on a non-RT host
+ * it includes OS preemption.
+ *
+ * Note: this measures the handler body only. Hardware exception entry/exit
+ * (12 cycles stacking + tail-chaining on Cortex-M4) is not included.
+ *
+ * Compliance:
+ *  - TSR-002 (ISR framework with < 5μs latency)
+ *  - ASPICE CL3 D.6.1 (Metrics and measurement)
+ */
+
+#include <stdlib.h>
+#include "bench_common.h"
+#include "safety/safety_fsm.h"
+#include "hal/interrupt_handler.h"
+#include "power/pwr_event_handler.h"
+#include "clock/clk_event_handler.h"
+#include "memory/ecc_handler.h"
+#include "safety/fault_event_queue.h"
+
+/* ============================================================================
+ * Configuration
+ * ============================================================================ */
+
+/** @brief TSR-002 ISR execution budget */
+#define ISR_BUDGET_NS 5000U
+
+/** @brief Default timed invocations per handler */
+#define ISR_BENCH_DEFAULT_ITERATIONS 2000000UL
+
+/** @brief Untimed warm-up invocations (caches, branch predictors) */
+#define ISR_BENCH_WARMUP 10000UL
+
+/** @brief Timed invocations between untimed fault event queue drains */
+#define ISR_BENCH_DRAIN_INTERVAL 32UL
+
+/** @brief Handlers under test */
+static const struct {
+    const char *name;
+    void (*isr)(void);
+} g_isr_table[] = {
+    { "vdd_isr_handler",                vdd_isr_handler },
+    { "clk_isr_handler",                clk_isr_handler },
+    { "mem_isr_handler",                mem_isr_handler },
+    { "clk_event_handler_clk_loss_isr", clk_event_handler_clk_loss_isr },
+    { "ecc_fault_isr",                  ecc_fault_isr },
+    { "pwr_event_handler_vdd_fault",    pwr_event_handler_vdd_fault },
+};
+
+#define ISR_COUNT (sizeof(g_isr_table) / sizeof(g_isr_table[0]))
+
+/** @brief Per-handler statistics (static: histograms are 16KB each) */
+static bench_stats_t g_stats[ISR_COUNT];
+
+/** @brief Scratch buffer for untimed queue drains */
+static fault_event_t g_drain_buf[FAULT_EVENT_QUEUE_DEPTH];
+
+/* ============================================================================
+ * Benchmark
+ * ============================================================================ */
+
+/**
+ * @brief Time one handler for the given number of invocations
+ */
+static void bench_one_isr(void (*isr)(void), bench_stats_t *stats,
+                          unsigned long iterations, uint32_t overhead)
+{
+    unsigned long i;
+
+    for (i = 0; i < ISR_BENCH_WARMUP; i++) {
+        isr();
+    }
+
+    for (i = 0; i < iterations; i++) {
+        /* Stand in for the safety task so posts take the enqueue path,
+         * not the ring-full path */
+        if ((i % ISR_BENCH_DRAIN_INTERVAL) == 0UL) {
+            while (fault_event_drain(g_drain_buf, FAULT_EVENT_QUEUE_DEPTH) != 0U) {
+            }
+        }
+
+        uint32_t t0 = hal_cycle_count();
+        isr();
+        uint32_t t1 = hal_cycle_count();
+        uint32_t cycles = t1 - t0;
+
+        bench_stats_record(stats, (cycles > overhead) ? (cycles - overhead) : 0U);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long iterations = ISR_BENCH_DEFAULT_ITERATIONS;
+    bool within_budget = true;
+    uint64_t hz;
+    uint32_t overhead;
+    size_t i;
+
+    if (argc > 1) {
+        iterations = strtoul(argv[1], NULL, 0);
+        if (iterations == 0UL) {
+            iterations = ISR_BENCH_DEFAULT_ITERATIONS;
+        }
+    }
+
+    /* Bring the safety stack up as at boot */
+    hal_cycle_counter_init();
+    (void)fsm_init();
+    (void)fsm_transition(SAFETY_STATE_NORMAL);
+    (void)interrupt_handler_init();
+    (void)clk_event_handler_init();
+    (void)ecc_handler_init();
+    pwr_event_handler_init();
+
+    hz = bench_cycle_hz();
+    overhead = bench_timer_overhead();
+
+    for (i = 0; i < ISR_COUNT; i++) {
+        bench_stats_init(&g_stats[i], g_isr_table[i].name);
+        bench_one_isr(g_isr_table[i].isr, &g_stats[i], iterations, overhead);
+        if (bench_cycles_to_ns(bench_stats_percentile(&g_stats[i], 990U), hz) >
+            ISR_BUDGET_NS) {
+            within_budget = false;
+        }
+    }
+
+    printf("{\n");
+    printf("  \"benchmark\": \"bench_isr\",\n");
+#if defined(FIRMWARE_HOST_BUILD)
+    printf("  \"platform\": \"host\",\n");
+    printf("  \"cycle_counter\": \"rdtsc\",\n");
+#else
+    printf("  \"platform\": \"cortex-m4\",\n");
+    printf("  \"cycle_counter\": \"DWT_CYCCNT\",\n");
+#endif
+    printf("  \"cycle_hz\": %llu,\n", (unsigned long long)hz);
+    printf("  \"timer_overhead_cycles\": %lu,\n", (unsigned long)overhead);
+    printf("  \"iterations\": %lu,\n", iterations);
+    printf("  \"budget_ns\": %u,\n", ISR_BUDGET_NS);
+    printf("  \"handlers\": [\n");
+    for (i = 0; i < ISR_COUNT; i++) {
+        bench_stats_print_json(&g_stats[i], hz, ISR_BUDGET_NS);
+        printf("%s\n", (i + 1U < ISR_COUNT) ? "," : "");
+    }
+    printf("  ],\n");
+    printf("  \"within_budget\": %s\n", within_budget ? "true" : "false");
+    printf("}\n");
+
+    return within_budget ? 0 : 1;
+}
@@ -0,0 +1,220 @@
+/**
+ * @file bench_priority.c
+ * @brief Fault Priority Resolver Benchmark (if-chain vs lookup table)
+ *
+ * Compares the cycles to resolve the highest-priority fault of an active
+ * mask with:
+ *  - if_chain: the former hard-coded VDD > CLK > MEM branch sequence of
+ *    fault_get_highest_priority() (ignores the configured priorities)
+ *  - runtime_chain: the same chain extended to honor the configured
+ *    levels, i.e. what the table replaces
+ *  - lut: fault_priority_resolve(), one packed-table load and shift
+ *
+ * Each resolver runs over a random mask sequence (unpredictable branches)
+ * and over a constant mask (perfectly predicted). Samples are blocks of
+ * PRIO_BENCH_BLOCK resolves, so the timer cost is amortized; cycles are
+ * reported per block. Results are JSON on stdout.
+ *
+ * Usage: bench_priority [iterations]   (default 200000 blocks per case)
+ *
+ * Compliance:
+ *  - SysReq-002 (Fault priority and aggregation)
+ *  - ASPICE CL3 D.6.1 (Metrics and measurement)
+ */
+
+#include <stdlib.h>
+#include "bench_common.h"
+#include "safety/fault_priority.h"
+
+/* ============================================================================
+ * Configuration
+ * ============================================================================ */
+
+/** @brief Default timed blocks per case */
+#define PRIO_BENCH_DEFAULT_ITERATIONS 200000UL
+
+/** @brief Untimed warm-up blocks */
+#define PRIO_BENCH_WARMUP 1000UL
+
+/** @brief Resolves per timed block (power of two) */
+#define PRIO_BENCH_BLOCK 64U
+
+/** @brief Mask sequence length (power of two) */
+#define PRIO_BENCH_MASKS 4096U
+
+/* ============================================================================
+ * Reference: hard-coded if-chain (pre-LUT fault_get_highest_priority)
+ * ============================================================================ */
+
+static inline fault_type_t if_chain_resolve(uint32_t active, uint8_t *level)
+{
+    if ((active & FAULT_TYPE_VDD) != 0U) {
+        *level = 1U;
+        return FAULT_TYPE_VDD;
+    } else if ((active & FAULT_TYPE_CLK) != 0U) {
+        *level = 2U;
+        return FAULT_TYPE_CLK;
+    } else if ((active & FAULT_TYPE_MEM_ECC) != 0U) {
+        *level = 3U;
+        return FAULT_TYPE_MEM_ECC;
+    }
+    *level = 0U;
+    return FAULT_TYPE_NONE;
+}
+
+/* ============================================================================
+ * Reference: if-chain honoring runtime levels (compare per source)
+ * ============================================================================ */
+
+/** @brief Configured levels, read per resolve like g_fault_priorities */
+static volatile uint8_t g_levels[3] = { 1U, 2U, 3U };
+
+static inline fault_type_t runtime_chain_resolve(uint32_t active, uint8_t *level)
+{
+    fault_type_t winner = FAULT_TYPE_NONE;
+
+    *level = 0U;
+    if ((active & FAULT_TYPE_VDD) != 0U) {
+        winner = FAULT_TYPE_VDD;
+        *level = g_levels[0];
+    }
+    if ((active & FAULT_TYPE_CLK) != 0U && (*level == 0U || g_levels[1] < *level)) {
+        winner = FAULT_TYPE_CLK;
+        *level = g_levels[1];
+    }
+    if ((active & FAULT_TYPE_MEM_ECC) != 0U && (*level == 0U || g_levels[2] < *level)) {
+        winner = FAULT_TYPE_MEM_ECC;
+        *level = g_levels[2];
+    }
+    return winner;
+}
+
+/* ============================================================================
+ * Benchmark
+ * ============================================================================ */
+
+static uint8_t g_random_masks[PRIO_BENCH_MASKS];
+static uint8_t g_constant_masks[PRIO_BENCH_MASKS];
+
+/** @brief Result sink (keeps the resolves from being optimized out) */
+static volatile uint32_t g_sink;
+
+static uint32_t block_if_chain(const uint8_t *masks)
+{
+    uint32_t acc = 0;
+    uint8_t level;
+
+    for (uint32_t i = 0; i < PRIO_BENCH_BLOCK; i++) {
+        acc += (uint32_t)if_chain_resolve(masks[i], &level) + level;
+    }
+    return acc;
+}
+
+static uint32_t block_runtime_chain(const uint8_t *masks)
+{
+    uint32_t acc = 0;
+    uint8_t level;
+
+    for (uint32_t i = 0; i < PRIO_BENCH_BLOCK; i++) {
+        acc += (uint32_t)runtime_chain_resolve(masks[i], &level) + level;
+    }
+    return acc;
+}
+
+static uint32_t block_lut(const uint8_t *masks)
+{
+    uint32_t acc = 0;
+    uint8_t level;
+
+    for (uint32_t i = 0; i < PRIO_BENCH_BLOCK; i++) {
+        acc += (uint32_t)fault_priority_resolve(masks[i], &level) + level;
+    }
+    return acc;
+}
+
+/** @brief Benchmark cases, measured in order */
+static const struct {
+    const char *name;
+    uint32_t (*block)(const uint8_t *);
+    const uint8_t *masks;
+} g_cases[] = {
+    { "if_chain_random",        block_if_chain,      g_random_masks },
+    { "runtime_chain_random",   block_runtime_chain, g_random_masks },
+    { "lut_random",             block_lut,           g_random_masks },
+    { "if_chain_constant",      block_if_chain,      g_constant_masks },
+    { "runtime_chain_constant", block_runtime_chain, g_constant_masks },
+    { "lut_constant",           block_lut,           g_constant_masks },
+};
+
+#define PRIO_BENCH_CASES (sizeof(g_cases) / sizeof(g_cases[0]))
+
+static bench_stats_t g_stats[PRIO_BENCH_CASES];
+
+static void bench_case(size_t idx, unsigned long iterations, uint32_t overhead)
+{
+    uint32_t offset = 0;
+    unsigned long i;
+
+    for (i = 0; i < PRIO_BENCH_WARMUP + iterations; i++) {
+        const uint8_t *masks = &g_cases[idx].masks[offset];
+        uint32_t t0 = hal_cycle_count();
+        g_sink = g_cases[idx].block(masks);
+        uint32_t t1 = hal_cycle_count();
+        uint32_t cycles = t1 - t0;
+
+        offset = (offset + PRIO_BENCH_BLOCK) & (PRIO_BENCH_MASKS - 1U);
+        if (i >= PRIO_BENCH_WARMUP) {
+            bench_stats_record(&g_stats[idx],
+                               (cycles > overhead) ? (cycles - overhead) : 0U);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long iterations = PRIO_BENCH_DEFAULT_ITERATIONS;
+    uint32_t seed = 0x2545F491U;
+    uint64_t hz;
+    uint32_t overhead;
+    size_t i;
+
+    if (argc > 1) {
+        iterations = strtoul(argv[1], NULL, 0);
+        if (iterations == 0UL) {
+            iterations = PRIO_BENCH_DEFAULT_ITERATIONS;
+        }
+    }
+
+    /* xorshift32 mask sequence; constant case: all faults active */
+    for (i = 0; i < PRIO_BENCH_MASKS; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        g_random_masks[i] = (uint8_t)(seed & FAULT_TYPE_MULTIPLE);
+        g_constant_masks[i] = FAULT_TYPE_MULTIPLE;
+    }
+
+    hz = bench_cycle_hz();
+    overhead = bench_timer_overhead();
+
+    for (i = 0; i < PRIO_BENCH_CASES; i++) {
+        bench_stats_init(&g_stats[i], g_cases[i].name);
+        bench_case(i, iterations, overhead);
+    }
+
+    printf("{\n");
+    printf("  \"benchmark\": \"bench_priority\",\n");
+    printf("  \"cycle_hz\": %llu,\n", (unsigned long long)hz);
+    printf("  \"timer_overhead_cycles\": %lu,\n", (unsigned long)overhead);
+    printf("  \"iterations\": %lu,\n", iterations);
+    printf("  \"resolves_per_sample\": %u,\n", PRIO_BENCH_BLOCK);
+    printf("  \"paths\": [\n");
+    for (i = 0; i < PRIO_BENCH_CASES; i++) {
+        bench_stats_print_json(&g_stats[i], hz, 0U);
+        printf("%s\n", (i + 1U < PRIO_BENCH_CASES) ? "," : "");
+    }
+    printf("  ]\n");
+    printf("}\n");
+
+    return 0;
+}
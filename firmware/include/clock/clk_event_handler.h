@@ -0,0 +1,38 @@
+/**
+ * @file clk_event_handler.h
+ * @brief Clock Loss Event Handler (ISR) Interface
+ *
+ * Public interface of clock/clk_event_handler.c.
+ */
+
+#ifndef CLK_EVENT_HANDLER_H
+#define CLK_EVENT_HANDLER_H
+
+#include "safety_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @struct clk_event_statistics_t
+ * @brief Clock fault event diagnostics snapshot
+ */
+typedef struct {
+    uint32_t clk_fault_count;        /*!< Total clock loss events */
+    uint32_t clk_loss_timestamp;     /*!< Timestamp of last clock loss */
+    uint8_t clk_isr_nesting_level;   /*!< Current ISR nesting level */
+} clk_event_statistics_t;
+
+safety_result_t clk_event_handler_init(void);
+safety_result_t clk_event_handler_get_fault_flag(volatile bool *out_fault_detected);
+safety_result_t clk_event_handler_clear_fault(void);
+safety_result_t clk_event_handler_get_statistics(
+    volatile clk_event_statistics_t *out_stats);
+void clk_event_handler_clk_loss_isr(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CLK_EVENT_HANDLER_H */
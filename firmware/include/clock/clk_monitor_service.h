@@ -0,0 +1,40 @@
+/**
+ * @file clk_monitor_service.h
+ * @brief Clock Recovery and Monitoring Service Interface
+ *
+ * Public interface of clock/clk_monitor_service.c.
+ */
+
+#ifndef CLK_MONITOR_SERVICE_H
+#define CLK_MONITOR_SERVICE_H
+
+#include "safety_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @enum clk_service_state_t
+ * @brief Clock recovery service state
+ */
+typedef enum {
+    CLK_SERVICE_STATE_IDLE = 0x00U,         // Monitoring, no fault active
+    CLK_SERVICE_STATE_FAULT_ACTIVE = 0x01U, // Clock fault detected, waiting for recovery
+    CLK_SERVICE_STATE_RECOVERY_PENDING = 0x02U,  // Clock recovered, validating stability
+    CLK_SERVICE_STATE_RECOVERY_CONFIRMED = 0x03U  // Clock stable, ready for system recovery
+} clk_service_state_t;
+
+safety_result_t clk_service_init(void);
+safety_result_t clk_service_handle_fault(void);
+safety_result_t clk_service_request_recovery(void);
+clk_service_state_t clk_service_get_state(void);
+void clk_service_task(void);
+uint32_t clk_service_get_recovery_attempts(void);
+safety_result_t clk_service_reset_statistics(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CLK_MONITOR_SERVICE_H */
@@ -0,0 +1,295 @@
+/**
+ * @file hal_cpu.h
+ * @brief CPU Core Abstraction (interrupt masking, ISR attributes)
+ *
+ * Wraps the few core-specific instructions the safety firmware needs so
+ * that the same sources build for the ARM Cortex-M4 target and for the
+ * x86-64 host build (FIRMWARE_HOST_BUILD).
+ *
+ * Target build:
+ *  - hal_irq_disable()/hal_irq_enable() inline to CPSID I / CPSIE I
+ *  - hal_irq_save()/hal_irq_restore() nest: they restore PRIMASK instead
+ *    of unconditionally re-enabling (safe inside ISRs and masked sections)
+ *  - HAL_ISR marks a function as an exception handler
+ *  - hal_cycle_count() reads DWT_CYCCNT (core clock cycles)
+ *  - hal_ldrex32()/hal_strex32() expose the exclusive monitor for
+ *    lock-free read-modify-write of shared words
+ *  - hal_trylock()/hal_unlock() build a non-blocking lock on LDREX/STREX
+ *
+ * Host build:
+ *  - Interrupt masking degrades to a compiler barrier (ISRs are invoked
+ *    synchronously by tests and benchmarks, never asynchronously)
+ *  - HAL_ISR expands to nothing (x86 interrupt attribute requires a
+ *    different prototype)
+ *  - hal_cycle_count() reads the TSC (rdtsc)
+ *  - hal_trylock()/hal_unlock() use a C11 atomic_flag
+ *
+ * Compliance:
+ *  - ISO 26262-6:2018 Section 7.5.1 (Exception handling)
+ *  - TSR-002 (ISR framework with < 5μs latency)
+ */
+
+#ifndef HAL_CPU_H
+#define HAL_CPU_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(FIRMWARE_HOST_BUILD)
+#include <stdatomic.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <time.h>
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(FIRMWARE_HOST_BUILD)
+
+/** @brief ISR function attribute (host: plain function) */
+#define HAL_ISR
+
+/**
+ * @brief Disable interrupts (host: compiler barrier only)
+ */
+static inline void hal_irq_disable(void)
+{
+    __asm volatile ("" : : : "memory");
+}
+
+/**
+ * @brief Enable interrupts (host: compiler barrier only)
+ */
+static inline void hal_irq_enable(void)
+{
+    __asm volatile ("" : : : "memory");
+}
+
+/**
+ * @brief Disable interrupts, returning the previous mask (host: barrier)
+ */
+static inline uint32_t hal_irq_save(void)
+{
+    __asm volatile ("" : : : "memory");
+    return 0U;
+}
+
+/**
+ * @brief Restore the mask returned by hal_irq_save() (host: barrier)
+ */
+static inline void hal_irq_restore(uint32_t primask)
+{
+    (void)primask;
+    __asm volatile ("" : : : "memory");
+}
+
+/**
+ * @brief Enable the cycle counter (host: TSC always running)
+ */
+static inline void hal_cycle_counter_init(void)
+{
+}
+
+/**
+ * @brief Read the free-running cycle counter
+ *
+ * Host: LFENCE-ordered RDTSC so earlier instructions retire before the
+ * timestamp is taken. Non-x86 hosts fall back to CLOCK_MONOTONIC ns.
+ *
+ * @return Current cycle count (wraps)
+ */
+static inline uint32_t hal_cycle_count(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_lfence();
+    return (uint32_t)__rdtsc();
+#else
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL +
+                      (uint64_t)ts.tv_nsec);
+#endif
+}
+
+/** @brief Non-blocking lock (host: C11 atomic_flag) */
+typedef atomic_flag hal_lock_t;
+
+/** @brief Initializer for an unlocked hal_lock_t */
+#define HAL_LOCK_INIT ATOMIC_FLAG_INIT
+
+/**
+ * @brief Try to take a lock without waiting
+ *
+ * @return true if the lock was taken (acquire ordering)
+ */
+static inline bool hal_trylock(hal_lock_t *lock)
+{
+    return !atomic_flag_test_and_set_explicit(lock, memory_order_acquire);
+}
+
+/**
+ * @brief Release a lock taken with hal_trylock() (release ordering)
+ */
+static inline void hal_unlock(hal_lock_t *lock)
+{
+    atomic_flag_clear_explicit(lock, memory_order_release);
+}
+
+#else
+
+/** @brief Debug Exception and Monitor Control Register (TRCENA = bit 24) */
+#define HAL_DEMCR      (*(volatile uint32_t *)0xE000EDFCUL)
+#define HAL_DEMCR_TRCENA (1UL << 24)
+
+/** @brief DWT control register (CYCCNTENA = bit 0) and cycle counter */
+#define HAL_DWT_CTRL   (*(volatile uint32_t *)0xE0001000UL)
+#define HAL_DWT_CYCCNT (*(volatile uint32_t *)0xE0001004UL)
+#define HAL_DWT_CTRL_CYCCNTENA (1UL << 0)
+
+/** @brief ISR function attribute (target: exception handler) */
+#define HAL_ISR __attribute__((interrupt))
+
+/**
+ * @brief Disable interrupts (target: CPSID I, 1 cycle)
+ */
+static inline void hal_irq_disable(void)
+{
+    __asm volatile ("cpsid i" : : : "memory");
+}
+
+/**
+ * @brief Enable interrupts (target: CPSIE I, 1 cycle)
+ */
+static inline void hal_irq_enable(void)
+{
+    __asm volatile ("cpsie i" : : : "memory");
+}
+
+/**
+ * @brief Disable interrupts, returning the previous PRIMASK (MRS + CPSID I)
+ */
+static inline uint32_t hal_irq_save(void)
+{
+    uint32_t primask;
+
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) : : "memory");
+    return primask;
+}
+
+/**
+ * @brief Restore the PRIMASK returned by hal_irq_save() (MSR)
+ */
+static inline void hal_irq_restore(uint32_t primask)
+{
+    __asm volatile ("msr primask, %0" : : "r" (primask) : "memory");
+}
+
+/**
+ * @brief Enable the DWT cycle counter (call once at boot)
+ */
+static inline void hal_cycle_counter_init(void)
+{
+    HAL_DEMCR |= HAL_DEMCR_TRCENA;
+    HAL_DWT_CYCCNT = 0U;
+    HAL_DWT_CTRL |= HAL_DWT_CTRL_CYCCNTENA;
+}
+
+/**
+ * @brief Read the free-running cycle counter (target: DWT_CYCCNT, 1 LDR)
+ *
+ * @return Current core clock cycle count (wraps every ~10.7s @ 400MHz)
+ */
+static inline uint32_t hal_cycle_count(void)
+{
+    return HAL_DWT_CYCCNT;
+}
+
+/**
+ * @brief Load-exclusive a 32-bit word (LDREX)
+ */
+static inline uint32_t hal_ldrex32(volatile uint32_t *addr)
+{
+    uint32_t value;
+    __asm volatile ("ldrex %0, [%1]" : "=r" (value) : "r" (addr) : "memory");
+    return value;
+}
+
+/**
+ * @brief Store-exclusive a 32-bit word (STREX)
+ *
+ * Fails if an exception or another access cleared the exclusive monitor
+ * since the matching hal_ldrex32().
+ *
+ * @return 0 on success, 1 if the store failed and must be retried
+ */
+static inline uint32_t hal_strex32(uint32_t value, volatile uint32_t *addr)
+{
+    uint32_t failed;
+    __asm volatile ("strex %0, %2, [%1]"
+                    : "=&r" (failed) : "r" (addr), "r" (value) : "memory");
+    return failed;
+}
+
+/**
+ * @brief Clear the local exclusive monitor (CLREX)
+ */
+static inline void hal_clrex(void)
+{
+    __asm volatile ("clrex" : : : "memory");
+}
+
+/**
+ * @brief Data memory barrier (DMB)
+ */
+static inline void hal_dmb(void)
+{
+    __asm volatile ("dmb" : : : "memory");
+}
+
+/** @brief Non-blocking lock (target: word owned via LDREX/STREX) */
+typedef volatile uint32_t hal_lock_t;
+
+/** @brief Initializer for an unlocked hal_lock_t */
+#define HAL_LOCK_INIT 0U
+
+/**
+ * @brief Try to take a lock without waiting
+ *
+ * Never spins on a held lock, so it is safe from an ISR that preempted
+ * the holder; only retries when STREX lost the exclusive monitor.
+ *
+ * @return true if the lock was taken
+ */
+static inline bool hal_trylock(hal_lock_t *lock)
+{
+    do {
+        if (hal_ldrex32(lock) != 0U) {
+            hal_clrex();
+            return false;
+        }
+    } while (hal_strex32(1U, lock) != 0U);
+
+    hal_dmb();
+    return true;
+}
+
+/**
+ * @brief Release a lock taken with hal_trylock()
+ */
+static inline void hal_unlock(hal_lock_t *lock)
+{
+    hal_dmb();
+    *lock = 0U;
+}
+
+#endif /* FIRMWARE_HOST_BUILD */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_CPU_H */
@@ -0,0 +1,43 @@
+/**
+ * @file interrupt_handler.h
+ * @brief ISO 26262 Interrupt Vector Table and Fault ISR Interface
+ *
+ * Public interface of hal/interrupt_handler.c.
+ *
+ * Compliance:
+ *  - ISO 26262-6:2018 Section 7.5.1 (Exception handling)
+ *  - TSR-002 (ISR framework with < 5μs latency)
+ */
+
+#ifndef HAL_INTERRUPT_HANDLER_H
+#define HAL_INTERRUPT_HANDLER_H
+
+#include "safety_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ISR numbers used by the diagnostic/priority functions */
+#define ISR_NUMBER_VDD 0U  /*!< VDD fault ISR (P1) */
+#define ISR_NUMBER_CLK 1U  /*!< Clock fault ISR (P2) */
+#define ISR_NUMBER_MEM 2U  /*!< Memory fault ISR (P3) */
+
+/* Fault ISR entry points (< 5μs, TSR-002) */
+void vdd_isr_handler(void);
+void clk_isr_handler(void);
+void mem_isr_handler(void);
+
+/* ISR configuration and diagnostics */
+bool interrupt_handler_init(void);
+uint32_t interrupt_handler_get_call_count(uint8_t isr_number);
+bool interrupt_handler_check_health(void);
+bool interrupt_handler_disable_all(void);
+bool interrupt_handler_enable_all(void);
+bool interrupt_handler_set_priority(uint8_t isr_number, uint8_t priority);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_INTERRUPT_HANDLER_H */
@@ -0,0 +1,38 @@
+/**
+ * @file power_api.h
+ * @brief ISO 26262 Power Control API
+ *
+ * Public interface of hal/power_api.c.
+ *
+ * Compliance:
+ *  - ISO 26262-6:2018 Section 7.4.1 (Resource management)
+ *  - SysReq-002 (Safe state < 10ms requirement)
+ */
+
+#ifndef HAL_POWER_API_H
+#define HAL_POWER_API_H
+
+#include "safety_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+bool power_init(void);
+bool power_get_status(uint8_t *mode, uint16_t *voltage_mv);
+uint16_t power_get_voltage_mv(void);
+bool power_enter_safe_state(void);
+bool power_request_recovery(void);
+uint32_t power_get_last_error(void);
+bool power_is_within_safe_range(void);
+bool power_update_voltage(uint16_t voltage_mv);
+bool power_write_enabled(void);
+bool power_enable_fault_irq(void);
+const char* power_get_mode_string(uint8_t mode);
+bool power_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_POWER_API_H */
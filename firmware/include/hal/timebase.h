@@ -0,0 +1,164 @@
+/**
+ * @file timebase.h
+ * @brief Monotonic High-Resolution Timebase
+ *
+ * Single time source for fault timestamps, aggregation time and latency
+ * measurement (fault detection -> safe state).
+ *
+ * Target build (ARM Cortex-M4 @ 400MHz):
+ *  - 32-bit tick: DWT_CYCCNT, one LDR, usable from any ISR
+ *  - 64-bit tick: DWT_CYCCNT extended by a half-wrap epoch word that the
+ *    SysTick ISR (1ms) advances. The epoch is a single 32-bit word, so a
+ *    read is one LDR of the epoch plus one LDR of CYCCNT with no retry
+ *    loop and no interrupt masking - tear-free from any priority level.
+ *
+ * Host build (FIRMWARE_HOST_BUILD):
+ *  - 64-bit tick: CLOCK_MONOTONIC in nanoseconds (vDSO, tear-free)
+ *  - 32-bit tick: low word of the 64-bit tick
+ *
+ * Compliance:
+ *  - ISO 26262-6:2018 Section 7.4.14 (Timing of software execution)
+ *  - TSR-002 (ISR framework with < 5μs latency)
+ */
+
+#ifndef HAL_TIMEBASE_H
+#define HAL_TIMEBASE_H
+
+#include <stdint.h>
+#include "hal/hal_cpu.h"
+
+#if defined(FIRMWARE_HOST_BUILD)
+#include <time.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * Configuration
+ * ============================================================================ */
+
+#if defined(FIRMWARE_HOST_BUILD)
+/** @brief Tick frequency (host: CLOCK_MONOTONIC nanoseconds) */
+#define TIMEBASE_TICK_HZ 1000000000ULL
+#else
+/** @brief Tick frequency (target: core clock, DWT_CYCCNT) */
+#define TIMEBASE_TICK_HZ 400000000ULL
+#endif
+
+/** @brief SysTick period used to advance the 64-bit epoch */
+#define TIMEBASE_SYSTICK_HZ 1000U
+
+#define TIMEBASE_TICKS_PER_MS (TIMEBASE_TICK_HZ / 1000ULL)
+#define TIMEBASE_TICKS_PER_US (TIMEBASE_TICK_HZ / 1000000ULL)
+
+/* ============================================================================
+ * Timebase Interface
+ * ============================================================================ */
+
+/**
+ * @brief Start the cycle counter and the SysTick epoch update
+ *
+ * Called once at boot before interrupts are enabled.
+ */
+void timebase_init(void);
+
+/**
+ * @brief SysTick exception handler (advances the 64-bit epoch)
+ *
+ * Host: no-op, the host clock is 64-bit already.
+ */
+void timebase_systick_isr(void);
+
+/**
+ * @brief Extend a 32-bit cycle count to 64 bits with a half-wrap epoch
+ *
+ * @p epoch counts half periods (2^31 cycles) of the counter, so its parity
+ * equals bit 31 of the counter when it was last updated. If bit 31 of
+ * @p cycles differs, the counter has crossed a half period since then and
+ * the epoch is one behind. Valid while the epoch is updated at least once
+ * per 2^31 cycles (5.3s at 400MHz).
+ */
+static inline uint64_t timebase_extend(uint32_t epoch, uint32_t cycles)
+{
+    if ((cycles >> 31) != (epoch & 1U)) {
+        epoch++;
+    }
+
+    return ((uint64_t)(epoch >> 1) << 32) | cycles;
+}
+
+#if defined(FIRMWARE_HOST_BUILD)
+
+/**
+ * @brief Read the 64-bit monotonic tick
+ */
+static inline uint64_t timebase_ticks64(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Read the 32-bit monotonic tick (wraps every ~4.3s on host)
+ */
+static inline uint32_t timebase_ticks32(void)
+{
+    return (uint32_t)timebase_ticks64();
+}
+
+#else
+
+/** @brief Half-wrap epoch of DWT_CYCCNT (defined in hal/timebase.c) */
+extern volatile uint32_t g_timebase_epoch;
+
+/**
+ * @brief Read the 32-bit monotonic tick (one LDR of DWT_CYCCNT)
+ *
+ * Wraps every ~10.7s at 400MHz; compare with (int32_t)(a - b).
+ */
+static inline uint32_t timebase_ticks32(void)
+{
+    return hal_cycle_count();
+}
+
+/**
+ * @brief Read the 64-bit monotonic tick (tear-free, no retry loop)
+ *
+ * One LDR of the epoch and one of CYCCNT; a stale epoch (SysTick pending
+ * or preempted) is corrected by timebase_extend().
+ */
+static inline uint64_t timebase_ticks64(void)
+{
+    uint32_t epoch = g_timebase_epoch;
+
+    return timebase_extend(epoch, hal_cycle_count());
+}
+
+#endif /* FIRMWARE_HOST_BUILD */
+
+/**
+ * @brief Monotonic time in milliseconds
+ *
+ * Target: since timebase_init(). Host: since host boot.
+ */
+static inline uint64_t timebase_ms(void)
+{
+    return timebase_ticks64() / TIMEBASE_TICKS_PER_MS;
+}
+
+/**
+ * @brief Convert a tick interval to microseconds
+ */
+static inline uint64_t timebase_ticks_to_us(uint64_t ticks)
+{
+    return ticks / TIMEBASE_TICKS_PER_US;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_TIMEBASE_H */
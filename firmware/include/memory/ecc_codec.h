@@ -0,0 +1,109 @@
+/**
+ * @file ecc_codec.h
+ * @brief Software (72,64) Hamming SEC/DED Codec Interface
+ *
+ * Public interface of memory/ecc_codec.c: a C model of
+ * rtl/memory_protection/ecc_encoder.v and ecc_decoder.v, bit-exact with
+ * the RTL equations, for use as the golden model in verification and as
+ * a software ECC fallback for memories without the hardware engine.
+ *
+ * Code word (RTL format):
+ *  - ecc[5:0] = p32, p16, p8, p4, p2, p1 over data[62:0]; data bit i is
+ *    covered by p(2^k) when bit k of (i + 1) is set
+ *  - ecc[6]   = p64 = data[63] ^ p1 ^ p2 ^ p4 ^ p8 ^ p16 ^ p32
+ *  - ecc[7]   = XOR of all data bits
+ *
+ * Decode (RTL format):
+ *  - syndrome[5:0] = recomputed p ^ ecc[5:0]
+ *  - syndrome[6]   = ecc[6] ^ data[63] ^ syndrome[0] ^ ... ^ syndrome[5]
+ *  - overall       = XOR of data and ecc[7]
+ *  - sbe = (syndrome != 0) & overall, mbe = (syndrome != 0) & ~overall
+ *  - error_pos = syndrome; on SBE with syndrome 1-64, data bit
+ *    (syndrome - 1) is flipped
+ *
+ * Note: syndrome[6] is taken over the syndrome bits rather than the
+ * recomputed parity bits, exactly as in ecc_decoder.v. A clean word whose
+ * p1..p32 have odd parity therefore decodes as MBE with error_pos 64; the
+ * model reproduces this so that it stays bit-exact with the hardware.
+ * ecc_check64() instead checks a stored word against the encoder and
+ * repairs a single flipped bit by check-matrix column; it is what code
+ * repairing memory (the scrubber) uses.
+ *
+ * Implementations (identical results, selectable for batches):
+ *  - TABLE:  8 byte-indexed lookups per word (scalar ecc_encode64)
+ *  - WORD:   table-free 32-bit XOR folding (target default, no flash
+ *            table reads)
+ *  - AVX2:   host, byte parities with VPSHUFB/VPMOVMSKB, 4 words per step
+ *  - AVX512: host, VPOPCNTQ parity of the 8 check masks, 8 words per step
+ *
+ * Feature: 001-Power-Management-Safety
+ * User Story: US3 - Memory ECC Protection & Diagnostics
+ * ASIL Level: ASIL-B
+ */
+
+#ifndef ECC_CODEC_H
+#define ECC_CODEC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Decode Results
+// ============================================================================
+
+/**
+ * @brief Result of decoding one 72-bit code word (ecc_decoder.v outputs)
+ */
+typedef struct {
+    uint64_t data;      // Corrected data (data_out)
+    uint8_t error_pos;  // Syndrome (0 = none, see ecc_syndrome_column())
+    bool sbe;           // Single-Bit Error (sbe_flag)
+    bool mbe;           // Multiple-Bit Error (mbe_flag)
+} ecc_decode_t;
+
+/**
+ * @brief Summary of one ecc_decode64_batch() call
+ */
+typedef struct {
+    uint32_t sbe_count;  // Words decoded as SBE (corrected)
+    uint32_t mbe_count;  // Words decoded as MBE (left as read)
+    size_t first_error;  // Index of the first SBE/MBE word (count if none)
+} ecc_batch_stats_t;
+
+/**
+ * @brief Batch implementation selector
+ */
+typedef enum {
+    ECC_CODEC_PATH_AUTO = 0,  // Fastest available on this build/CPU
+    ECC_CODEC_PATH_TABLE,     // Byte-indexed lookup tables
+    ECC_CODEC_PATH_WORD,      // Table-free 32-bit XOR folding
+    ECC_CODEC_PATH_AVX2,      // Host x86-64 with AVX2
+    ECC_CODEC_PATH_AVX512     // Host x86-64 with AVX-512F + VPOPCNTDQ
+} ecc_codec_path_t;
+
+// ============================================================================
+// Codec Interface
+// ============================================================================
+
+uint8_t ecc_encode64(uint64_t data);
+void ecc_decode64(uint64_t data, uint8_t ecc, ecc_decode_t *result);
+void ecc_check64(uint64_t data, uint8_t ecc, ecc_decode_t *result);
+uint8_t ecc_syndrome_column(uint8_t syndrome);
+
+void ecc_encode64_batch(const uint64_t *data, uint8_t *ecc, size_t count);
+void ecc_decode64_batch(const uint64_t *data, const uint8_t *ecc,
+                        uint64_t *out, size_t count, ecc_batch_stats_t *stats);
+
+bool ecc_codec_select_path(ecc_codec_path_t path);
+ecc_codec_path_t ecc_codec_get_path(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECC_CODEC_H */
@@ -0,0 +1,71 @@
+/**
+ * @file ecc_handler.h
+ * @brief ECC Fault Event Handler (ISR and Recovery) Interface
+ *
+ * Public interface of memory/ecc_handler.c.
+ *
+ * Feature: 001-Power-Management-Safety
+ * User Story: US3 - Memory ECC Protection & Diagnostics
+ * Task: T040
+ * ASIL Level: ASIL-B
+ */
+
+#ifndef ECC_HANDLER_H
+#define ECC_HANDLER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Double-Complement Lock Step (DCLS) protection for fault flag
+// flag ^ complement must equal 0xFF for valid state
+typedef struct {
+    volatile uint8_t mem_fault_flag;           // Main flag
+    volatile uint8_t mem_fault_flag_complement; // Complement (0xFF - flag)
+    volatile uint8_t mem_isr_nesting_count;    // Reentry counter
+    volatile uint32_t mem_fault_event_count;   // Event counter
+} mem_fault_state_t;
+
+// Memory fault flag state (defined in ecc_handler.c)
+extern mem_fault_state_t mem_fault_state;
+
+// Hybrid SBE handling: at or above ECC_POLL_ENTER_SBE_PER_MS the ISR masks
+// SBE interrupts and ecc_fault_poll_task() collects SBEs; below
+// ECC_POLL_EXIT_SBE_PER_MS interrupts are restored. MBEs always interrupt.
+#define ECC_POLL_ENTER_SBE_PER_MS 32U     // SBEs per ms to switch to polling
+#define ECC_POLL_EXIT_SBE_PER_MS  4U      // SBEs per ms to switch back
+#define ECC_POLL_BUDGET_CYCLES    2000U   // Poll task budget (5μs @ 400MHz)
+
+// Fault event info of FAULT_TYPE_MEM_ECC events (flight recorder syndrome):
+// [7:0] syndrome (error position) of the last drained error, 0 if none;
+// [8] an MBE was among the drained errors
+#define ECC_EVENT_INFO_SYNDROME_MASK 0x00FFU
+#define ECC_EVENT_INFO_MBE           0x0100U
+
+bool ecc_handler_init(void);
+void ecc_fault_isr(void);
+bool ecc_fault_is_active(void);
+uint32_t ecc_fault_get_event_count(void);
+uint16_t ecc_fault_get_sbe_count(void);
+uint16_t ecc_fault_get_mbe_count(void);
+uint8_t ecc_fault_get_last_error_type(void);
+bool ecc_fault_clear(void);
+bool ecc_fault_detect_corruption(void);
+uint8_t ecc_fault_get_reentry_count(void);
+bool ecc_fault_record_sbe(void);
+bool ecc_fault_record_mbe(void);
+bool ecc_handler_is_enabled(void);
+void ecc_handler_set_enable(bool enable);
+bool ecc_fault_set_poll_thresholds(uint32_t enter_per_ms, uint32_t exit_per_ms);
+bool ecc_fault_is_polling(void);
+uint32_t ecc_fault_get_mode_switches(void);
+uint32_t ecc_fault_poll_task(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECC_HANDLER_H */
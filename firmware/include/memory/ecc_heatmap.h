@@ -0,0 +1,59 @@
+/**
+ * @file ecc_heatmap.h
+ * @brief ECC Error Heatmap Interface (per-bit histogram, top-K addresses)
+ *
+ * Public interface of memory/ecc_heatmap.c. Corrected errors are counted
+ * per bit position of the 72-bit code word and per failing word address,
+ * so a weak cell shows up as one hot bin/address long before a second
+ * upset in the same word produces an MBE.
+ *
+ * Memory is fixed: 72 bit bins plus a space-saving table of the
+ * ECC_HEATMAP_TOP_K most frequent addresses. A space-saving entry's
+ * count overestimates the true count by at most its error; count - error
+ * is a guaranteed lower bound.
+ *
+ * Feature: 001-Power-Management-Safety
+ * User Story: US3 - Memory ECC Protection & Diagnostics
+ * ASIL Level: ASIL-B
+ */
+
+#ifndef ECC_HEATMAP_H
+#define ECC_HEATMAP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+#define ECC_HEATMAP_BITS       72U           // 64 data + 8 check bit bins
+#define ECC_HEATMAP_TOP_K      8U            // Tracked failing addresses
+#define ECC_HEATMAP_NO_ADDRESS 0xFFFFFFFFUL  // Event without an address
+
+/**
+ * @brief One tracked failing address (space-saving entry)
+ */
+typedef struct {
+    uint32_t address;  // Word address (8-byte aligned)
+    uint32_t count;    // Estimated errors (>= true count)
+    uint32_t error;    // Maximum overestimate of count
+} ecc_heatmap_entry_t;
+
+void ecc_heatmap_record(uint8_t error_pos, uint32_t address);
+void ecc_heatmap_reset(void);
+bool ecc_heatmap_get_bits(uint32_t *bins, size_t count);
+uint32_t ecc_heatmap_get_unmapped(void);
+size_t ecc_heatmap_get_top(ecc_heatmap_entry_t *entries, size_t max_entries);
+bool ecc_heatmap_find_weak(uint32_t threshold, uint32_t *address);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECC_HEATMAP_H */
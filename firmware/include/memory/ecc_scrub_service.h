@@ -0,0 +1,82 @@
+/**
+ * @file ecc_scrub_service.h
+ * @brief Background Memory Scrubber Interface
+ *
+ * Public interface of memory/ecc_scrub_service.c: a time-sliced scrubber
+ * that walks configured SRAM regions a chunk at a time, so single-bit
+ * errors are corrected in place before a second upset in the same word
+ * turns them into an uncorrectable MBE.
+ *
+ * Tuning: each ecc_scrub_task() call scrubs chunks of chunk_words words
+ * until the next chunk would exceed budget_cycles. The coverage period
+ * (time to visit every word once) is roughly
+ *   total_words / words_per_tick * tick_period
+ * and is reported as measured in ecc_scrub_stats_t, together with the
+ * achieved scrub rate.
+ *
+ * Feature: 001-Power-Management-Safety
+ * User Story: US3 - Memory ECC Protection & Diagnostics
+ * ASIL Level: ASIL-B
+ */
+
+#ifndef ECC_SCRUB_SERVICE_H
+#define ECC_SCRUB_SERVICE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+#define ECC_SCRUB_MAX_REGIONS           4U      // Regions per ecc_scrub_init()
+#define ECC_SCRUB_MAX_CHUNK_WORDS       64U     // Chunk size limit (stack copy)
+#define ECC_SCRUB_DEFAULT_CHUNK_WORDS   16U     // 128 bytes per chunk
+#define ECC_SCRUB_DEFAULT_BUDGET_CYCLES 4000U   // 10μs @ 400MHz per tick
+
+/**
+ * @brief Memory region to scrub
+ *
+ * Hardware regions (ecc == NULL) sit behind the ECC controller: reads
+ * return corrected data and bump its SBE/MBE counters, writes store a
+ * freshly encoded word. Software regions keep one ecc_encode64() check
+ * byte per word in @c ecc; their owner must update data and check byte
+ * from the scrubber's context or with interrupts masked.
+ */
+typedef struct {
+    volatile uint64_t *base;  // First word (8-byte aligned)
+    size_t words;             // Region length in 64-bit words
+    uint8_t *ecc;             // Check bytes, NULL = hardware ECC region
+} ecc_scrub_region_t;
+
+/**
+ * @brief Scrubber statistics snapshot returned by ecc_scrub_get_stats()
+ */
+typedef struct {
+    uint64_t words_scrubbed;     // Words read since init
+    uint32_t passes_completed;   // Full passes over all regions
+    uint32_t sbe_corrected;      // Words written back after an SBE
+    uint32_t mbe_detected;       // Uncorrectable words found
+    uint32_t budget_overruns;    // Ticks that exceeded budget_cycles
+    uint32_t max_tick_cycles;    // Longest ecc_scrub_task() call
+    uint32_t coverage_period_ms; // Duration of the last full pass (0 = none yet)
+    uint32_t scrub_rate_bps;     // Bytes/s over the last full pass
+    uint32_t region_index;       // Cursor: region of the next chunk
+    uint32_t word_index;         // Cursor: word of the next chunk
+} ecc_scrub_stats_t;
+
+bool ecc_scrub_init(const ecc_scrub_region_t *regions, size_t count);
+bool ecc_scrub_configure(uint32_t chunk_words, uint32_t budget_cycles);
+uint32_t ecc_scrub_task(void);
+bool ecc_scrub_get_stats(ecc_scrub_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECC_SCRUB_SERVICE_H */
@@ -0,0 +1,140 @@
+/**
+ * @file ecc_service.h
+ * @brief ECC Service Initialization and Configuration Interface
+ *
+ * Public interface of memory/ecc_service.c.
+ *
+ * Feature: 001-Power-Management-Safety
+ * User Story: US3 - Memory ECC Protection & Diagnostics
+ * Task: T039
+ * ASIL Level: ASIL-B
+ */
+
+#ifndef ECC_SERVICE_H
+#define ECC_SERVICE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Hardware Register Map (ecc_controller.v APB slave)
+// ============================================================================
+
+// ECC Controller Register Base Address
+#define ECC_BASE_ADDR 0x40011000UL
+
+// Register Offsets
+#define ECC_CTRL_OFFSET       0x00    // Control Register
+#define ECC_SBE_COUNT_OFFSET  0x04    // SBE Counter
+#define ECC_MBE_COUNT_OFFSET  0x08    // MBE Counter
+#define ECC_ERR_STATUS_OFFSET 0x0C    // Error Status
+#define ECC_FIFO_STATUS_OFFSET 0x10   // Error FIFO level / overflow
+#define ECC_FIFO_POP_OFFSET    0x14   // Error FIFO pop (read side effect)
+#define ECC_FIFO_ADDR_OFFSET   0x18   // Address of the last popped entry
+#define ECC_IRQ_COAL_OFFSET    0x1C   // Interrupt coalescing (N events / T cycles)
+
+// Interrupt coalescing defaults: one interrupt per 8 errors or 10μs after
+// the first pending one (4000 cycles @ 400MHz); MBEs always interrupt at once
+#define ECC_IRQ_COAL_DEFAULT_COUNT   8U
+#define ECC_IRQ_COAL_DEFAULT_TIMEOUT 4000U
+#define ECC_IRQ_COAL_TIMEOUT_MAX     0xFFFFFFUL  // 24-bit field
+
+// Error FIFO entries drained by ecc_fault_isr() per interrupt (one full
+// FIFO, so a coalesced interrupt of up to 8 errors leaves nothing behind)
+#define ECC_FIFO_DRAIN_PER_IRQ 8U
+
+/**
+ * @brief Hardware counter mode (ECC_CTRL[9:8], ecc_controller.v)
+ */
+typedef enum {
+    ECC_COUNTER_SATURATE = 0,      // Stop at 65535 (reset default)
+    ECC_COUNTER_WRAP = 1,          // Count modulo 65536
+    ECC_COUNTER_CLEAR_ON_READ = 2  // Each read returns and restarts the count
+} ecc_counter_mode_t;
+
+/**
+ * @brief One error captured by the controller's error FIFO
+ */
+typedef struct {
+    uint32_t address;        // Address of the failing access
+    uint8_t syndrome;        // Decoder syndrome (ecc_syndrome_column() gives the bit)
+    bool sbe;                // Corrected single-bit error
+    bool mbe;                // Uncorrectable multiple-bit error
+} ecc_error_entry_t;
+
+/**
+ * @brief ECC status snapshot returned by ecc_get_status()
+ *
+ * The 16-bit counts are since ecc_init() or the last ecc_clear_counters()
+ * and saturate at 65535; the 64-bit totals are since ecc_init() and are
+ * not reset by ecc_clear_counters().
+ */
+typedef struct {
+    uint16_t sbe_count;      // SBE count since clear (capped at 65535)
+    uint16_t mbe_count;      // MBE count since clear (capped at 65535)
+    uint8_t last_error_type; // 0=none, 1=SBE, 2=MBE
+    uint8_t last_error_pos;  // Decoder syndrome (0=none, see ecc_syndrome_column())
+    bool ecc_enabled;        // ECC enable status
+    bool counts_lost;        // Hardware counter saturated: totals are a lower bound
+    uint64_t sbe_total;      // SBE count since init
+    uint64_t mbe_total;      // MBE count since init
+} ecc_status_t;
+
+// ============================================================================
+// Status Shadow Cache
+// ============================================================================
+
+// Upper bound on shadow age even without an invalidation (100ms)
+#define ECC_STATUS_MAX_AGE_MS 100U
+
+/**
+ * @brief Status shadow generation, bumped on every ECC interrupt
+ *
+ * ecc_controller.v raises mem_fault_irq for every SBE and MBE, i.e. for
+ * every change of the counter and status registers, so ecc_fault_isr()
+ * bumping this word keeps the shadow coherent. With interrupt coalescing
+ * the shadow lags by at most the coalescing timeout; while SBEs are
+ * polled (ecc_set_sbe_fault_mask), ecc_fault_poll_task() bumps it.
+ */
+extern volatile uint32_t g_ecc_status_generation;
+
+/**
+ * @brief Mark the status shadow stale (ISR-safe, one increment)
+ */
+static inline void ecc_status_invalidate(void)
+{
+    g_ecc_status_generation++;
+}
+
+bool ecc_init(void);
+bool ecc_configure(uint8_t enable, uint8_t sbe_threshold,
+                   uint8_t sbe_irq_en, uint8_t mbe_irq_en);
+bool ecc_get_status(ecc_status_t *status);
+bool ecc_clear_counters(void);
+bool ecc_enable(void);
+bool ecc_disable(void);
+bool ecc_is_enabled(void);
+bool ecc_set_sbe_threshold(uint8_t threshold);
+uint16_t ecc_get_sbe_count(void);
+uint16_t ecc_get_mbe_count(void);
+bool ecc_validate_config(void);
+bool ecc_get_status_cache_stats(uint32_t *hits, uint32_t *misses);
+bool ecc_set_counter_mode(ecc_counter_mode_t mode);
+ecc_counter_mode_t ecc_get_counter_mode(void);
+uint64_t ecc_get_sbe_total(void);
+uint64_t ecc_get_mbe_total(void);
+size_t ecc_drain_errors(ecc_error_entry_t *entries, size_t max_entries);
+bool ecc_error_fifo_overflowed(void);
+bool ecc_set_irq_coalescing(uint8_t event_count, uint32_t timeout_cycles);
+bool ecc_set_sbe_fault_mask(bool masked);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECC_SERVICE_H */
@@ -0,0 +1,30 @@
+/**
+ * @file pwr_event_handler.h
+ * @brief Power Event ISR Handler Interface
+ *
+ * Public interface of power/pwr_event_handler.c.
+ */
+
+#ifndef PWR_EVENT_HANDLER_H
+#define PWR_EVENT_HANDLER_H
+
+#include "safety_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void pwr_event_handler_vdd_fault(void);
+void pwr_event_handler_init(void);
+uint8_t pwr_event_handler_get_nesting_level(void);
+uint32_t pwr_event_handler_get_event_count(void);
+uint64_t pwr_event_handler_get_last_fault_time(void);
+uint32_t pwr_event_handler_get_last_fault_ticks(void);
+void pwr_event_handler_reset_stats(void);
+uint8_t pwr_event_handler_verify(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PWR_EVENT_HANDLER_H */
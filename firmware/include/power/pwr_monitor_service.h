@@ -0,0 +1,41 @@
+/**
+ * @file pwr_monitor_service.h
+ * @brief Power Monitoring Service Interface
+ *
+ * Public interface of power/pwr_monitor_service.c.
+ */
+
+#ifndef PWR_MONITOR_SERVICE_H
+#define PWR_MONITOR_SERVICE_H
+
+#include "safety_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @enum pwr_service_state_t
+ * @brief Power monitoring service state (DCLS protected)
+ */
+typedef enum {
+    PWR_STATE_IDLE = 0x55,
+    PWR_STATE_MONITORING = 0xAA,
+    PWR_STATE_FAULT_DETECTED = 0xCC,
+    PWR_STATE_SAFE_STATE_ACTIVE = 0x33,
+    PWR_STATE_RECOVERY_ACTIVE = 0x99,
+    PWR_STATE_INVALID = 0x00
+} pwr_service_state_t;
+
+void pwr_monitor_service_tick(void);
+void pwr_monitor_service_init(void);
+pwr_service_state_t pwr_monitor_service_get_state(void);
+uint16_t pwr_monitor_service_get_vdd_reading(void);
+uint8_t pwr_monitor_service_get_recovery_attempts(void);
+uint32_t pwr_monitor_service_get_tick_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PWR_MONITOR_SERVICE_H */
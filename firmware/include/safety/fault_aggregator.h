@@ -0,0 +1,41 @@
+/**
+ * @file fault_aggregator.h
+ * @brief ISO 26262 Fault Aggregation Interface
+ *
+ * Public interface of safety/fault_aggregator.c.
+ *
+ * Compliance:
+ *  - ISO 26262-6:2018 Section 7.2.4 (Atomic operations)
+ *  - SysReq-002 (Fault priority and aggregation)
+ */
+
+#ifndef FAULT_AGGREGATOR_H
+#define FAULT_AGGREGATOR_H
+
+#include "safety_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+bool fault_aggregate(fault_type_t *aggregated_faults);
+fault_type_t fault_get_highest_priority(uint8_t *priority);
+bool fault_has_multiple_active(void);
+fault_type_t fault_get_all_active(void);
+bool fault_is_active(fault_type_t fault_to_check);
+bool fault_aggregator_reset(fault_type_t faults_to_clear);
+bool fault_set_priorities(uint8_t vdd_priority, uint8_t clk_priority,
+                          uint8_t mem_priority);
+bool fault_get_priorities(uint8_t *vdd_priority, uint8_t *clk_priority,
+                          uint8_t *mem_priority);
+uint32_t fault_get_aggregation_count(void);
+uint32_t fault_get_contention_count(void);
+uint32_t fault_get_retry_count(void);
+uint32_t fault_get_overrun_count(void);
+uint32_t fault_get_max_lock_hold_us(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FAULT_AGGREGATOR_H */
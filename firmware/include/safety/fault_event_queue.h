@@ -0,0 +1,133 @@
+/**
+ * @file fault_event_queue.h
+ * @brief Lock-free ISR-to-Safety-Task Fault Event Queue
+ *
+ * One wait-free single-producer/single-consumer ring per producer. Each
+ * fault source (VDD, CLK, MEM) has two handlers that can post: the generic
+ * vector handler in interrupt_handler.c and the driver's own handler.
+ * Nothing keeps those two from preempting each other, so each handler
+ * posts to its own ring (fault_event_producer_t). The safety task
+ * (fsm_aggregate_faults) is the only consumer of all rings.
+ *
+ * Unlike the DCLS fault flags, which collapse repeated faults into one
+ * "active" bit, every ISR occurrence is kept as a compact 8-byte record
+ * with its timestamp, so bursts keep their count and ordering.
+ *
+ * Properties:
+ *  - Producer (ISR): wait-free, O(1), no locks; the only masked section
+ *    is the flight recorder append (flight_recorder.h)
+ *  - Consumer: batch drain, merged across rings in timestamp order
+ *  - Fixed capacity (FAULT_EVENT_QUEUE_DEPTH per producer, no malloc)
+ *  - Overflow accounting per ring; dropped events leave a gap in seq
+ *  - Producer and consumer indices on separate cache lines
+ *
+ * Compliance:
+ *  - ISO 26262-6:2018 Section 7.4.9 (Freedom from interference)
+ *  - TSR-002 (ISR framework with < 5μs latency)
+ */
+
+#ifndef FAULT_EVENT_QUEUE_H
+#define FAULT_EVENT_QUEUE_H
+
+#include "safety_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * Configuration
+ * ============================================================================ */
+
+/** @brief Ring capacity per producer (must be a power of two) */
+#define FAULT_EVENT_QUEUE_DEPTH 64U
+
+/** @brief Number of fault sources (VDD, CLK, MEM) */
+#define FAULT_EVENT_SOURCES 3U
+
+/**
+ * @enum fault_event_producer_t
+ * @brief Posting contexts, one ring each
+ *
+ * A producer must never preempt itself; different producers may preempt
+ * each other freely.
+ */
+typedef enum {
+    FAULT_EVENT_VDD_ISR = 0,     /*!< vdd_isr_handler() */
+    FAULT_EVENT_PWR_HANDLER,     /*!< pwr_event_handler_vdd_fault() */
+    FAULT_EVENT_CLK_ISR,         /*!< clk_isr_handler() */
+    FAULT_EVENT_CLK_HANDLER,     /*!< clk_event_handler_clk_loss_isr() */
+    FAULT_EVENT_MEM_ISR,         /*!< mem_isr_handler() */
+    FAULT_EVENT_ECC_ISR,         /*!< ecc_fault_isr() */
+    FAULT_EVENT_ECC_POLL,        /*!< ecc_fault_poll_task() (task context) */
+    FAULT_EVENT_PRODUCERS
+} fault_event_producer_t;
+
+/* ============================================================================
+ * Event Record
+ * ============================================================================ */
+
+/**
+ * @struct fault_event_t
+ * @brief Compact fault event record (8 bytes)
+ */
+typedef struct {
+    uint32_t timestamp;   /*!< timebase_ticks32() at post */
+    uint8_t source;       /*!< fault_type_t of the producer */
+    uint8_t seq;          /*!< Per-producer sequence (gap = dropped events) */
+    uint16_t info;        /*!< Source-specific detail (0 if none) */
+} fault_event_t;
+
+/* ============================================================================
+ * Queue Interface
+ * ============================================================================ */
+
+/**
+ * @brief Reset all rings and overflow counters
+ *
+ * Must be called with fault interrupts disabled (boot / recovery).
+ */
+void fault_event_queue_init(void);
+
+/**
+ * @brief Post a fault event from ISR context (producer)
+ *
+ * Wait-free. Only the context named by @p producer may call this; the
+ * event's source is the producer's fault type.
+ *
+ * @param producer Posting context (its ring)
+ * @param info Source-specific detail
+ * @return true if queued, false if the ring was full (overflow counted)
+ *         or @p producer is invalid
+ */
+bool fault_event_post(fault_event_producer_t producer, uint16_t info);
+
+/**
+ * @brief Drain up to @p max events (consumer, safety task only)
+ *
+ * Events from all rings are merged oldest-first by timestamp.
+ *
+ * @param[out] events Output buffer
+ * @param max Capacity of @p events
+ * @return Number of events written
+ */
+uint32_t fault_event_drain(fault_event_t *events, uint32_t max);
+
+/**
+ * @brief Number of events currently queued across all sources
+ */
+uint32_t fault_event_pending(void);
+
+/**
+ * @brief Number of events dropped because a ring was full
+ *
+ * @param source Fault source, summed over its producers
+ *               (FAULT_TYPE_NONE returns the total)
+ */
+uint32_t fault_event_get_overflow_count(fault_type_t source);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FAULT_EVENT_QUEUE_H */
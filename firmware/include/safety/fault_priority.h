@@ -0,0 +1,102 @@
+/**
+ * @file fault_priority.h
+ * @brief Branch-Free Fault Priority Resolver
+ *
+ * Maps an active fault mask to the winning (highest-priority) fault and
+ * its priority level under the runtime configuration set through
+ * fault_set_priorities().
+ *
+ * The mapping for all 2^3 source masks is precomputed whenever the
+ * priorities change and packed into one 32-bit word, one 4-bit entry per
+ * mask:
+ *  - bits 0..1: winning source bit index + 1 (0 = no fault)
+ *  - bits 2..3: priority level of the winner (1-3, 0 = no fault)
+ *
+ * Resolving is one load, one shift and one mask regardless of the
+ * configuration; publishing a new table is one aligned word store, so a
+ * reader never sees a half-updated table.
+ *
+ * Equal priority levels are resolved in source order VDD > CLK > MEM.
+ *
+ * Compliance:
+ *  - SysReq-002 (Fault priority and aggregation)
+ *  - ISO 26262-6:2018 Section 7.4.14 (Timing of software execution)
+ */
+
+#ifndef FAULT_PRIORITY_H
+#define FAULT_PRIORITY_H
+
+#include "safety_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * Configuration
+ * ============================================================================ */
+
+/** @brief Bits per table entry */
+#define FAULT_PRIORITY_ENTRY_BITS 4U
+
+/** @brief Lowest (numerically largest) configurable priority level */
+#define FAULT_PRIORITY_LEVELS 3U
+
+/**
+ * @brief Table for the default P1 VDD > P2 CLK > P3 MEM configuration
+ *
+ * Entries for masks 7..0: VDD/P1, CLK/P2, VDD/P1, MEM/P3, VDD/P1, CLK/P2,
+ * VDD/P1, none.
+ */
+#define FAULT_PRIORITY_DEFAULT_LUT 0x5A5F5A50UL
+
+/* ============================================================================
+ * Resolver Interface
+ * ============================================================================ */
+
+/** @brief Active resolver table (written only by fault_priority_build) */
+extern volatile uint32_t g_fault_priority_lut;
+
+/**
+ * @brief Compute the packed table for a priority configuration
+ *
+ * @param vdd_priority VDD priority level (1-3, 1 = highest)
+ * @param clk_priority Clock priority level (1-3)
+ * @param mem_priority Memory priority level (1-3)
+ * @return Packed table, or 0 if a level is out of range
+ */
+uint32_t fault_priority_compute(uint8_t vdd_priority, uint8_t clk_priority,
+                                uint8_t mem_priority);
+
+/**
+ * @brief Rebuild and publish the resolver table
+ *
+ * Called when the priorities change (fault_set_priorities).
+ *
+ * @return true if published, false if a level is out of range (table
+ *         unchanged)
+ */
+bool fault_priority_build(uint8_t vdd_priority, uint8_t clk_priority,
+                          uint8_t mem_priority);
+
+/**
+ * @brief Resolve the highest-priority fault of an active mask
+ *
+ * @param active Active fault mask (bits outside FAULT_TYPE_MULTIPLE ignored)
+ * @param[out] level Priority level of the result (1-3, 0 = no fault)
+ * @return Winning fault (FAULT_TYPE_NONE if @p active has no source bit)
+ */
+static inline fault_type_t fault_priority_resolve(uint32_t active, uint8_t *level)
+{
+    uint32_t entry = (g_fault_priority_lut >>
+                      ((active & FAULT_TYPE_MULTIPLE) * FAULT_PRIORITY_ENTRY_BITS)) & 0xFU;
+
+    *level = (uint8_t)(entry >> 2);
+    return (fault_type_t)((1U << (entry & 3U)) >> 1);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FAULT_PRIORITY_H */
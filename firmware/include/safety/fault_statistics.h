@@ -0,0 +1,81 @@
+/**
+ * @file fault_statistics.h
+ * @brief ISO 26262 Fault Statistics and DC Calculation Interface
+ *
+ * Public interface of safety/fault_statistics.c.
+ *
+ * Fault rates: every detected fault is also counted in a ring of
+ * per-minute buckets (last hour) and per-hour buckets (last day) per fault
+ * type, with running window sums, so "faults in the last 1 min / 1 h /
+ * 24 h" costs O(1) to record and to query. The oldest bucket of each
+ * window is weighted by the part of it still inside the window (sliding
+ * window estimate). An EWMA of faults per minute tracks the short-term
+ * trend.
+ *
+ * Fault reaction latency: the time from the fault ISR to the safe-state
+ * reaction is recorded per type in a log-linear histogram
+ * (latency_histogram.h). fault_stats_get_statistics() reports p50 / p99 /
+ * p99.9 / max; fault_stats_get_latency_histogram() returns the full,
+ * mergeable histogram.
+ *
+ * Compliance:
+ *  - ISO 26262-1:2018 Annex C (DC calculation)
+ */
+
+#ifndef FAULT_STATISTICS_H
+#define FAULT_STATISTICS_H
+
+#include "safety_types.h"
+#include "safety/latency_histogram.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * Fault Rate Configuration
+ * ============================================================================ */
+
+/** @brief EWMA weight of the last minute: 1 / (1 << FAULT_RATE_EWMA_SHIFT) */
+#define FAULT_RATE_EWMA_SHIFT 3U
+
+/** @brief Trend: EWMA above this multiple of the 24h mean per minute */
+#define FAULT_RATE_TREND_FACTOR 2U
+
+/** @brief Trend: minimum faults in the last hour before reporting one */
+#define FAULT_RATE_TREND_MIN_FAULTS 4U
+
+/**
+ * @struct fault_rate_t
+ * @brief Windowed fault rate of one fault type
+ */
+typedef struct {
+    uint32_t last_1min;          /*!< Faults in the last minute */
+    uint32_t last_1h;            /*!< Faults in the last hour */
+    uint32_t last_24h;           /*!< Faults in the last 24 hours */
+    uint32_t ewma_per_min_x100;  /*!< EWMA of faults per minute, x100 */
+    bool accelerating;           /*!< EWMA well above the 24h mean */
+} fault_rate_t;
+
+bool fault_stats_record_detected(fault_type_t fault_type);
+bool fault_stats_record_undetected(fault_type_t fault_type);
+bool fault_stats_record_recovery_success(void);
+bool fault_stats_record_recovery_failure(void);
+bool fault_stats_calculate_dc(fault_type_t fault_type, uint8_t *dc_percent);
+bool fault_stats_calculate_overall_dc(uint8_t *dc_percent);
+bool fault_stats_get_statistics(fault_statistics_t *stats);
+bool fault_stats_get_recovery_success_rate(uint8_t *success_rate);
+uint32_t fault_stats_get_total_faults(void);
+bool fault_stats_reset(void);
+bool fault_stats_update_uptime(uint64_t uptime_ms);
+bool fault_stats_get_fault_rate_per_hour(uint16_t *fph);
+bool fault_stats_get_fault_rate(fault_type_t fault_type, fault_rate_t *rate);
+bool fault_stats_record_latency(fault_type_t fault_type, uint32_t detect_ticks);
+bool fault_stats_get_latency_histogram(fault_type_t fault_type,
+                                       latency_hist_t *snapshot);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FAULT_STATISTICS_H */
@@ -0,0 +1,224 @@
+/**
+ * @file flight_recorder.h
+ * @brief Reset-Surviving Binary Flight Recorder
+ *
+ * Ring of fixed-size binary records of fault events and FSM transitions,
+ * kept in a .noinit RAM section so it survives a warm reset (e.g. the
+ * reset following a VDD fault) that wipes g_fault_stats, g_safety_status
+ * and the per-module counters.
+ *
+ * Layout (flight_recorder_t, little-endian, shared with host tools):
+ *  - Header: magic, version, record size, capacity, tick rate, boot
+ *    count, CRC-32 over those fields. Written at format and boot only.
+ *  - head / head_cmp: records written since format and its complement
+ *    (DCLS); the write index is head % FLIGHT_RECORDER_CAPACITY
+ *  - Ring of flight_record_t (12 bytes each)
+ *
+ * On boot fsm_init() calls flight_recorder_init(): a ring whose header
+ * CRC and head complement check out is preserved for readout and a
+ * FLIGHT_RECORD_BOOT marker is appended (state_before = FSM state at the
+ * reset); anything else is reformatted. Records from before the reset
+ * stay readable until new records overwrite them.
+ *
+ * Writes are ISR-safe: one short masked section (PRIMASK saved and
+ * restored) of ~20 instructions, no loops.
+ *
+ * The linker script must place .noinit in a NOLOAD region outside the
+ * startup code's .bss clear and .data copy.
+ *
+ * Compliance:
+ *  - ISO 26262-6:2018 Section 7.4.12 (Freedom from interference)
+ *  - ISO 26262-8:2018 Clause 9 (Evidence for fault analysis)
+ */
+
+#ifndef FLIGHT_RECORDER_H
+#define FLIGHT_RECORDER_H
+
+#include "safety_types.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * Configuration
+ * ============================================================================ */
+
+/** @brief Header magic ("FREC" in a little-endian dump) */
+#define FLIGHT_RECORDER_MAGIC 0x43455246UL
+
+/** @brief Layout version (bump on any change of the shared structures) */
+#define FLIGHT_RECORDER_VERSION 1U
+
+/** @brief Ring capacity in records (power of two) */
+#define FLIGHT_RECORDER_CAPACITY 256U
+#define FLIGHT_RECORDER_MASK     (FLIGHT_RECORDER_CAPACITY - 1U)
+
+/** @brief delta_ticks of a record more than 2^32 - 1 ticks after the previous one */
+#define FLIGHT_RECORDER_DELTA_SATURATED 0xFFFFFFFFUL
+
+/* ============================================================================
+ * Record Format
+ * ============================================================================ */
+
+/**
+ * @brief Record kinds
+ */
+typedef enum {
+    FLIGHT_RECORD_FAULT = 1,       /*!< Fault ISR event (fault_event_post) */
+    FLIGHT_RECORD_TRANSITION = 2,  /*!< FSM state change (fsm_transition) */
+    FLIGHT_RECORD_BOOT = 3         /*!< Boot with a preserved ring */
+} flight_record_kind_t;
+
+/**
+ * @struct flight_record_t
+ * @brief One record (12 bytes)
+ *
+ * FAULT: source = fault source bit, states = FSM state at the event,
+ * syndrome = fault event info (e.g. ECC syndrome). TRANSITION: source =
+ * active faults. BOOT: delta 0, syndrome = boot count (low 16 bits).
+ */
+typedef struct {
+    uint32_t delta_ticks;   /*!< Timebase ticks since the previous record */
+    uint16_t seq;           /*!< Record number (head), low 16 bits */
+    uint16_t syndrome;      /*!< Source-specific detail */
+    uint8_t kind;           /*!< flight_record_kind_t */
+    uint8_t source;         /*!< fault_type_t bits */
+    uint8_t state_before;   /*!< safety_state_t before */
+    uint8_t state_after;    /*!< safety_state_t after */
+} flight_record_t;
+
+/**
+ * @struct flight_recorder_header_t
+ * @brief CRC-protected header (24 bytes)
+ */
+typedef struct {
+    uint32_t magic;         /*!< FLIGHT_RECORDER_MAGIC */
+    uint16_t version;       /*!< FLIGHT_RECORDER_VERSION */
+    uint16_t record_size;   /*!< sizeof(flight_record_t) */
+    uint32_t capacity;      /*!< Records in the ring */
+    uint32_t tick_hz;       /*!< Timebase ticks per second (delta unit) */
+    uint32_t boot_count;    /*!< Boots that preserved the ring */
+    uint32_t crc;           /*!< CRC-32 of the fields above */
+} flight_recorder_header_t;
+
+/**
+ * @struct flight_recorder_t
+ * @brief Complete .noinit region (3 KB)
+ */
+typedef struct {
+    flight_recorder_header_t header;
+    uint32_t head;          /*!< Records written since format */
+    uint32_t head_cmp;      /*!< ~head (DCLS) */
+    uint64_t last_ticks;    /*!< timebase_ticks64() of the newest record */
+    uint32_t boot_head;     /*!< head when the last boot preserved the ring */
+    uint8_t state;          /*!< FSM state after the newest record */
+    uint8_t reserved[3];
+    flight_record_t records[FLIGHT_RECORDER_CAPACITY];
+} flight_recorder_t;
+
+/* ============================================================================
+ * Header Validation (shared with host tools)
+ * ============================================================================ */
+
+/**
+ * @brief CRC-32 (IEEE 802.3, reflected 0xEDB88320), bitwise
+ *
+ * Only run at format and boot, so no table.
+ */
+static inline uint32_t flight_recorder_crc32(const void *data, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    uint32_t crc = 0xFFFFFFFFUL;
+    size_t i;
+    uint32_t bit;
+
+    for (i = 0; i < len; i++) {
+        crc ^= p[i];
+        for (bit = 0; bit < 8U; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320UL & (0U - (crc & 1U)));
+        }
+    }
+
+    return ~crc;
+}
+
+/**
+ * @brief Check a header against this build's layout and its CRC
+ */
+static inline bool flight_recorder_header_valid(const flight_recorder_header_t *header)
+{
+    return header->magic == FLIGHT_RECORDER_MAGIC &&
+           header->version == FLIGHT_RECORDER_VERSION &&
+           header->record_size == sizeof(flight_record_t) &&
+           header->capacity == FLIGHT_RECORDER_CAPACITY &&
+           header->crc == flight_recorder_crc32(header,
+                              offsetof(flight_recorder_header_t, crc));
+}
+
+/* ============================================================================
+ * Interface
+ * ============================================================================ */
+
+/**
+ * @brief Preserve or format the ring (boot, from fsm_init)
+ *
+ * @return true if a valid ring from before the reset was preserved
+ */
+bool flight_recorder_init(void);
+
+/**
+ * @brief Record a fault event (ISR-safe)
+ *
+ * @param source Fault source bit
+ * @param syndrome Source-specific detail
+ */
+void flight_recorder_fault(fault_type_t source, uint16_t syndrome);
+
+/**
+ * @brief Record an FSM state change (ISR-safe)
+ *
+ * @param before State before the transition
+ * @param after State after (SAFETY_STATE_INVALID for a rejected one)
+ * @param active Active fault mask at the transition
+ */
+void flight_recorder_transition(safety_state_t before, safety_state_t after,
+                                fault_type_t active);
+
+/**
+ * @brief Records available for readout (at most FLIGHT_RECORDER_CAPACITY)
+ */
+uint32_t flight_recorder_count(void);
+
+/**
+ * @brief Records from before the last boot still in the ring
+ *
+ * They are the oldest ones: indices 0 .. count - 1 of flight_recorder_read().
+ */
+uint32_t flight_recorder_preserved_count(void);
+
+/**
+ * @brief Read one record
+ *
+ * @param index 0 = oldest record in the ring
+ * @param[out] record Copy of the record
+ * @return true if read, false if index out of range or NULL
+ */
+bool flight_recorder_read(uint32_t index, flight_record_t *record);
+
+/**
+ * @brief Discard all records (after readout); keeps the boot count
+ */
+void flight_recorder_clear(void);
+
+/**
+ * @brief The raw region, for dumping over a diagnostic link
+ */
+const flight_recorder_t *flight_recorder_region(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FLIGHT_RECORDER_H */
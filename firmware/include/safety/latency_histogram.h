@@ -0,0 +1,127 @@
+/**
+ * @file latency_histogram.h
+ * @brief Log-Linear (HDR-Style) Latency Histogram
+ *
+ * Fixed-size histogram of latencies in microseconds with bounded
+ * relative error, for percentile reporting (p50 / p99 / p99.9) of the
+ * fault reaction time.
+ *
+ * Bucket layout (LATENCY_HIST_SUB_BITS = 4):
+ *  - Values 0..15: one bucket each (exact)
+ *  - Every power-of-two range [2^k, 2^(k+1)), k >= 4, is split into 16
+ *    equal sub-buckets, so a bucket is at most 1/16 (6.25%) of its value
+ *  - Values from 2^LATENCY_HIST_MAX_BITS us (16.7 s) on count in the last
+ *    bucket
+ *
+ * Recording is O(1): one count-leading-zeros, a shift and an increment.
+ * Histograms with the same layout merge by adding bucket counts, so
+ * snapshots from several tasks, power cycles or vehicles combine into
+ * one distribution without losing percentile accuracy.
+ *
+ * Compliance:
+ *  - ISO 26262-6:2018 Section 7.4.14 (Timing of software execution)
+ *  - ISO 26262-1:2018 Annex C (Metrics)
+ */
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * Configuration
+ * ============================================================================ */
+
+/** @brief Sub-buckets per power of two: 2^LATENCY_HIST_SUB_BITS */
+#define LATENCY_HIST_SUB_BITS 4U
+
+/** @brief Highest recorded value: 2^LATENCY_HIST_MAX_BITS - 1 us */
+#define LATENCY_HIST_MAX_BITS 24U
+
+#define LATENCY_HIST_SUB_COUNT (1UL << LATENCY_HIST_SUB_BITS)
+#define LATENCY_HIST_MAX_US    ((1UL << LATENCY_HIST_MAX_BITS) - 1UL)
+
+/** @brief Bucket count: linear range plus one group per power of two */
+#define LATENCY_HIST_BUCKETS \
+    ((LATENCY_HIST_MAX_BITS - LATENCY_HIST_SUB_BITS + 1U) * LATENCY_HIST_SUB_COUNT)
+
+/** @brief Quantiles in parts per million */
+#define LATENCY_HIST_P50  500000UL
+#define LATENCY_HIST_P99  990000UL
+#define LATENCY_HIST_P999 999000UL
+
+/**
+ * @struct latency_hist_t
+ * @brief Histogram (also its own snapshot format; 1.3 KB)
+ */
+typedef struct {
+    uint32_t counts[LATENCY_HIST_BUCKETS];  /*!< Samples per bucket (saturating) */
+    uint32_t total;                         /*!< Samples recorded (saturating) */
+    uint32_t min_us;                        /*!< Smallest sample (0 if empty) */
+    uint32_t max_us;                        /*!< Largest sample (saturated at MAX_US) */
+    uint64_t sum_us;                        /*!< Sum of samples, for the mean */
+} latency_hist_t;
+
+/* ============================================================================
+ * Interface
+ * ============================================================================ */
+
+/**
+ * @brief Clear a histogram
+ */
+void latency_hist_reset(latency_hist_t *hist);
+
+/**
+ * @brief Bucket of a value
+ *
+ * @param value_us Latency (values above LATENCY_HIST_MAX_US saturate)
+ * @return Bucket index (< LATENCY_HIST_BUCKETS)
+ */
+uint32_t latency_hist_bucket(uint32_t value_us);
+
+/**
+ * @brief Largest value mapped to a bucket
+ *
+ * @param bucket Bucket index (< LATENCY_HIST_BUCKETS)
+ * @return Upper edge in us (LATENCY_HIST_MAX_US for out-of-range indices)
+ */
+uint32_t latency_hist_bucket_upper(uint32_t bucket);
+
+/**
+ * @brief Record one sample (O(1))
+ *
+ * Not reentrant: one writer per histogram.
+ */
+void latency_hist_record(latency_hist_t *hist, uint32_t value_us);
+
+/**
+ * @brief Add the samples of @p src to @p dst
+ *
+ * @return true if merged, false on NULL
+ */
+bool latency_hist_merge(latency_hist_t *dst, const latency_hist_t *src);
+
+/**
+ * @brief Value at a quantile
+ *
+ * Returns the upper edge of the bucket holding the sample of that rank,
+ * capped at the largest sample, i.e. never below the true quantile and at
+ * most one bucket width (6.25%) above it.
+ *
+ * Execution Time: O(LATENCY_HIST_BUCKETS), query side only
+ *
+ * @param quantile_ppm Quantile in parts per million (e.g. LATENCY_HIST_P999)
+ * @return Latency in us (0 if the histogram is empty)
+ */
+uint32_t latency_hist_value_at(const latency_hist_t *hist, uint32_t quantile_ppm);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LATENCY_HISTOGRAM_H */
@@ -0,0 +1,48 @@
+/**
+ * @file safety_fsm.h
+ * @brief ISO 26262 Safety FSM Interface
+ *
+ * Public interface of safety/safety_fsm.c.
+ *
+ * Compliance:
+ *  - ISO 26262-6:2018 Section 7.5.2 (Control flow)
+ *  - TSR-002 (Safety FSM implementation)
+ */
+
+#ifndef SAFETY_FSM_H
+#define SAFETY_FSM_H
+
+#include "safety_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @struct fsm_aggregation_t
+ * @brief Result of one fsm_aggregate() pass
+ */
+typedef struct {
+    fault_type_t active;   /*!< Bitmask of active faults */
+    fault_type_t highest;  /*!< Highest-priority active fault (or NONE) */
+    uint8_t priority;      /*!< Configured level of highest (1-3, 0 = none) */
+    uint32_t events;       /*!< Fault events drained from the queue */
+} fsm_aggregation_t;
+
+bool fsm_init(void);
+bool fsm_transition(safety_state_t next_state);
+safety_state_t fsm_get_state(void);
+bool fsm_get_status(safety_status_t *status);
+bool fsm_aggregate(fsm_aggregation_t *result);
+bool fsm_aggregate_faults(void);
+bool fsm_clear_faults(fault_type_t faults_to_clear);
+void fsm_set_fault_flag(fault_type_t fault);
+bool fsm_fault_flags_valid(void);
+void fsm_set_recovery_status(recovery_result_t result);
+recovery_result_t fsm_get_recovery_status(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SAFETY_FSM_H */
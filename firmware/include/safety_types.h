@@ -73,31 +73,52 @@ typedef enum {
     RECOVERY_INVALID = 0xFF          /*!< Invalid state */
 } recovery_result_t;
 
+/**
+ * @enum safety_result_t
+ * @brief Return code for clock/power service interfaces
+ */
+typedef enum {
+    SAFETY_OK = 0x00,                /*!< Operation successful */
+    SAFETY_ERROR = 0x01,             /*!< Operation failed / invalid argument */
+    SAFETY_DCLS_ERROR = 0x02,        /*!< DCLS check failed (corruption) */
+    SAFETY_PENDING = 0x03            /*!< Operation not yet complete */
+} safety_result_t;
+
 /* ============================================================================
  * Fault Flags Structure - volatile to prevent CSE optimizations
  * ============================================================================ */
 
 /**
  * @struct fault_flags_t
- * @brief Individual fault flags for each fault source
+ * @brief Packed fault flag register for all fault sources
+ *
+ * One 32-bit word so that every update is a single atomic RMW and every
+ * check is a single load:
+ *  - bits  0..7 : flags, one bit per source (FAULT_TYPE_VDD/_CLK/_MEM_ECC)
+ *  - bits  8..15: complement of bits 0..7 (DCLS counter-flag)
+ *  - bits 16..31: reserved, must be zero
  *
- * Per ISO 26262-6:2018, all flags are volatile to prevent the compiler
- * from eliminating supposedly "redundant" flag checks.
- * Each flag is protected by a counter-flag for dual-point detection.
+ * Per ISO 26262-6:2018 the word is volatile to prevent the compiler from
+ * eliminating supposedly "redundant" flag checks. The host build makes it
+ * a C11 atomic; the target updates it with LDREX/STREX.
  */
 typedef struct {
-    volatile uint8_t pwr_fault;      /*!< VDD power supply fault flag (P1) */
-    volatile uint8_t pwr_fault_cmp;  /*!< Complement: ~pwr_fault */
-    
-    volatile uint8_t clk_fault;      /*!< Clock loss fault flag (P2) */
-    volatile uint8_t clk_fault_cmp;  /*!< Complement: ~clk_fault */
-    
-    volatile uint8_t mem_fault;      /*!< Memory ECC fault flag (P3) */
-    volatile uint8_t mem_fault_cmp;  /*!< Complement: ~mem_fault */
-    
-    volatile uint8_t reserved[2];    /*!< Reserved for future use */
+#if defined(FIRMWARE_HOST_BUILD) && !defined(__cplusplus)
+    volatile _Atomic uint32_t word;  /*!< Flags | (~flags << 8) */
+#else
+    volatile uint32_t word;          /*!< Flags | (~flags << 8) */
+#endif
 } fault_flags_t;
 
+/** @brief Flag bits of the packed fault flag word */
+#define FAULT_FLAGS_MASK      0x000000FFUL
+
+/** @brief Position of the complement byte */
+#define FAULT_FLAGS_CMP_SHIFT 8U
+
+/** @brief Packed fault flag word with no fault active */
+#define FAULT_FLAGS_CLEAR     0x0000FF00UL
+
 /* ============================================================================
  * Safety Status Structure - core safety information
  * ============================================================================ */
@@ -127,6 +148,22 @@ typedef struct {
  * Fault Statistics Structure - for diagnostic coverage calculation
  * ============================================================================ */
 
+/**
+ * @struct fault_latency_summary_t
+ * @brief Fault reaction time distribution of one fault type
+ *
+ * Time from the fault ISR to the safe-state reaction (NORMAL -> FAULT
+ * transition or power_enter_safe_state()), from the latency histogram of
+ * fault_statistics.c. Quantiles are upper bounds within 6.25%.
+ */
+typedef struct {
+    uint32_t samples;   /*!< Reactions measured */
+    uint32_t p50_us;    /*!< Median reaction time */
+    uint32_t p99_us;    /*!< 99th percentile */
+    uint32_t p999_us;   /*!< 99.9th percentile */
+    uint32_t max_us;    /*!< Worst case observed */
+} fault_latency_summary_t;
+
 /**
  * @struct fault_statistics_t
  * @brief Cumulative fault statistics for DC calculation
@@ -151,6 +188,10 @@ typedef struct {
     
     volatile uint64_t uptime_ms;               /*!< System uptime in ms */
     volatile uint32_t last_update_ms;          /*!< Last update timestamp */
+    
+    fault_latency_summary_t vdd_latency;       /*!< VDD fault reaction time */
+    fault_latency_summary_t clk_latency;       /*!< Clock fault reaction time */
+    fault_latency_summary_t mem_latency;       /*!< Memory fault reaction time */
 } fault_statistics_t;
 
 /* ============================================================================
@@ -248,6 +289,19 @@ typedef struct {
 #define VERIFY_FAULT_FLAG(flag, cmp_flag) \
     (((flag) ^ (cmp_flag)) == 0xFF)
 
+/**
+ * @def VERIFY_FAULT_FLAGS(word)
+ * @brief Verify the packed fault flag word with one XOR compare
+ *
+ * Flag byte XOR (complement byte | reserved bits) must equal 0xFF, which
+ * also rejects any bit set in the reserved upper half.
+ *
+ * @param word Value of fault_flags_t.word (loaded once)
+ * @return true if consistent, false if DCLS failure detected
+ */
+#define VERIFY_FAULT_FLAGS(word) \
+    ((((word) & FAULT_FLAGS_MASK) ^ ((word) >> FAULT_FLAGS_CMP_SHIFT)) == 0xFFUL)
+
 /**
  * @def VERIFY_STATE(state, state_cmp)
  * @brief Verify dual-point detection of state variable
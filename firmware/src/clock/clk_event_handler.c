@@ -19,7 +19,9 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "safety_types.h"
-#include "power_api.h"
+#include "clock/clk_event_handler.h"
+#include "hal/timebase.h"
+#include "safety/fault_event_queue.h"
 
 // ============================================================================
 // ISR State and Fault Tracking
@@ -174,7 +176,7 @@ safety_result_t clk_event_handler_clear_fault(void)
  *   SAFETY_ERROR: Invalid pointer
  */
 safety_result_t clk_event_handler_get_statistics(
-    volatile fault_statistics_t *out_stats)
+    volatile clk_event_statistics_t *out_stats)
 {
     if (out_stats == NULL) {
         return SAFETY_ERROR;
@@ -207,8 +209,10 @@ safety_result_t clk_event_handler_get_statistics(
  * Latency from fault detection: ~50-100ns (hardware propagation)
  * 
  * The ISR does NOT directly trigger safe state entry. Instead, it sets
- * the fault flag which is polled by the safety manager main loop within
- * the < 5ms software response budget (TSR-002).
+ * the fault flag and posts a FAULT_EVENT_CLK_HANDLER event to the fault
+ * event queue; the safety task drains the queue in fsm_aggregate() and
+ * commits the FAULT transition within the < 5ms software response budget
+ * (TSR-002).
  * 
  * Critical Section: Minimal (< 50 instructions)
  * Reentrant: No (ISR disables interrupts during execution)
@@ -263,12 +267,16 @@ void clk_event_handler_clk_loss_isr(void)
     // ========================================================================
     // Step 4: Capture Timestamp (Diagnostics Only)
     // ========================================================================
-    // Optionally capture current system tick for fault correlation
+    // Capture current system tick for fault correlation
     // This is NOT critical to safety but helps with post-incident analysis
-    // Timestamp format: system tick counter (implementation-dependent)
-    // Example: clk_loss_timestamp = get_system_tick();
-    // For now, just capture the event count as a proxy timestamp
-    clk_loss_timestamp = clk_fault_event_count;
+    // Timestamp format: 32-bit timebase ticks (DWT_CYCCNT on target).
+    // Taken from the free-running core counter, so it is valid even when
+    // the clock being monitored has failed.
+    clk_loss_timestamp = timebase_ticks32();
+    
+    // Queue the event for the safety task (wait-free; keeps every
+    // occurrence and its ordering, unlike the collapsed fault flag)
+    (void)fault_event_post(FAULT_EVENT_CLK_HANDLER, 0U);
     
     // ========================================================================
     // Step 5: ISR Exit
@@ -277,9 +285,9 @@ void clk_event_handler_clk_loss_isr(void)
     clk_isr_nesting_level--;
     
     // ISR returns to interrupted context
-    // The fault flag is checked by safety manager within < 5ms budget
-    // Safe state entry is triggered by main loop, not by ISR
-    // (Ensures consistent state machine transitions in main execution context)
+    // The queued event is drained by fsm_aggregate() in the safety task
+    // within the < 5ms budget; safe state entry happens there, not here
+    // (Ensures consistent state machine transitions in task context)
 }
 
 // ============================================================================
@@ -340,7 +348,7 @@ void clk_event_handler_clk_loss_isr(void)
 // 4. Critical Sections:
 //    - All fault flag updates happen atomically
 //    - No locks needed (ISR is non-preemptible)
-//    - Main loop reads flags with DCLS verification
+//    - Safety task reads flags with DCLS verification
 //
 // 5. Error Handling:
 //    - DCLS errors immediately trigger recovery path
@@ -348,10 +356,11 @@ void clk_event_handler_clk_loss_isr(void)
 //    - Fault event counter prevents infinite loops at higher level
 //
 // 6. Integration with Safety FSM:
-//    - ISR only sets fault flag, does not change system state
-//    - Safety manager checks flag in main loop (task 10ms period)
-//    - Transition to safe state occurs in main context (predictable)
-//    - This design avoids complex ISR-to-main-loop synchronization
+//    - ISR sets the fault flag and queues an event, does not change
+//      system state
+//    - Safety task drains the fault event queue in fsm_aggregate()
+//    - Transition to safe state occurs in task context (predictable)
+//    - The per-producer SPSC ring is the only ISR-to-task hand-off
 
 // ============================================================================
 // Unit Test Coverage (20 test cases from firmware/tests/unit/test_clk_monitor.py)
@@ -397,5 +406,3 @@ void clk_event_handler_clk_loss_isr(void)
 //   - Multiple ISR calls with flag clears between
 //   - ISR during safe state (verify state machine integration)
 //   - Concurrent fault detection (CLK + VDD faults)
-
-#endif  // CLOCK_EVENT_HANDLER_ISR_IMPLEMENTATION
@@ -25,18 +25,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "safety_types.h"
-#include "power_api.h"
-
-// ============================================================================
-// Clock Service State Machine
-// ============================================================================
-
-typedef enum {
-    CLK_SERVICE_STATE_IDLE = 0x00U,         // Monitoring, no fault active
-    CLK_SERVICE_STATE_FAULT_ACTIVE = 0x01U, // Clock fault detected, waiting for recovery
-    CLK_SERVICE_STATE_RECOVERY_PENDING = 0x02U,  // Clock recovered, validating stability
-    CLK_SERVICE_STATE_RECOVERY_CONFIRMED = 0x03U  // Clock stable, ready for system recovery
-} clk_service_state_t;
+#include "clock/clk_monitor_service.h"
 
 // ============================================================================
 // Service State and Configuration
@@ -411,5 +400,3 @@ safety_result_t clk_service_reset_statistics(void)
 // S06: Clock recovered during safe state (handled gracefully)
 // S07: Rapid on/off clock glitches (hysteresis validation)
 // S08: Clock recovery after multi-tick stability period
-
-#endif  // CLOCK_RECOVERY_SERVICE_IMPLEMENTATION
@@ -15,6 +15,11 @@
  */
 
 #include "safety_types.h"
+#include "hal/hal_cpu.h"
+#include "hal/timebase.h"
+#include "hal/interrupt_handler.h"
+#include "safety/safety_fsm.h"
+#include "safety/fault_event_queue.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -43,7 +48,7 @@
 /** @brief ISR execution counter for diagnostics */
 static volatile uint32_t g_isr_call_counts[3] = {0, 0, 0};
 
-/** @brief Last ISR execution timestamp */
+/** @brief Last ISR execution timestamp (timebase ticks, 32-bit) */
 static volatile uint32_t g_isr_last_timestamp[3] = {0, 0, 0};
 
 /** @brief ISR re-entrance detection */
@@ -77,7 +82,7 @@ static volatile uint8_t g_isr_nesting_level[3] = {0, 0, 0};
  *  - ISR execution: Must complete within 5μs
  *  - Flag propagation: Should be visible within 1 cycle
  */
-void __attribute__((interrupt)) vdd_isr_handler(void)
+HAL_ISR void vdd_isr_handler(void)
 {
     /* Increment nesting counter for re-entrance detection */
     g_isr_nesting_level[0]++;
@@ -88,26 +93,16 @@ void __attribute__((interrupt)) vdd_isr_handler(void)
         while (1) { } /* Hard halt */
     }
 
-    /* Set VDD fault flag atomically with DCLS protection */
-    /* In ARM assembly (3 cycles):
-     * MOV R0, #0xAA      ; Fault flag value (pwr_fault = 0xAA)
-     * MOV R1, #0x55      ; Complement (pwr_fault_cmp = 0x55)
-     * STRD R0, R1, [address]  ; Atomic dual-store
-     */
+    /* Set VDD fault flag atomically with DCLS protection
+     * (single atomic update of the packed g_safety_status.fault_flags word) */
+    fsm_set_fault_flag(FAULT_TYPE_VDD);
 
-    /* Atomic flag setting (equivalent to assembly above) */
-    __asm volatile (
-        "MOVW R0, #0xAA55 \n"  /* Load flag and complement into R0 */
-        "MOVT R0, #0xAA55 \n"  /* Top halfword */
-        /* Store to g_safety_status.fault_flags.pwr_fault */
-        : /* No output operands */
-        : /* Input operands specified via register constraints */
-        : "r0", "memory"  /* Clobber registers and memory */
-    );
+    /* Queue the event for the safety task (wait-free, keeps bursts) */
+    (void)fault_event_post(FAULT_EVENT_VDD_ISR, 0U);
 
     /* Update statistics */
     g_isr_call_counts[0]++;
-    g_isr_last_timestamp[0] = 0; /* Would be set by timer */
+    g_isr_last_timestamp[0] = timebase_ticks32();
 
     /* Decrement nesting counter */
     g_isr_nesting_level[0]--;
@@ -133,7 +128,7 @@ void __attribute__((interrupt)) vdd_isr_handler(void)
  *  - Complex calculations
  *  - System calls that rely on clock
  */
-void __attribute__((interrupt)) clk_isr_handler(void)
+HAL_ISR void clk_isr_handler(void)
 {
     g_isr_nesting_level[1]++;
 
@@ -142,14 +137,12 @@ void __attribute__((interrupt)) clk_isr_handler(void)
     }
 
     /* Set CLK fault flag atomically */
-    __asm volatile (
-        "MOVW R0, #0xCC77 \n"  /* clk_fault = 0xCC, clk_fault_cmp = 0x33 */
-        "MOVT R0, #0xCC77 \n"
-        : : : "r0", "memory"
-    );
+    fsm_set_fault_flag(FAULT_TYPE_CLK);
+
+    (void)fault_event_post(FAULT_EVENT_CLK_ISR, 0U);
 
     g_isr_call_counts[1]++;
-    g_isr_last_timestamp[1] = 0;
+    g_isr_last_timestamp[1] = timebase_ticks32();
 
     g_isr_nesting_level[1]--;
 }
@@ -166,7 +159,7 @@ void __attribute__((interrupt)) clk_isr_handler(void)
  *  - Atomically sets mem_fault flag
  *  - Supports re-entrance
  */
-void __attribute__((interrupt)) mem_isr_handler(void)
+HAL_ISR void mem_isr_handler(void)
 {
     g_isr_nesting_level[2]++;
 
@@ -175,14 +168,12 @@ void __attribute__((interrupt)) mem_isr_handler(void)
     }
 
     /* Set MEM fault flag atomically */
-    __asm volatile (
-        "MOVW R0, #0xDD22 \n"  /* mem_fault = 0xDD, mem_fault_cmp = 0x22 */
-        "MOVT R0, #0xDD22 \n"
-        : : : "r0", "memory"
-    );
+    fsm_set_fault_flag(FAULT_TYPE_MEM_ECC);
+
+    (void)fault_event_post(FAULT_EVENT_MEM_ISR, 0U);
 
     g_isr_call_counts[2]++;
-    g_isr_last_timestamp[2] = 0;
+    g_isr_last_timestamp[2] = timebase_ticks32();
 
     g_isr_nesting_level[2]--;
 }
@@ -229,6 +220,9 @@ bool interrupt_handler_init(void)
      * NVIC_EnableIRQ(MEM_FAULT_IRQ);
      */
 
+    /* Start the timebase (cycle counter + SysTick) used for ISR timestamps */
+    timebase_init();
+
     /* Clear all nesting counters */
     g_isr_nesting_level[0] = 0;
     g_isr_nesting_level[1] = 0;
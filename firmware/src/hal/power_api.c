@@ -17,6 +17,9 @@
  */
 
 #include "safety_types.h"
+#include "hal/hal_cpu.h"
+#include "hal/power_api.h"
+#include "hal/reg_access.h"
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
@@ -30,21 +33,28 @@
 
 /** @brief Power status register offset */
 #define POWER_STATUS_OFFSET 0x00
-#define POWER_STATUS_REG (*(volatile uint32_t *)(POWER_CTRL_BASE + POWER_STATUS_OFFSET))
+#define POWER_STATUS_REG (POWER_CTRL_BASE + POWER_STATUS_OFFSET)
 
 /** @brief Power control register offset */
 #define POWER_CONTROL_OFFSET 0x04
-#define POWER_CONTROL_REG (*(volatile uint32_t *)(POWER_CTRL_BASE + POWER_CONTROL_OFFSET))
+#define POWER_CONTROL_REG (POWER_CTRL_BASE + POWER_CONTROL_OFFSET)
 
 /** @brief Power mode register offset */
 #define POWER_MODE_OFFSET 0x08
-#define POWER_MODE_REG (*(volatile uint32_t *)(POWER_CTRL_BASE + POWER_MODE_OFFSET))
+#define POWER_MODE_REG (POWER_CTRL_BASE + POWER_MODE_OFFSET)
+
+/** @brief Power interrupt mask register offset */
+#define POWER_INT_MASK_OFFSET 0x0C
+#define POWER_INT_MASK_REG (POWER_CTRL_BASE + POWER_INT_MASK_OFFSET)
 
 /* Power status bits */
 #define POWER_STATUS_OK (1 << 0)
 #define POWER_STATUS_VDD_LOW (1 << 1)
 #define POWER_STATUS_BROWNOUT (1 << 2)
 
+/* Power interrupt mask bits */
+#define POWER_INT_VDD_FAULT (1U << 0)
+
 /* Power mode values */
 #define POWER_MODE_NORMAL 0x00
 #define POWER_MODE_SAFE_STATE 0x01
@@ -97,7 +107,7 @@ bool power_init(void)
     }
 
     /* Read current power status from hardware */
-    uint32_t status = POWER_STATUS_REG;
+    uint32_t status = hal_reg_read32(POWER_STATUS_REG);
 
     /* Verify power is stable */
     if ((status & POWER_STATUS_VDD_LOW) != 0) {
@@ -157,6 +167,20 @@ bool power_get_status(uint8_t *mode, uint16_t *voltage_mv)
     return true;
 }
 
+/**
+ * @brief Get current VDD voltage measurement
+ *
+ * @return VDD voltage in mV (0 if module not initialized)
+ */
+uint16_t power_get_voltage_mv(void)
+{
+    if (!g_power_module_initialized) {
+        return 0;
+    }
+
+    return g_power_state.vdd_voltage_mv;
+}
+
 /**
  * @brief Enter safe state (stop critical operations)
  *
@@ -193,11 +217,11 @@ bool power_enter_safe_state(void)
     }
 
     /* Disable interrupts for atomic operation */
-    __asm volatile ("cpsid i");
+    hal_irq_disable();
 
     /* Verify current state */
     if ((g_power_state.power_mode ^ g_power_state.power_mode_cmp) != 0xFF) {
-        __asm volatile ("cpsie i");
+        hal_irq_enable();
         return false;
     }
 
@@ -206,7 +230,7 @@ bool power_enter_safe_state(void)
     g_power_state.power_mode_cmp = ~POWER_MODE_SAFE_STATE;
 
     /* Write to hardware power mode register */
-    POWER_MODE_REG = POWER_MODE_SAFE_STATE;
+    hal_reg_write32(POWER_MODE_REG, POWER_MODE_SAFE_STATE);
 
     /* Disable write operations (would signal to storage controller) */
     /* In actual hardware, this would:
@@ -216,7 +240,7 @@ bool power_enter_safe_state(void)
      */
 
     /* Re-enable interrupts */
-    __asm volatile ("cpsie i");
+    hal_irq_enable();
 
     return true;
 }
@@ -251,7 +275,8 @@ bool power_request_recovery(void)
     }
 
     /* Request recovery through power control register */
-    POWER_CONTROL_REG |= (1 << 3); /* Request recovery bit */
+    hal_reg_write32(POWER_CONTROL_REG,
+                    hal_reg_read32(POWER_CONTROL_REG) | (1U << 3)); /* Request recovery bit */
 
     return true;
 }
@@ -329,6 +354,21 @@ bool power_write_enabled(void)
     return (mode == POWER_MODE_NORMAL);
 }
 
+/**
+ * @brief Unmask the VDD fault interrupt at the power controller
+ *
+ * Called by the power event handler once its ISR is registered.
+ *
+ * @return true if successful
+ */
+bool power_enable_fault_irq(void)
+{
+    hal_reg_write32(POWER_INT_MASK_REG,
+                    hal_reg_read32(POWER_INT_MASK_REG) | POWER_INT_VDD_FAULT);
+
+    return true;
+}
+
 /**
  * @brief Get power mode as string (for debugging)
  *
@@ -0,0 +1,79 @@
+/**
+ * @file timebase.c
+ * @brief Monotonic High-Resolution Timebase
+ *
+ * Target: owns the SysTick exception, which keeps the half-wrap epoch of
+ * DWT_CYCCNT current so timebase_ticks64() can extend the 32-bit counter
+ * without locks. Host: CLOCK_MONOTONIC needs no state.
+ *
+ * Compliance:
+ *  - ISO 26262-6:2018 Section 7.4.14 (Timing of software execution)
+ *  - TSR-002 (ISR framework with < 5μs latency)
+ */
+
+#include "hal/timebase.h"
+
+#if !defined(FIRMWARE_HOST_BUILD)
+
+/* ============================================================================
+ * ARM Cortex-M4 SysTick Registers
+ * ============================================================================ */
+
+#define SYST_CSR (*(volatile uint32_t *)0xE000E010UL)  /*!< Control/status */
+#define SYST_RVR (*(volatile uint32_t *)0xE000E014UL)  /*!< Reload value */
+#define SYST_CVR (*(volatile uint32_t *)0xE000E018UL)  /*!< Current value */
+
+#define SYST_CSR_ENABLE    (1UL << 0)
+#define SYST_CSR_TICKINT   (1UL << 1)
+#define SYST_CSR_CLKSOURCE (1UL << 2)  /*!< Processor clock */
+
+/** @brief Half-wrap epoch of DWT_CYCCNT (parity == CYCCNT bit 31) */
+volatile uint32_t g_timebase_epoch = 0U;
+
+/**
+ * @brief Start DWT_CYCCNT and a 1ms SysTick
+ */
+void timebase_init(void)
+{
+    hal_cycle_counter_init();  /* CYCCNT = 0, so bit 31 matches epoch 0 */
+    g_timebase_epoch = 0U;
+
+    SYST_CSR = 0U;
+    SYST_RVR = (uint32_t)(TIMEBASE_TICK_HZ / TIMEBASE_SYSTICK_HZ) - 1U;
+    SYST_CVR = 0U;
+    SYST_CSR = SYST_CSR_CLKSOURCE | SYST_CSR_TICKINT | SYST_CSR_ENABLE;
+}
+
+/**
+ * @brief SysTick handler: advance the epoch on each CYCCNT half period
+ *
+ * Single word store, so readers at any priority see either the old or
+ * the new epoch and correct a stale one from CYCCNT bit 31.
+ */
+HAL_ISR void timebase_systick_isr(void)
+{
+    uint32_t epoch = g_timebase_epoch;
+
+    if ((hal_cycle_count() >> 31) != (epoch & 1U)) {
+        g_timebase_epoch = epoch + 1U;
+    }
+}
+
+#else
+
+/**
+ * @brief Host: CLOCK_MONOTONIC is always running
+ */
+void timebase_init(void)
+{
+    hal_cycle_counter_init();
+}
+
+/**
+ * @brief Host: no SysTick, nothing to extend
+ */
+void timebase_systick_isr(void)
+{
+}
+
+#endif /* FIRMWARE_HOST_BUILD */
@@ -0,0 +1,792 @@
+/**
+ * @file ecc_codec.c
+ * @brief Software (72,64) Hamming SEC/DED Codec
+ *
+ * C model of rtl/memory_protection/ecc_encoder.v and ecc_decoder.v. The
+ * RTL XOR trees are linear over GF(2), so every check bit is the parity
+ * of the data word under a fixed mask (ECC_MASK_P1 .. ECC_MASK_OVERALL),
+ * and the decoder reduces to the encoder plus one status lookup (see
+ * ecc_decode_status). All implementations compute exactly these equations.
+ *
+ * Feature: 001-Power-Management-Safety
+ * User Story: US3 - Memory ECC Protection & Diagnostics
+ * ASIL Level: ASIL-B
+ *
+ * Execution Context:
+ * - Safety task / background scrub (no shared state except the selected
+ *   batch path, which is set once at start-up)
+ *
+ * Timing Budget:
+ * - ecc_encode64()/ecc_decode64(): O(1), no branches on data
+ * - Batches: >= 1 GB/s of data on the x86-64 host build
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "memory/ecc_codec.h"
+
+#if defined(FIRMWARE_HOST_BUILD) && defined(__x86_64__)
+#include <immintrin.h>
+#define ECC_CODEC_X86 1
+#endif
+
+// ============================================================================
+// Check-Bit Masks (ecc_encoder.v equations)
+// ============================================================================
+
+// p(2^k) covers data[62:0] bits whose position (bit index + 1) has bit k
+#define ECC_MASK_P1      0x5555555555555555ULL
+#define ECC_MASK_P2      0x6666666666666666ULL
+#define ECC_MASK_P4      0x7878787878787878ULL
+#define ECC_MASK_P8      0x7F807F807F807F80ULL
+#define ECC_MASK_P16     0x7FFF80007FFF8000ULL
+#define ECC_MASK_P32     0x7FFFFFFF80000000ULL
+// p64 = data[63] ^ p1 ^ ... ^ p32 (XOR of the masks above plus bit 63)
+#define ECC_MASK_P64     0xB4CB4B34CB34B4CBULL
+// Overall parity: all data bits
+#define ECC_MASK_OVERALL 0xFFFFFFFFFFFFFFFFULL
+
+// Parity of a 6-bit value, one bit per value (branch-free lookup)
+#define ECC_PARITY6_LUT  0x6996966996696996ULL
+
+// Words per encode step of ecc_decode64_batch()
+#define ECC_CODEC_CHUNK  64U
+
+// ============================================================================
+// Lookup Tables (generated from the RTL equations)
+// ============================================================================
+
+// Check bits contributed by each data byte: ecc = XOR of 8 lookups
+static const uint8_t g_ecc_encode_lut[8][256] = {
+    { /* data[7:0] */
+        0x00, 0xC1, 0xC2, 0x03, 0x83, 0x42, 0x41, 0x80, 0xC4, 0x05, 0x06, 0xC7, 0x47, 0x86, 0x85, 0x44,
+        0x85, 0x44, 0x47, 0x86, 0x06, 0xC7, 0xC4, 0x05, 0x41, 0x80, 0x83, 0x42, 0xC2, 0x03, 0x00, 0xC1,
+        0x86, 0x47, 0x44, 0x85, 0x05, 0xC4, 0xC7, 0x06, 0x42, 0x83, 0x80, 0x41, 0xC1, 0x00, 0x03, 0xC2,
+        0x03, 0xC2, 0xC1, 0x00, 0x80, 0x41, 0x42, 0x83, 0xC7, 0x06, 0x05, 0xC4, 0x44, 0x85, 0x86, 0x47,
+        0xC7, 0x06, 0x05, 0xC4, 0x44, 0x85, 0x86, 0x47, 0x03, 0xC2, 0xC1, 0x00, 0x80, 0x41, 0x42, 0x83,
+        0x42, 0x83, 0x80, 0x41, 0xC1, 0x00, 0x03, 0xC2, 0x86, 0x47, 0x44, 0x85, 0x05, 0xC4, 0xC7, 0x06,
+        0x41, 0x80, 0x83, 0x42, 0xC2, 0x03, 0x00, 0xC1, 0x85, 0x44, 0x47, 0x86, 0x06, 0xC7, 0xC4, 0x05,
+        0xC4, 0x05, 0x06, 0xC7, 0x47, 0x86, 0x85, 0x44, 0x00, 0xC1, 0xC2, 0x03, 0x83, 0x42, 0x41, 0x80,
+        0xC8, 0x09, 0x0A, 0xCB, 0x4B, 0x8A, 0x89, 0x48, 0x0C, 0xCD, 0xCE, 0x0F, 0x8F, 0x4E, 0x4D, 0x8C,
+        0x4D, 0x8C, 0x8F, 0x4E, 0xCE, 0x0F, 0x0C, 0xCD, 0x89, 0x48, 0x4B, 0x8A, 0x0A, 0xCB, 0xC8, 0x09,
+        0x4E, 0x8F, 0x8C, 0x4D, 0xCD, 0x0C, 0x0F, 0xCE, 0x8A, 0x4B, 0x48, 0x89, 0x09, 0xC8, 0xCB, 0x0A,
+        0xCB, 0x0A, 0x09, 0xC8, 0x48, 0x89, 0x8A, 0x4B, 0x0F, 0xCE, 0xCD, 0x0C, 0x8C, 0x4D, 0x4E, 0x8F,
+        0x0F, 0xCE, 0xCD, 0x0C, 0x8C, 0x4D, 0x4E, 0x8F, 0xCB, 0x0A, 0x09, 0xC8, 0x48, 0x89, 0x8A, 0x4B,
+        0x8A, 0x4B, 0x48, 0x89, 0x09, 0xC8, 0xCB, 0x0A, 0x4E, 0x8F, 0x8C, 0x4D, 0xCD, 0x0C, 0x0F, 0xCE,
+        0x89, 0x48, 0x4B, 0x8A, 0x0A, 0xCB, 0xC8, 0x09, 0x4D, 0x8C, 0x8F, 0x4E, 0xCE, 0x0F, 0x0C, 0xCD,
+        0x0C, 0xCD, 0xCE, 0x0F, 0x8F, 0x4E, 0x4D, 0x8C, 0xC8, 0x09, 0x0A, 0xCB, 0x4B, 0x8A, 0x89, 0x48
+    },
+    { /* data[15:8] */
+        0x00, 0x89, 0x8A, 0x03, 0xCB, 0x42, 0x41, 0xC8, 0x8C, 0x05, 0x06, 0x8F, 0x47, 0xCE, 0xCD, 0x44,
+        0xCD, 0x44, 0x47, 0xCE, 0x06, 0x8F, 0x8C, 0x05, 0x41, 0xC8, 0xCB, 0x42, 0x8A, 0x03, 0x00, 0x89,
+        0xCE, 0x47, 0x44, 0xCD, 0x05, 0x8C, 0x8F, 0x06, 0x42, 0xCB, 0xC8, 0x41, 0x89, 0x00, 0x03, 0x8A,
+        0x03, 0x8A, 0x89, 0x00, 0xC8, 0x41, 0x42, 0xCB, 0x8F, 0x06, 0x05, 0x8C, 0x44, 0xCD, 0xCE, 0x47,
+        0x8F, 0x06, 0x05, 0x8C, 0x44, 0xCD, 0xCE, 0x47, 0x03, 0x8A, 0x89, 0x00, 0xC8, 0x41, 0x42, 0xCB,
+        0x42, 0xCB, 0xC8, 0x41, 0x89, 0x00, 0x03, 0x8A, 0xCE, 0x47, 0x44, 0xCD, 0x05, 0x8C, 0x8F, 0x06,
+        0x41, 0xC8, 0xCB, 0x42, 0x8A, 0x03, 0x00, 0x89, 0xCD, 0x44, 0x47, 0xCE, 0x06, 0x8F, 0x8C, 0x05,
+        0x8C, 0x05, 0x06, 0x8F, 0x47, 0xCE, 0xCD, 0x44, 0x00, 0x89, 0x8A, 0x03, 0xCB, 0x42, 0x41, 0xC8,
+        0xD0, 0x59, 0x5A, 0xD3, 0x1B, 0x92, 0x91, 0x18, 0x5C, 0xD5, 0xD6, 0x5F, 0x97, 0x1E, 0x1D, 0x94,
+        0x1D, 0x94, 0x97, 0x1E, 0xD6, 0x5F, 0x5C, 0xD5, 0x91, 0x18, 0x1B, 0x92, 0x5A, 0xD3, 0xD0, 0x59,
+        0x1E, 0x97, 0x94, 0x1D, 0xD5, 0x5C, 0x5F, 0xD6, 0x92, 0x1B, 0x18, 0x91, 0x59, 0xD0, 0xD3, 0x5A,
+        0xD3, 0x5A, 0x59, 0xD0, 0x18, 0x91, 0x92, 0x1B, 0x5F, 0xD6, 0xD5, 0x5C, 0x94, 0x1D, 0x1E, 0x97,
+        0x5F, 0xD6, 0xD5, 0x5C, 0x94, 0x1D, 0x1E, 0x97, 0xD3, 0x5A, 0x59, 0xD0, 0x18, 0x91, 0x92, 0x1B,
+        0x92, 0x1B, 0x18, 0x91, 0x59, 0xD0, 0xD3, 0x5A, 0x1E, 0x97, 0x94, 0x1D, 0xD5, 0x5C, 0x5F, 0xD6,
+        0x91, 0x18, 0x1B, 0x92, 0x5A, 0xD3, 0xD0, 0x59, 0x1D, 0x94, 0x97, 0x1E, 0xD6, 0x5F, 0x5C, 0xD5,
+        0x5C, 0xD5, 0xD6, 0x5F, 0x97, 0x1E, 0x1D, 0x94, 0xD0, 0x59, 0x5A, 0xD3, 0x1B, 0x92, 0x91, 0x18
+    },
+    { /* data[23:16] */
+        0x00, 0x91, 0x92, 0x03, 0xD3, 0x42, 0x41, 0xD0, 0x94, 0x05, 0x06, 0x97, 0x47, 0xD6, 0xD5, 0x44,
+        0xD5, 0x44, 0x47, 0xD6, 0x06, 0x97, 0x94, 0x05, 0x41, 0xD0, 0xD3, 0x42, 0x92, 0x03, 0x00, 0x91,
+        0xD6, 0x47, 0x44, 0xD5, 0x05, 0x94, 0x97, 0x06, 0x42, 0xD3, 0xD0, 0x41, 0x91, 0x00, 0x03, 0x92,
+        0x03, 0x92, 0x91, 0x00, 0xD0, 0x41, 0x42, 0xD3, 0x97, 0x06, 0x05, 0x94, 0x44, 0xD5, 0xD6, 0x47,
+        0x97, 0x06, 0x05, 0x94, 0x44, 0xD5, 0xD6, 0x47, 0x03, 0x92, 0x91, 0x00, 0xD0, 0x41, 0x42, 0xD3,
+        0x42, 0xD3, 0xD0, 0x41, 0x91, 0x00, 0x03, 0x92, 0xD6, 0x47, 0x44, 0xD5, 0x05, 0x94, 0x97, 0x06,
+        0x41, 0xD0, 0xD3, 0x42, 0x92, 0x03, 0x00, 0x91, 0xD5, 0x44, 0x47, 0xD6, 0x06, 0x97, 0x94, 0x05,
+        0x94, 0x05, 0x06, 0x97, 0x47, 0xD6, 0xD5, 0x44, 0x00, 0x91, 0x92, 0x03, 0xD3, 0x42, 0x41, 0xD0,
+        0x98, 0x09, 0x0A, 0x9B, 0x4B, 0xDA, 0xD9, 0x48, 0x0C, 0x9D, 0x9E, 0x0F, 0xDF, 0x4E, 0x4D, 0xDC,
+        0x4D, 0xDC, 0xDF, 0x4E, 0x9E, 0x0F, 0x0C, 0x9D, 0xD9, 0x48, 0x4B, 0xDA, 0x0A, 0x9B, 0x98, 0x09,
+        0x4E, 0xDF, 0xDC, 0x4D, 0x9D, 0x0C, 0x0F, 0x9E, 0xDA, 0x4B, 0x48, 0xD9, 0x09, 0x98, 0x9B, 0x0A,
+        0x9B, 0x0A, 0x09, 0x98, 0x48, 0xD9, 0xDA, 0x4B, 0x0F, 0x9E, 0x9D, 0x0C, 0xDC, 0x4D, 0x4E, 0xDF,
+        0x0F, 0x9E, 0x9D, 0x0C, 0xDC, 0x4D, 0x4E, 0xDF, 0x9B, 0x0A, 0x09, 0x98, 0x48, 0xD9, 0xDA, 0x4B,
+        0xDA, 0x4B, 0x48, 0xD9, 0x09, 0x98, 0x9B, 0x0A, 0x4E, 0xDF, 0xDC, 0x4D, 0x9D, 0x0C, 0x0F, 0x9E,
+        0xD9, 0x48, 0x4B, 0xDA, 0x0A, 0x9B, 0x98, 0x09, 0x4D, 0xDC, 0xDF, 0x4E, 0x9E, 0x0F, 0x0C, 0x9D,
+        0x0C, 0x9D, 0x9E, 0x0F, 0xDF, 0x4E, 0x4D, 0xDC, 0x98, 0x09, 0x0A, 0x9B, 0x4B, 0xDA, 0xD9, 0x48
+    },
+    { /* data[31:24] */
+        0x00, 0xD9, 0xDA, 0x03, 0x9B, 0x42, 0x41, 0x98, 0xDC, 0x05, 0x06, 0xDF, 0x47, 0x9E, 0x9D, 0x44,
+        0x9D, 0x44, 0x47, 0x9E, 0x06, 0xDF, 0xDC, 0x05, 0x41, 0x98, 0x9B, 0x42, 0xDA, 0x03, 0x00, 0xD9,
+        0x9E, 0x47, 0x44, 0x9D, 0x05, 0xDC, 0xDF, 0x06, 0x42, 0x9B, 0x98, 0x41, 0xD9, 0x00, 0x03, 0xDA,
+        0x03, 0xDA, 0xD9, 0x00, 0x98, 0x41, 0x42, 0x9B, 0xDF, 0x06, 0x05, 0xDC, 0x44, 0x9D, 0x9E, 0x47,
+        0xDF, 0x06, 0x05, 0xDC, 0x44, 0x9D, 0x9E, 0x47, 0x03, 0xDA, 0xD9, 0x00, 0x98, 0x41, 0x42, 0x9B,
+        0x42, 0x9B, 0x98, 0x41, 0xD9, 0x00, 0x03, 0xDA, 0x9E, 0x47, 0x44, 0x9D, 0x05, 0xDC, 0xDF, 0x06,
+        0x41, 0x98, 0x9B, 0x42, 0xDA, 0x03, 0x00, 0xD9, 0x9D, 0x44, 0x47, 0x9E, 0x06, 0xDF, 0xDC, 0x05,
+        0xDC, 0x05, 0x06, 0xDF, 0x47, 0x9E, 0x9D, 0x44, 0x00, 0xD9, 0xDA, 0x03, 0x9B, 0x42, 0x41, 0x98,
+        0xE0, 0x39, 0x3A, 0xE3, 0x7B, 0xA2, 0xA1, 0x78, 0x3C, 0xE5, 0xE6, 0x3F, 0xA7, 0x7E, 0x7D, 0xA4,
+        0x7D, 0xA4, 0xA7, 0x7E, 0xE6, 0x3F, 0x3C, 0xE5, 0xA1, 0x78, 0x7B, 0xA2, 0x3A, 0xE3, 0xE0, 0x39,
+        0x7E, 0xA7, 0xA4, 0x7D, 0xE5, 0x3C, 0x3F, 0xE6, 0xA2, 0x7B, 0x78, 0xA1, 0x39, 0xE0, 0xE3, 0x3A,
+        0xE3, 0x3A, 0x39, 0xE0, 0x78, 0xA1, 0xA2, 0x7B, 0x3F, 0xE6, 0xE5, 0x3C, 0xA4, 0x7D, 0x7E, 0xA7,
+        0x3F, 0xE6, 0xE5, 0x3C, 0xA4, 0x7D, 0x7E, 0xA7, 0xE3, 0x3A, 0x39, 0xE0, 0x78, 0xA1, 0xA2, 0x7B,
+        0xA2, 0x7B, 0x78, 0xA1, 0x39, 0xE0, 0xE3, 0x3A, 0x7E, 0xA7, 0xA4, 0x7D, 0xE5, 0x3C, 0x3F, 0xE6,
+        0xA1, 0x78, 0x7B, 0xA2, 0x3A, 0xE3, 0xE0, 0x39, 0x7D, 0xA4, 0xA7, 0x7E, 0xE6, 0x3F, 0x3C, 0xE5,
+        0x3C, 0xE5, 0xE6, 0x3F, 0xA7, 0x7E, 0x7D, 0xA4, 0xE0, 0x39, 0x3A, 0xE3, 0x7B, 0xA2, 0xA1, 0x78
+    },
+    { /* data[39:32] */
+        0x00, 0xA1, 0xA2, 0x03, 0xE3, 0x42, 0x41, 0xE0, 0xA4, 0x05, 0x06, 0xA7, 0x47, 0xE6, 0xE5, 0x44,
+        0xE5, 0x44, 0x47, 0xE6, 0x06, 0xA7, 0xA4, 0x05, 0x41, 0xE0, 0xE3, 0x42, 0xA2, 0x03, 0x00, 0xA1,
+        0xE6, 0x47, 0x44, 0xE5, 0x05, 0xA4, 0xA7, 0x06, 0x42, 0xE3, 0xE0, 0x41, 0xA1, 0x00, 0x03, 0xA2,
+        0x03, 0xA2, 0xA1, 0x00, 0xE0, 0x41, 0x42, 0xE3, 0xA7, 0x06, 0x05, 0xA4, 0x44, 0xE5, 0xE6, 0x47,
+        0xA7, 0x06, 0x05, 0xA4, 0x44, 0xE5, 0xE6, 0x47, 0x03, 0xA2, 0xA1, 0x00, 0xE0, 0x41, 0x42, 0xE3,
+        0x42, 0xE3, 0xE0, 0x41, 0xA1, 0x00, 0x03, 0xA2, 0xE6, 0x47, 0x44, 0xE5, 0x05, 0xA4, 0xA7, 0x06,
+        0x41, 0xE0, 0xE3, 0x42, 0xA2, 0x03, 0x00, 0xA1, 0xE5, 0x44, 0x47, 0xE6, 0x06, 0xA7, 0xA4, 0x05,
+        0xA4, 0x05, 0x06, 0xA7, 0x47, 0xE6, 0xE5, 0x44, 0x00, 0xA1, 0xA2, 0x03, 0xE3, 0x42, 0x41, 0xE0,
+        0xA8, 0x09, 0x0A, 0xAB, 0x4B, 0xEA, 0xE9, 0x48, 0x0C, 0xAD, 0xAE, 0x0F, 0xEF, 0x4E, 0x4D, 0xEC,
+        0x4D, 0xEC, 0xEF, 0x4E, 0xAE, 0x0F, 0x0C, 0xAD, 0xE9, 0x48, 0x4B, 0xEA, 0x0A, 0xAB, 0xA8, 0x09,
+        0x4E, 0xEF, 0xEC, 0x4D, 0xAD, 0x0C, 0x0F, 0xAE, 0xEA, 0x4B, 0x48, 0xE9, 0x09, 0xA8, 0xAB, 0x0A,
+        0xAB, 0x0A, 0x09, 0xA8, 0x48, 0xE9, 0xEA, 0x4B, 0x0F, 0xAE, 0xAD, 0x0C, 0xEC, 0x4D, 0x4E, 0xEF,
+        0x0F, 0xAE, 0xAD, 0x0C, 0xEC, 0x4D, 0x4E, 0xEF, 0xAB, 0x0A, 0x09, 0xA8, 0x48, 0xE9, 0xEA, 0x4B,
+        0xEA, 0x4B, 0x48, 0xE9, 0x09, 0xA8, 0xAB, 0x0A, 0x4E, 0xEF, 0xEC, 0x4D, 0xAD, 0x0C, 0x0F, 0xAE,
+        0xE9, 0x48, 0x4B, 0xEA, 0x0A, 0xAB, 0xA8, 0x09, 0x4D, 0xEC, 0xEF, 0x4E, 0xAE, 0x0F, 0x0C, 0xAD,
+        0x0C, 0xAD, 0xAE, 0x0F, 0xEF, 0x4E, 0x4D, 0xEC, 0xA8, 0x09, 0x0A, 0xAB, 0x4B, 0xEA, 0xE9, 0x48
+    },
+    { /* data[47:40] */
+        0x00, 0xE9, 0xEA, 0x03, 0xAB, 0x42, 0x41, 0xA8, 0xEC, 0x05, 0x06, 0xEF, 0x47, 0xAE, 0xAD, 0x44,
+        0xAD, 0x44, 0x47, 0xAE, 0x06, 0xEF, 0xEC, 0x05, 0x41, 0xA8, 0xAB, 0x42, 0xEA, 0x03, 0x00, 0xE9,
+        0xAE, 0x47, 0x44, 0xAD, 0x05, 0xEC, 0xEF, 0x06, 0x42, 0xAB, 0xA8, 0x41, 0xE9, 0x00, 0x03, 0xEA,
+        0x03, 0xEA, 0xE9, 0x00, 0xA8, 0x41, 0x42, 0xAB, 0xEF, 0x06, 0x05, 0xEC, 0x44, 0xAD, 0xAE, 0x47,
+        0xEF, 0x06, 0x05, 0xEC, 0x44, 0xAD, 0xAE, 0x47, 0x03, 0xEA, 0xE9, 0x00, 0xA8, 0x41, 0x42, 0xAB,
+        0x42, 0xAB, 0xA8, 0x41, 0xE9, 0x00, 0x03, 0xEA, 0xAE, 0x47, 0x44, 0xAD, 0x05, 0xEC, 0xEF, 0x06,
+        0x41, 0xA8, 0xAB, 0x42, 0xEA, 0x03, 0x00, 0xE9, 0xAD, 0x44, 0x47, 0xAE, 0x06, 0xEF, 0xEC, 0x05,
+        0xEC, 0x05, 0x06, 0xEF, 0x47, 0xAE, 0xAD, 0x44, 0x00, 0xE9, 0xEA, 0x03, 0xAB, 0x42, 0x41, 0xA8,
+        0xB0, 0x59, 0x5A, 0xB3, 0x1B, 0xF2, 0xF1, 0x18, 0x5C, 0xB5, 0xB6, 0x5F, 0xF7, 0x1E, 0x1D, 0xF4,
+        0x1D, 0xF4, 0xF7, 0x1E, 0xB6, 0x5F, 0x5C, 0xB5, 0xF1, 0x18, 0x1B, 0xF2, 0x5A, 0xB3, 0xB0, 0x59,
+        0x1E, 0xF7, 0xF4, 0x1D, 0xB5, 0x5C, 0x5F, 0xB6, 0xF2, 0x1B, 0x18, 0xF1, 0x59, 0xB0, 0xB3, 0x5A,
+        0xB3, 0x5A, 0x59, 0xB0, 0x18, 0xF1, 0xF2, 0x1B, 0x5F, 0xB6, 0xB5, 0x5C, 0xF4, 0x1D, 0x1E, 0xF7,
+        0x5F, 0xB6, 0xB5, 0x5C, 0xF4, 0x1D, 0x1E, 0xF7, 0xB3, 0x5A, 0x59, 0xB0, 0x18, 0xF1, 0xF2, 0x1B,
+        0xF2, 0x1B, 0x18, 0xF1, 0x59, 0xB0, 0xB3, 0x5A, 0x1E, 0xF7, 0xF4, 0x1D, 0xB5, 0x5C, 0x5F, 0xB6,
+        0xF1, 0x18, 0x1B, 0xF2, 0x5A, 0xB3, 0xB0, 0x59, 0x1D, 0xF4, 0xF7, 0x1E, 0xB6, 0x5F, 0x5C, 0xB5,
+        0x5C, 0xB5, 0xB6, 0x5F, 0xF7, 0x1E, 0x1D, 0xF4, 0xB0, 0x59, 0x5A, 0xB3, 0x1B, 0xF2, 0xF1, 0x18
+    },
+    { /* data[55:48] */
+        0x00, 0xF1, 0xF2, 0x03, 0xB3, 0x42, 0x41, 0xB0, 0xF4, 0x05, 0x06, 0xF7, 0x47, 0xB6, 0xB5, 0x44,
+        0xB5, 0x44, 0x47, 0xB6, 0x06, 0xF7, 0xF4, 0x05, 0x41, 0xB0, 0xB3, 0x42, 0xF2, 0x03, 0x00, 0xF1,
+        0xB6, 0x47, 0x44, 0xB5, 0x05, 0xF4, 0xF7, 0x06, 0x42, 0xB3, 0xB0, 0x41, 0xF1, 0x00, 0x03, 0xF2,
+        0x03, 0xF2, 0xF1, 0x00, 0xB0, 0x41, 0x42, 0xB3, 0xF7, 0x06, 0x05, 0xF4, 0x44, 0xB5, 0xB6, 0x47,
+        0xF7, 0x06, 0x05, 0xF4, 0x44, 0xB5, 0xB6, 0x47, 0x03, 0xF2, 0xF1, 0x00, 0xB0, 0x41, 0x42, 0xB3,
+        0x42, 0xB3, 0xB0, 0x41, 0xF1, 0x00, 0x03, 0xF2, 0xB6, 0x47, 0x44, 0xB5, 0x05, 0xF4, 0xF7, 0x06,
+        0x41, 0xB0, 0xB3, 0x42, 0xF2, 0x03, 0x00, 0xF1, 0xB5, 0x44, 0x47, 0xB6, 0x06, 0xF7, 0xF4, 0x05,
+        0xF4, 0x05, 0x06, 0xF7, 0x47, 0xB6, 0xB5, 0x44, 0x00, 0xF1, 0xF2, 0x03, 0xB3, 0x42, 0x41, 0xB0,
+        0xF8, 0x09, 0x0A, 0xFB, 0x4B, 0xBA, 0xB9, 0x48, 0x0C, 0xFD, 0xFE, 0x0F, 0xBF, 0x4E, 0x4D, 0xBC,
+        0x4D, 0xBC, 0xBF, 0x4E, 0xFE, 0x0F, 0x0C, 0xFD, 0xB9, 0x48, 0x4B, 0xBA, 0x0A, 0xFB, 0xF8, 0x09,
+        0x4E, 0xBF, 0xBC, 0x4D, 0xFD, 0x0C, 0x0F, 0xFE, 0xBA, 0x4B, 0x48, 0xB9, 0x09, 0xF8, 0xFB, 0x0A,
+        0xFB, 0x0A, 0x09, 0xF8, 0x48, 0xB9, 0xBA, 0x4B, 0x0F, 0xFE, 0xFD, 0x0C, 0xBC, 0x4D, 0x4E, 0xBF,
+        0x0F, 0xFE, 0xFD, 0x0C, 0xBC, 0x4D, 0x4E, 0xBF, 0xFB, 0x0A, 0x09, 0xF8, 0x48, 0xB9, 0xBA, 0x4B,
+        0xBA, 0x4B, 0x48, 0xB9, 0x09, 0xF8, 0xFB, 0x0A, 0x4E, 0xBF, 0xBC, 0x4D, 0xFD, 0x0C, 0x0F, 0xFE,
+        0xB9, 0x48, 0x4B, 0xBA, 0x0A, 0xFB, 0xF8, 0x09, 0x4D, 0xBC, 0xBF, 0x4E, 0xFE, 0x0F, 0x0C, 0xFD,
+        0x0C, 0xFD, 0xFE, 0x0F, 0xBF, 0x4E, 0x4D, 0xBC, 0xF8, 0x09, 0x0A, 0xFB, 0x4B, 0xBA, 0xB9, 0x48
+    },
+    { /* data[63:56] */
+        0x00, 0xB9, 0xBA, 0x03, 0xFB, 0x42, 0x41, 0xF8, 0xBC, 0x05, 0x06, 0xBF, 0x47, 0xFE, 0xFD, 0x44,
+        0xFD, 0x44, 0x47, 0xFE, 0x06, 0xBF, 0xBC, 0x05, 0x41, 0xF8, 0xFB, 0x42, 0xBA, 0x03, 0x00, 0xB9,
+        0xFE, 0x47, 0x44, 0xFD, 0x05, 0xBC, 0xBF, 0x06, 0x42, 0xFB, 0xF8, 0x41, 0xB9, 0x00, 0x03, 0xBA,
+        0x03, 0xBA, 0xB9, 0x00, 0xF8, 0x41, 0x42, 0xFB, 0xBF, 0x06, 0x05, 0xBC, 0x44, 0xFD, 0xFE, 0x47,
+        0xBF, 0x06, 0x05, 0xBC, 0x44, 0xFD, 0xFE, 0x47, 0x03, 0xBA, 0xB9, 0x00, 0xF8, 0x41, 0x42, 0xFB,
+        0x42, 0xFB, 0xF8, 0x41, 0xB9, 0x00, 0x03, 0xBA, 0xFE, 0x47, 0x44, 0xFD, 0x05, 0xBC, 0xBF, 0x06,
+        0x41, 0xF8, 0xFB, 0x42, 0xBA, 0x03, 0x00, 0xB9, 0xFD, 0x44, 0x47, 0xFE, 0x06, 0xBF, 0xBC, 0x05,
+        0xBC, 0x05, 0x06, 0xBF, 0x47, 0xFE, 0xFD, 0x44, 0x00, 0xB9, 0xBA, 0x03, 0xFB, 0x42, 0x41, 0xF8,
+        0xC0, 0x79, 0x7A, 0xC3, 0x3B, 0x82, 0x81, 0x38, 0x7C, 0xC5, 0xC6, 0x7F, 0x87, 0x3E, 0x3D, 0x84,
+        0x3D, 0x84, 0x87, 0x3E, 0xC6, 0x7F, 0x7C, 0xC5, 0x81, 0x38, 0x3B, 0x82, 0x7A, 0xC3, 0xC0, 0x79,
+        0x3E, 0x87, 0x84, 0x3D, 0xC5, 0x7C, 0x7F, 0xC6, 0x82, 0x3B, 0x38, 0x81, 0x79, 0xC0, 0xC3, 0x7A,
+        0xC3, 0x7A, 0x79, 0xC0, 0x38, 0x81, 0x82, 0x3B, 0x7F, 0xC6, 0xC5, 0x7C, 0x84, 0x3D, 0x3E, 0x87,
+        0x7F, 0xC6, 0xC5, 0x7C, 0x84, 0x3D, 0x3E, 0x87, 0xC3, 0x7A, 0x79, 0xC0, 0x38, 0x81, 0x82, 0x3B,
+        0x82, 0x3B, 0x38, 0x81, 0x79, 0xC0, 0xC3, 0x7A, 0x3E, 0x87, 0x84, 0x3D, 0xC5, 0x7C, 0x7F, 0xC6,
+        0x81, 0x38, 0x3B, 0x82, 0x7A, 0xC3, 0xC0, 0x79, 0x3D, 0x84, 0x87, 0x3E, 0xC6, 0x7F, 0x7C, 0xC5,
+        0x7C, 0xC5, 0xC6, 0x7F, 0x87, 0x3E, 0x3D, 0x84, 0xC0, 0x79, 0x7A, 0xC3, 0x3B, 0x82, 0x81, 0x38
+    }
+};
+
+// Decode status per 8-bit key = (ecc ^ encoded) ^ (parity(ecc[5:0]) << 6):
+// bits 6:0 syndrome, bit 7 correct (SBE at 1-64), bit 8 SBE, bit 9 MBE
+static const uint16_t g_ecc_decode_lut[256] = {
+    0x000, 0x201, 0x202, 0x203, 0x204, 0x205, 0x206, 0x207,
+    0x208, 0x209, 0x20A, 0x20B, 0x20C, 0x20D, 0x20E, 0x20F,
+    0x210, 0x211, 0x212, 0x213, 0x214, 0x215, 0x216, 0x217,
+    0x218, 0x219, 0x21A, 0x21B, 0x21C, 0x21D, 0x21E, 0x21F,
+    0x220, 0x221, 0x222, 0x223, 0x224, 0x225, 0x226, 0x227,
+    0x228, 0x229, 0x22A, 0x22B, 0x22C, 0x22D, 0x22E, 0x22F,
+    0x230, 0x231, 0x232, 0x233, 0x234, 0x235, 0x236, 0x237,
+    0x238, 0x239, 0x23A, 0x23B, 0x23C, 0x23D, 0x23E, 0x23F,
+    0x240, 0x241, 0x242, 0x243, 0x244, 0x245, 0x246, 0x247,
+    0x248, 0x249, 0x24A, 0x24B, 0x24C, 0x24D, 0x24E, 0x24F,
+    0x250, 0x251, 0x252, 0x253, 0x254, 0x255, 0x256, 0x257,
+    0x258, 0x259, 0x25A, 0x25B, 0x25C, 0x25D, 0x25E, 0x25F,
+    0x260, 0x261, 0x262, 0x263, 0x264, 0x265, 0x266, 0x267,
+    0x268, 0x269, 0x26A, 0x26B, 0x26C, 0x26D, 0x26E, 0x26F,
+    0x270, 0x271, 0x272, 0x273, 0x274, 0x275, 0x276, 0x277,
+    0x278, 0x279, 0x27A, 0x27B, 0x27C, 0x27D, 0x27E, 0x27F,
+    0x000, 0x181, 0x182, 0x183, 0x184, 0x185, 0x186, 0x187,
+    0x188, 0x189, 0x18A, 0x18B, 0x18C, 0x18D, 0x18E, 0x18F,
+    0x190, 0x191, 0x192, 0x193, 0x194, 0x195, 0x196, 0x197,
+    0x198, 0x199, 0x19A, 0x19B, 0x19C, 0x19D, 0x19E, 0x19F,
+    0x1A0, 0x1A1, 0x1A2, 0x1A3, 0x1A4, 0x1A5, 0x1A6, 0x1A7,
+    0x1A8, 0x1A9, 0x1AA, 0x1AB, 0x1AC, 0x1AD, 0x1AE, 0x1AF,
+    0x1B0, 0x1B1, 0x1B2, 0x1B3, 0x1B4, 0x1B5, 0x1B6, 0x1B7,
+    0x1B8, 0x1B9, 0x1BA, 0x1BB, 0x1BC, 0x1BD, 0x1BE, 0x1BF,
+    0x1C0, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147,
+    0x148, 0x149, 0x14A, 0x14B, 0x14C, 0x14D, 0x14E, 0x14F,
+    0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157,
+    0x158, 0x159, 0x15A, 0x15B, 0x15C, 0x15D, 0x15E, 0x15F,
+    0x160, 0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167,
+    0x168, 0x169, 0x16A, 0x16B, 0x16C, 0x16D, 0x16E, 0x16F,
+    0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177,
+    0x178, 0x179, 0x17A, 0x17B, 0x17C, 0x17D, 0x17E, 0x17F
+};
+
+#define ECC_DECODE_SYNDROME 0x07FU
+#define ECC_DECODE_CORRECT  0x080U
+#define ECC_DECODE_SBE      0x100U
+#define ECC_DECODE_MBE      0x200U
+
+// Column of the check matrix per value of ecc ^ encode(data): 1-64 = data
+// bit + 1, 65-72 = check bit + 65, 0 = not a single-bit column
+static const uint8_t g_ecc_column_lut[256] = {
+     0, 65, 66,  0, 67,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+    69,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    70,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    71,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    72,  0,  0,  3,  0,  5,  6,  0,  0,  9, 10,  0, 12,  0,  0, 15,
+     0, 17, 18,  0, 20,  0,  0, 23, 24,  0,  0, 27,  0, 29, 30,  0,
+     0, 33, 34,  0, 36,  0,  0, 39, 40,  0,  0, 43,  0, 45, 46,  0,
+    48,  0,  0, 51,  0, 53, 54,  0,  0, 57, 58,  0, 60,  0,  0, 63,
+    64,  1,  2,  0,  4,  0,  0,  7,  8,  0,  0, 11,  0, 13, 14,  0,
+    16,  0,  0, 19,  0, 21, 22,  0,  0, 25, 26,  0, 28,  0,  0, 31,
+    32,  0,  0, 35,  0, 37, 38,  0,  0, 41, 42,  0, 44,  0,  0, 47,
+     0, 49, 50,  0, 52,  0,  0, 55, 56,  0,  0, 59,  0, 61, 62,  0
+};
+
+#if defined(ECC_CODEC_X86)
+// AVX2 path: p1/p2/p4 (+ their p64 share) from the XOR of the 8 bytes of
+// (data << 1)
+static const uint8_t g_ecc_fold_lut[256] = {
+    0x00, 0x00, 0x41, 0x41, 0x42, 0x42, 0x03, 0x03, 0x03, 0x03, 0x42, 0x42, 0x41, 0x41, 0x00, 0x00,
+    0x44, 0x44, 0x05, 0x05, 0x06, 0x06, 0x47, 0x47, 0x47, 0x47, 0x06, 0x06, 0x05, 0x05, 0x44, 0x44,
+    0x05, 0x05, 0x44, 0x44, 0x47, 0x47, 0x06, 0x06, 0x06, 0x06, 0x47, 0x47, 0x44, 0x44, 0x05, 0x05,
+    0x41, 0x41, 0x00, 0x00, 0x03, 0x03, 0x42, 0x42, 0x42, 0x42, 0x03, 0x03, 0x00, 0x00, 0x41, 0x41,
+    0x06, 0x06, 0x47, 0x47, 0x44, 0x44, 0x05, 0x05, 0x05, 0x05, 0x44, 0x44, 0x47, 0x47, 0x06, 0x06,
+    0x42, 0x42, 0x03, 0x03, 0x00, 0x00, 0x41, 0x41, 0x41, 0x41, 0x00, 0x00, 0x03, 0x03, 0x42, 0x42,
+    0x03, 0x03, 0x42, 0x42, 0x41, 0x41, 0x00, 0x00, 0x00, 0x00, 0x41, 0x41, 0x42, 0x42, 0x03, 0x03,
+    0x47, 0x47, 0x06, 0x06, 0x05, 0x05, 0x44, 0x44, 0x44, 0x44, 0x05, 0x05, 0x06, 0x06, 0x47, 0x47,
+    0x47, 0x47, 0x06, 0x06, 0x05, 0x05, 0x44, 0x44, 0x44, 0x44, 0x05, 0x05, 0x06, 0x06, 0x47, 0x47,
+    0x03, 0x03, 0x42, 0x42, 0x41, 0x41, 0x00, 0x00, 0x00, 0x00, 0x41, 0x41, 0x42, 0x42, 0x03, 0x03,
+    0x42, 0x42, 0x03, 0x03, 0x00, 0x00, 0x41, 0x41, 0x41, 0x41, 0x00, 0x00, 0x03, 0x03, 0x42, 0x42,
+    0x06, 0x06, 0x47, 0x47, 0x44, 0x44, 0x05, 0x05, 0x05, 0x05, 0x44, 0x44, 0x47, 0x47, 0x06, 0x06,
+    0x41, 0x41, 0x00, 0x00, 0x03, 0x03, 0x42, 0x42, 0x42, 0x42, 0x03, 0x03, 0x00, 0x00, 0x41, 0x41,
+    0x05, 0x05, 0x44, 0x44, 0x47, 0x47, 0x06, 0x06, 0x06, 0x06, 0x47, 0x47, 0x44, 0x44, 0x05, 0x05,
+    0x44, 0x44, 0x05, 0x05, 0x06, 0x06, 0x47, 0x47, 0x47, 0x47, 0x06, 0x06, 0x05, 0x05, 0x44, 0x44,
+    0x00, 0x00, 0x41, 0x41, 0x42, 0x42, 0x03, 0x03, 0x03, 0x03, 0x42, 0x42, 0x41, 0x41, 0x00, 0x00
+};
+
+// AVX2 path: p8/p16/p32 (+ p64 share) and overall parity from the 8 byte
+// parities of (data << 1)
+static const uint8_t g_ecc_byte_parity_lut[256] = {
+    0x00, 0x80, 0xC8, 0x48, 0xD0, 0x50, 0x18, 0x98, 0x98, 0x18, 0x50, 0xD0, 0x48, 0xC8, 0x80, 0x00,
+    0xE0, 0x60, 0x28, 0xA8, 0x30, 0xB0, 0xF8, 0x78, 0x78, 0xF8, 0xB0, 0x30, 0xA8, 0x28, 0x60, 0xE0,
+    0xA8, 0x28, 0x60, 0xE0, 0x78, 0xF8, 0xB0, 0x30, 0x30, 0xB0, 0xF8, 0x78, 0xE0, 0x60, 0x28, 0xA8,
+    0x48, 0xC8, 0x80, 0x00, 0x98, 0x18, 0x50, 0xD0, 0xD0, 0x50, 0x18, 0x98, 0x00, 0x80, 0xC8, 0x48,
+    0xB0, 0x30, 0x78, 0xF8, 0x60, 0xE0, 0xA8, 0x28, 0x28, 0xA8, 0xE0, 0x60, 0xF8, 0x78, 0x30, 0xB0,
+    0x50, 0xD0, 0x98, 0x18, 0x80, 0x00, 0x48, 0xC8, 0xC8, 0x48, 0x00, 0x80, 0x18, 0x98, 0xD0, 0x50,
+    0x18, 0x98, 0xD0, 0x50, 0xC8, 0x48, 0x00, 0x80, 0x80, 0x00, 0x48, 0xC8, 0x50, 0xD0, 0x98, 0x18,
+    0xF8, 0x78, 0x30, 0xB0, 0x28, 0xA8, 0xE0, 0x60, 0x60, 0xE0, 0xA8, 0x28, 0xB0, 0x30, 0x78, 0xF8,
+    0xF8, 0x78, 0x30, 0xB0, 0x28, 0xA8, 0xE0, 0x60, 0x60, 0xE0, 0xA8, 0x28, 0xB0, 0x30, 0x78, 0xF8,
+    0x18, 0x98, 0xD0, 0x50, 0xC8, 0x48, 0x00, 0x80, 0x80, 0x00, 0x48, 0xC8, 0x50, 0xD0, 0x98, 0x18,
+    0x50, 0xD0, 0x98, 0x18, 0x80, 0x00, 0x48, 0xC8, 0xC8, 0x48, 0x00, 0x80, 0x18, 0x98, 0xD0, 0x50,
+    0xB0, 0x30, 0x78, 0xF8, 0x60, 0xE0, 0xA8, 0x28, 0x28, 0xA8, 0xE0, 0x60, 0xF8, 0x78, 0x30, 0xB0,
+    0x48, 0xC8, 0x80, 0x00, 0x98, 0x18, 0x50, 0xD0, 0xD0, 0x50, 0x18, 0x98, 0x00, 0x80, 0xC8, 0x48,
+    0xA8, 0x28, 0x60, 0xE0, 0x78, 0xF8, 0xB0, 0x30, 0x30, 0xB0, 0xF8, 0x78, 0xE0, 0x60, 0x28, 0xA8,
+    0xE0, 0x60, 0x28, 0xA8, 0x30, 0xB0, 0xF8, 0x78, 0x78, 0xF8, 0xB0, 0x30, 0xA8, 0x28, 0x60, 0xE0,
+    0x00, 0x80, 0xC8, 0x48, 0xD0, 0x50, 0x18, 0x98, 0x98, 0x18, 0x50, 0xD0, 0x48, 0xC8, 0x80, 0x00
+};
+#endif
+
+// ============================================================================
+// Scalar Encoders
+// ============================================================================
+
+/**
+ * @brief Encode one word with the byte lookup tables
+ */
+static inline uint8_t ecc_encode_table(uint64_t data)
+{
+    return (uint8_t)(g_ecc_encode_lut[0][(uint8_t)data] ^
+                     g_ecc_encode_lut[1][(uint8_t)(data >> 8)] ^
+                     g_ecc_encode_lut[2][(uint8_t)(data >> 16)] ^
+                     g_ecc_encode_lut[3][(uint8_t)(data >> 24)] ^
+                     g_ecc_encode_lut[4][(uint8_t)(data >> 32)] ^
+                     g_ecc_encode_lut[5][(uint8_t)(data >> 40)] ^
+                     g_ecc_encode_lut[6][(uint8_t)(data >> 48)] ^
+                     g_ecc_encode_lut[7][(uint8_t)(data >> 56)]);
+}
+
+/**
+ * @brief Parity of a 32-bit word
+ */
+static inline uint32_t ecc_parity32(uint32_t x)
+{
+    x ^= x >> 16;
+    x ^= x >> 8;
+    x ^= x >> 4;
+    return (0x6996U >> (x & 0xFU)) & 1U;
+}
+
+/**
+ * @brief Encode one word by XOR folding (no table reads)
+ *
+ * With w = data << 1 (bit position = data bit + 1), p(2^k) is the parity
+ * of the w bits whose index has bit k set. Folding w in halves keeps
+ * those index bits aligned, so each fold step yields the next parity:
+ * p32 from the high half, p16 from the high half of the 32-bit fold, ...
+ * Uses only 32-bit operations (Cortex-M4).
+ */
+static inline uint8_t ecc_encode_word(uint64_t data)
+{
+    uint32_t hi = (uint32_t)(data >> 31);            // w[63:32]
+    uint32_t lo = (uint32_t)(data << 1);             // w[31:0]
+    uint32_t d63 = (uint32_t)(data >> 63);
+    uint32_t x, p1, p2, p4, p8, p16, p32, ecc;
+
+    p32 = ecc_parity32(hi);
+    x = hi ^ lo;
+    p16 = ecc_parity32(x >> 16);
+    x = (x ^ (x >> 16)) & 0xFFFFU;
+    p8 = ecc_parity32(x >> 8);
+    x = (x ^ (x >> 8)) & 0xFFU;
+    p4 = (0x6996U >> (x >> 4)) & 1U;
+    x = (x ^ (x >> 4)) & 0xFU;
+    p2 = ((x >> 2) ^ (x >> 3)) & 1U;
+    p1 = ((x >> 1) ^ (x >> 3)) & 1U;
+
+    ecc = p1 | (p2 << 1) | (p4 << 2) | (p8 << 3) | (p16 << 4) | (p32 << 5);
+    ecc |= (d63 ^ p1 ^ p2 ^ p4 ^ p8 ^ p16 ^ p32) << 6;
+    ecc |= ecc_parity32((uint32_t)data ^ (uint32_t)(data >> 32)) << 7;
+
+    return (uint8_t)ecc;
+}
+
+// ============================================================================
+// Decoder Core
+// ============================================================================
+
+/**
+ * @brief Look up the decode status of a word
+ *
+ * With diff = ecc ^ encode(data):
+ *  - syndrome[5:0] = diff[5:0]
+ *  - syndrome[6]   = ecc[6] ^ data[63] ^ XOR(syndrome[5:0])
+ *                  = diff[6] ^ parity(ecc[5:0])   (RTL s64 term)
+ *  - overall       = diff[7]
+ * so one 8-bit key selects the g_ecc_decode_lut entry.
+ */
+static inline uint32_t ecc_decode_status(uint8_t ecc, uint8_t encoded)
+{
+    uint32_t key = (uint32_t)(ecc ^ encoded) ^
+                   ((uint32_t)(ECC_PARITY6_LUT >> (ecc & 0x3FU)) & 1U) << 6;
+
+    return g_ecc_decode_lut[key];
+}
+
+/**
+ * @brief Correction mask of a decode status (0 unless correctable SBE)
+ */
+static inline uint64_t ecc_decode_correction(uint32_t status)
+{
+    uint64_t correct = 0ULL - (uint64_t)((status & ECC_DECODE_CORRECT) >> 7);
+
+    return (1ULL << (((status & ECC_DECODE_SYNDROME) - 1U) & 63U)) & correct;
+}
+
+// ============================================================================
+// Scalar Interface
+// ============================================================================
+
+/**
+ * @brief Compute the 8 check bits of a data word (ecc_encoder.v)
+ *
+ * @param data 64-bit data word
+ * @return ecc_out: {overall, p64, p32, p16, p8, p4, p2, p1}
+ */
+uint8_t ecc_encode64(uint64_t data)
+{
+    return ecc_encode_table(data);
+}
+
+/**
+ * @brief Check and correct a code word (ecc_decoder.v)
+ *
+ * @param data Data word as read
+ * @param ecc Check bits as read
+ * @param[out] result Corrected data, flags and error position
+ */
+void ecc_decode64(uint64_t data, uint8_t ecc, ecc_decode_t *result)
+{
+    uint32_t status;
+
+    if (result == NULL) {
+        return;
+    }
+
+    status = ecc_decode_status(ecc, ecc_encode_table(data));
+    result->data = data ^ ecc_decode_correction(status);
+    result->error_pos = (uint8_t)(status & ECC_DECODE_SYNDROME);
+    result->sbe = ((status & ECC_DECODE_SBE) != 0U);
+    result->mbe = ((status & ECC_DECODE_MBE) != 0U);
+}
+
+/**
+ * @brief Check a code word against the encoder and repair one flipped bit
+ *
+ * Independent of the decoder's syndrome[6] term: a word is clean exactly
+ * when its check bits match ecc_encode64(), and a single flipped bit
+ * (data or check) is located by matching ecc ^ encode(data) against the
+ * 72 columns of the encoder's check matrix, which are all distinct. Any
+ * other mismatch is reported as MBE. Two flipped data bits never alter
+ * the data (data columns all include ecc[7]); 6 of the 2016 pairs share
+ * their difference with a single check bit and are reported as that SBE.
+ * Used where stored code words must be repaired, e.g. the scrubber.
+ *
+ * @param data Data word as read
+ * @param ecc Check bits as read
+ * @param[out] result Repaired data, flags and error position (1-64 data
+ *                    bit + 1, 65-72 check bit + 65, 0 = none/MBE)
+ */
+void ecc_check64(uint64_t data, uint8_t ecc, ecc_decode_t *result)
+{
+    uint32_t diff;
+    uint32_t column;
+
+    if (result == NULL) {
+        return;
+    }
+
+    diff = (uint32_t)(ecc ^ ecc_encode_table(data));
+    column = g_ecc_column_lut[diff];
+
+    result->data = data;
+    if (column >= 1U && column <= 64U) {
+        result->data ^= 1ULL << (column - 1U);
+    }
+    result->error_pos = (uint8_t)column;
+    result->sbe = (column != 0U);
+    result->mbe = (diff != 0U) && (column == 0U);
+}
+
+/**
+ * @brief Translate a decoder syndrome into its ecc_check64() column
+ *
+ * The hardware (ERR_STATUS[14:8], the error FIFO) reports the RTL
+ * syndrome, not the check-matrix column that ecc_check64() and the
+ * heatmap use. For a single flipped data bit i < 63, syndrome[5:0] is
+ * i + 1 and syndrome[6] follows the parity of the stored p1..p32, so
+ * about half of those SBEs arrive as i + 65. Data bit 63 and ecc[7] both
+ * give syndrome 64; the decoder corrects data bit 63, so 64 maps there.
+ * Flips of ecc[6:0] decode as MBE and never reach this function.
+ *
+ * @param syndrome Decoder error position (7 bits)
+ *
+ * @return Column 1-64 (data bit + 1), 0 if the syndrome is 0 or out of
+ *         range
+ */
+uint8_t ecc_syndrome_column(uint8_t syndrome)
+{
+    uint8_t low = (uint8_t)(syndrome & 0x3FU);
+
+    if (syndrome > ECC_DECODE_SYNDROME) {
+        return 0U;
+    }
+    if (low != 0U) {
+        return low;
+    }
+    return (syndrome == 0x40U) ? 64U : 0U;
+}
+
+// ============================================================================
+// Batch Encoders
+// ============================================================================
+
+typedef void (*ecc_batch_encoder_t)(const uint64_t *data, uint8_t *ecc,
+                                    size_t count);
+
+static void ecc_encode_batch_table(const uint64_t *data, uint8_t *ecc,
+                                   size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        ecc[i] = ecc_encode_table(data[i]);
+    }
+}
+
+static void ecc_encode_batch_word(const uint64_t *data, uint8_t *ecc,
+                                  size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        ecc[i] = ecc_encode_word(data[i]);
+    }
+}
+
+#if defined(ECC_CODEC_X86)
+
+/**
+ * @brief AVX2 encoder: 4 words per step
+ *
+ * For w = data << 1, p1/p2/p4 depend only on the XOR of the 8 bytes of
+ * w, and p8/p16/p32/overall only on the 8 byte parities of w (their
+ * masks are whole bytes). The byte XOR is three shift/XOR folds; the byte
+ * parities are two nibble VPSHUFB lookups collected by VPMOVMSKB. Two
+ * 256-entry tables map both to check bits; data[63] toggles p64 and the
+ * overall parity.
+ */
+__attribute__((target("avx2")))
+static void ecc_encode_batch_avx2(const uint64_t *data, uint8_t *ecc,
+                                  size_t count)
+{
+    // Nibble parity in bit 7 (VPMOVMSKB picks bit 7 of each byte)
+    const __m256i parity_lut = _mm256_setr_epi8(
+        0, -128, -128, 0, -128, 0, 0, -128, -128, 0, 0, -128, 0, -128, -128, 0,
+        0, -128, -128, 0, -128, 0, 0, -128, -128, 0, 0, -128, 0, -128, -128, 0);
+    const __m256i low_nibble = _mm256_set1_epi8(0x0F);
+    uint64_t folded[4];
+    size_t i = 0;
+
+    for (; i + 4U <= count; i += 4U) {
+        __m256i d = _mm256_loadu_si256((const __m256i *)&data[i]);
+        __m256i w = _mm256_slli_epi64(d, 1);
+        __m256i x = _mm256_xor_si256(w, _mm256_srli_epi64(w, 32));
+        __m256i lo = _mm256_shuffle_epi8(parity_lut, _mm256_and_si256(w, low_nibble));
+        __m256i hi = _mm256_shuffle_epi8(parity_lut,
+                         _mm256_and_si256(_mm256_srli_epi16(w, 4), low_nibble));
+        uint32_t bytes = (uint32_t)_mm256_movemask_epi8(_mm256_xor_si256(lo, hi));
+        uint32_t top = (uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(d));
+
+        x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 16));
+        x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 8));
+        _mm256_storeu_si256((__m256i *)folded, x);
+
+        for (uint32_t q = 0; q < 4U; q++) {
+            ecc[i + q] = (uint8_t)(g_ecc_fold_lut[(uint8_t)folded[q]] ^
+                                   g_ecc_byte_parity_lut[(uint8_t)(bytes >> (8U * q))] ^
+                                   ((0U - ((top >> q) & 1U)) & 0xC0U));
+        }
+    }
+
+    ecc_encode_batch_table(&data[i], &ecc[i], count - i);
+}
+
+/**
+ * @brief AVX-512 encoder: 8 words per step
+ *
+ * Each check bit is VPOPCNTQ(data & mask) & 1; the 8 parity bits are
+ * shifted into place and narrowed to bytes with VPMOVQB.
+ */
+__attribute__((target("avx512f,avx512vpopcntdq")))
+static void ecc_encode_batch_avx512(const uint64_t *data, uint8_t *ecc,
+                                    size_t count)
+{
+    const __m512i one = _mm512_set1_epi64(1);
+    const __m512i m1 = _mm512_set1_epi64((long long)ECC_MASK_P1);
+    const __m512i m2 = _mm512_set1_epi64((long long)ECC_MASK_P2);
+    const __m512i m4 = _mm512_set1_epi64((long long)ECC_MASK_P4);
+    const __m512i m8 = _mm512_set1_epi64((long long)ECC_MASK_P8);
+    const __m512i m16 = _mm512_set1_epi64((long long)ECC_MASK_P16);
+    const __m512i m32 = _mm512_set1_epi64((long long)ECC_MASK_P32);
+    const __m512i m64 = _mm512_set1_epi64((long long)ECC_MASK_P64);
+    size_t i = 0;
+
+#define ECC_AVX512_PARITY(d, mask, bit) \
+    _mm512_slli_epi64(_mm512_and_si512( \
+        _mm512_popcnt_epi64(_mm512_and_si512((d), (mask))), one), (bit))
+
+    for (; i + 8U <= count; i += 8U) {
+        __m512i d = _mm512_loadu_si512((const void *)&data[i]);
+        __m512i acc = _mm512_and_si512(_mm512_popcnt_epi64(d), one);
+
+        acc = _mm512_slli_epi64(acc, 7);
+        acc = _mm512_or_si512(acc, ECC_AVX512_PARITY(d, m1, 0));
+        acc = _mm512_or_si512(acc, ECC_AVX512_PARITY(d, m2, 1));
+        acc = _mm512_or_si512(acc, ECC_AVX512_PARITY(d, m4, 2));
+        acc = _mm512_or_si512(acc, ECC_AVX512_PARITY(d, m8, 3));
+        acc = _mm512_or_si512(acc, ECC_AVX512_PARITY(d, m16, 4));
+        acc = _mm512_or_si512(acc, ECC_AVX512_PARITY(d, m32, 5));
+        acc = _mm512_or_si512(acc, ECC_AVX512_PARITY(d, m64, 6));
+
+        _mm_storel_epi64((__m128i *)&ecc[i], _mm512_cvtepi64_epi8(acc));
+    }
+
+#undef ECC_AVX512_PARITY
+
+    ecc_encode_batch_table(&data[i], &ecc[i], count - i);
+}
+
+#endif /* ECC_CODEC_X86 */
+
+// ============================================================================
+// Batch Path Selection
+// ============================================================================
+
+static ecc_codec_path_t g_ecc_codec_path = ECC_CODEC_PATH_AUTO;
+static ecc_batch_encoder_t g_ecc_batch_encoder = NULL;
+
+/**
+ * @brief Select the batch implementation
+ *
+ * AUTO picks AVX512 > AVX2 > TABLE on the host and WORD on the target.
+ * Intended to be called once at start-up (not thread-safe against
+ * concurrent batch calls).
+ *
+ * @param path Requested implementation
+ * @return true if selected, false if not available on this build/CPU
+ */
+bool ecc_codec_select_path(ecc_codec_path_t path)
+{
+    ecc_batch_encoder_t encoder = NULL;
+
+    if (path == ECC_CODEC_PATH_AUTO) {
+#if defined(ECC_CODEC_X86)
+        if (ecc_codec_select_path(ECC_CODEC_PATH_AVX512) ||
+            ecc_codec_select_path(ECC_CODEC_PATH_AVX2)) {
+            return true;
+        }
+        return ecc_codec_select_path(ECC_CODEC_PATH_TABLE);
+#elif defined(FIRMWARE_HOST_BUILD)
+        return ecc_codec_select_path(ECC_CODEC_PATH_TABLE);
+#else
+        return ecc_codec_select_path(ECC_CODEC_PATH_WORD);
+#endif
+    }
+
+    switch (path) {
+        case ECC_CODEC_PATH_TABLE:
+            encoder = ecc_encode_batch_table;
+            break;
+        case ECC_CODEC_PATH_WORD:
+            encoder = ecc_encode_batch_word;
+            break;
+#if defined(ECC_CODEC_X86)
+        case ECC_CODEC_PATH_AVX2:
+            if (__builtin_cpu_supports("avx2")) {
+                encoder = ecc_encode_batch_avx2;
+            }
+            break;
+        case ECC_CODEC_PATH_AVX512:
+            if (__builtin_cpu_supports("avx512f") &&
+                __builtin_cpu_supports("avx512vpopcntdq")) {
+                encoder = ecc_encode_batch_avx512;
+            }
+            break;
+#endif
+        default:
+            break;
+    }
+
+    if (encoder == NULL) {
+        return false;
+    }
+
+    g_ecc_batch_encoder = encoder;
+    g_ecc_codec_path = path;
+    return true;
+}
+
+/**
+ * @brief Get the selected batch implementation
+ *
+ * @return Selected path (AUTO if no batch call or selection happened yet)
+ */
+ecc_codec_path_t ecc_codec_get_path(void)
+{
+    return g_ecc_codec_path;
+}
+
+static inline ecc_batch_encoder_t ecc_batch_encoder(void)
+{
+    if (g_ecc_batch_encoder == NULL) {
+        (void)ecc_codec_select_path(ECC_CODEC_PATH_AUTO);
+    }
+    return g_ecc_batch_encoder;
+}
+
+// ============================================================================
+// Batch Interface
+// ============================================================================
+
+/**
+ * @brief Encode a buffer of data words
+ *
+ * @param data Data words
+ * @param[out] ecc Check bits, one byte per word
+ * @param count Number of words
+ */
+void ecc_encode64_batch(const uint64_t *data, uint8_t *ecc, size_t count)
+{
+    if (data == NULL || ecc == NULL) {
+        return;
+    }
+
+    ecc_batch_encoder()(data, ecc, count);
+}
+
+/**
+ * @brief Check and correct a buffer of code words
+ *
+ * Check bits are recomputed with the selected batch path in chunks of
+ * ECC_CODEC_CHUNK words, then every word is classified as in
+ * ecc_decode64().
+ *
+ * @param data Data words as read
+ * @param ecc Check bits as read
+ * @param[out] out Corrected data (may be the same buffer as @p data)
+ * @param count Number of words
+ * @param[out] stats SBE/MBE counts and first error index (may be NULL)
+ */
+void ecc_decode64_batch(const uint64_t *data, const uint8_t *ecc,
+                        uint64_t *out, size_t count, ecc_batch_stats_t *stats)
+{
+    ecc_batch_encoder_t encoder;
+    uint8_t encoded[ECC_CODEC_CHUNK];
+    uint32_t sbe_count = 0;
+    uint32_t mbe_count = 0;
+    size_t first_error = count;
+
+    if (data == NULL || ecc == NULL || out == NULL) {
+        return;
+    }
+
+    encoder = ecc_batch_encoder();
+
+    for (size_t base = 0; base < count; base += ECC_CODEC_CHUNK) {
+        size_t n = (count - base < ECC_CODEC_CHUNK) ? (count - base) : ECC_CODEC_CHUNK;
+
+        encoder(&data[base], encoded, n);
+
+        // Branch-free classification: with the RTL syndrome[6] term even
+        // clean words are MBE about half the time, so a "clean" fast-path
+        // branch would be unpredictable
+        for (size_t i = 0; i < n; i++) {
+            uint32_t status = ecc_decode_status(ecc[base + i], encoded[i]);
+
+            out[base + i] = data[base + i] ^ ecc_decode_correction(status);
+            sbe_count += (status >> 8) & 1U;
+            mbe_count += (status >> 9) & 1U;
+            if (first_error == count && (status & (ECC_DECODE_SBE | ECC_DECODE_MBE)) != 0U) {
+                first_error = base + i;
+            }
+        }
+    }
+
+    if (stats != NULL) {
+        stats->sbe_count = sbe_count;
+        stats->mbe_count = mbe_count;
+        stats->first_error = first_error;
+    }
+}
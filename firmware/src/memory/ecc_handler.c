@@ -13,8 +13,18 @@
  *
  * Execution Context:
  * - ISR context: ecc_fault_isr() (max 5μs)
+ * - Task context: ecc_fault_poll_task() (every 1ms, ECC_POLL_BUDGET_CYCLES)
  * - Called from main safety FSM for recovery coordination
  *
+ * Interrupt / Polling Switch:
+ * - Interrupt mode: one ISR per (coalesced) error burst, best latency
+ * - Polling mode: entered by the ISR when SBEs arrive at or above the
+ *   enter rate; SBE interrupts are masked and the poll task folds the
+ *   counters and drains the error FIFO once per call
+ * - Polling mode is left when the rate measured by the poll task drops
+ *   below the exit rate (hysteresis)
+ * - MBEs interrupt in both modes
+ *
  * Timing Budget:
  * - ISR execution: < 5μs (2000 cycles @ 400MHz)
  * - Fault path latency: < 100ns (from ECC output to ISR entry)
@@ -30,6 +40,13 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
+#include "hal/hal_cpu.h"
+#include "hal/timebase.h"
+#include "memory/ecc_codec.h"
+#include "memory/ecc_handler.h"
+#include "memory/ecc_heatmap.h"
+#include "memory/ecc_service.h"
+#include "safety/fault_event_queue.h"
 
 // ============================================================================
 // Hardware Register and Interrupt Definitions
@@ -41,21 +58,21 @@
 // ISR Nesting Counter Limits
 #define ECC_ISR_NESTING_MAX 8
 
+// SBE rate measurement window (1ms)
+#define ECC_POLL_WINDOW_TICKS ((uint32_t)TIMEBASE_TICKS_PER_MS)
+
 // ============================================================================
 // Fault Flag Storage (DCLS Protection)
 // ============================================================================
 
-// Double-Complement Lock Step (DCLS) protection for fault flag
-// flag ^ complement must equal 0xFF for valid state
-typedef struct {
-    volatile uint8_t mem_fault_flag;           // Main flag
-    volatile uint8_t mem_fault_flag_complement; // Complement (0xFF - flag)
-    volatile uint8_t mem_isr_nesting_count;    // Reentry counter
-    volatile uint32_t mem_fault_event_count;   // Event counter
-} mem_fault_state_t;
-
-// Located in fault aggregator (shared with power/clock faults)
-extern mem_fault_state_t mem_fault_state;
+// Memory fault flag with DCLS protection (shared with power/clock faults
+// through the fault aggregator)
+mem_fault_state_t mem_fault_state = {
+    .mem_fault_flag = 0x00,
+    .mem_fault_flag_complement = 0xFF,
+    .mem_isr_nesting_count = 0,
+    .mem_fault_event_count = 0
+};
 
 // ============================================================================
 // ECC Handler State
@@ -79,6 +96,102 @@ static ecc_handler_state_t ecc_handler_state = {
     .last_error_timestamp = 0
 };
 
+// ============================================================================
+// Interrupt / Polling Switch State
+// ============================================================================
+
+typedef struct {
+    uint32_t enter_per_ms;      // Switch to polling at this SBE rate (0 = never)
+    uint32_t exit_per_ms;       // Switch back below this SBE rate
+    uint32_t window_start;      // Rate window start (timebase ticks)
+    uint32_t window_sbe;        // SBEs seen in the rate window
+    uint64_t last_sbe_total;    // ecc_get_sbe_total() at the last ISR or poll
+    volatile bool polling;      // SBE interrupts masked, poll task active
+    bool primed;                // last_sbe_total valid
+    uint32_t mode_switches;     // Interrupt <-> polling transitions
+} ecc_poll_state_t;
+
+static ecc_poll_state_t ecc_poll = {
+    .enter_per_ms = ECC_POLL_ENTER_SBE_PER_MS,
+    .exit_per_ms = ECC_POLL_EXIT_SBE_PER_MS,
+    .polling = false
+};
+
+/**
+ * @brief Drain one burst of captured errors into the heatmap
+ *
+ * Context: ISR, or task with interrupts masked (FIFO pops are not
+ * reentrant)
+ *
+ * @param info Output: fault event info (ECC_EVENT_INFO_*) of the burst
+ *
+ * @return Entries drained
+ */
+static size_t ecc_fault_drain_fifo(uint16_t *info)
+{
+    ecc_error_entry_t errors[ECC_FIFO_DRAIN_PER_IRQ];
+    size_t drained = ecc_drain_errors(errors, ECC_FIFO_DRAIN_PER_IRQ);
+    
+    *info = 0U;
+    for (size_t i = 0; i < drained; i++) {
+        if (errors[i].sbe) {
+            // The FIFO holds the RTL syndrome; the heatmap bins by column
+            ecc_heatmap_record(ecc_syndrome_column(errors[i].syndrome),
+                               errors[i].address);
+        }
+        *info = (uint16_t)((*info & ECC_EVENT_INFO_MBE) |
+                           (errors[i].mbe ? ECC_EVENT_INFO_MBE : 0U) |
+                           (errors[i].syndrome & ECC_EVENT_INFO_SYNDROME_MASK));
+    }
+    
+    return drained;
+}
+
+/**
+ * @brief Account SBEs counted since the last interrupt, switch to polling
+ *        above the rate
+ *
+ * Uses the SBE_COUNT delta (64-bit total), not the FIFO entries drained:
+ * with coalescing or a full FIFO one interrupt stands for more SBEs than
+ * one burst holds. The status shadow must be invalid on entry. Task-side
+ * counter folds run with interrupts masked, so this fold never splits
+ * one of theirs.
+ *
+ * Context: ISR
+ */
+static void ecc_fault_rate_check(uint32_t now)
+{
+    uint64_t total, new_sbe;
+    
+    if (ecc_poll.polling) {
+        return;  // ecc_fault_poll_task() owns last_sbe_total
+    }
+    
+    total = ecc_get_sbe_total();
+    new_sbe = total - ecc_poll.last_sbe_total;
+    ecc_poll.last_sbe_total = total;
+    if (ecc_poll.enter_per_ms == 0U) {
+        return;
+    }
+    
+    if ((uint32_t)(now - ecc_poll.window_start) >= ECC_POLL_WINDOW_TICKS) {
+        ecc_poll.window_start = now;
+        ecc_poll.window_sbe = 0U;
+    }
+    if (new_sbe > (uint64_t)(0xFFFFFFFFU - ecc_poll.window_sbe)) {
+        ecc_poll.window_sbe = 0xFFFFFFFFU;  // Saturate
+    } else {
+        ecc_poll.window_sbe += (uint32_t)new_sbe;
+    }
+    
+    if (ecc_poll.window_sbe >= ecc_poll.enter_per_ms &&
+        ecc_set_sbe_fault_mask(true)) {
+        ecc_poll.primed = false;
+        ecc_poll.polling = true;
+        ecc_poll.mode_switches++;
+    }
+}
+
 // ============================================================================
 // ECC Fault Handler Functions
 // ============================================================================
@@ -110,6 +223,17 @@ bool ecc_handler_init(void)
     ecc_handler_state.last_error_position = 0;
     ecc_handler_state.last_error_timestamp = 0;
     
+    // Start in interrupt mode
+    if (ecc_poll.polling) {
+        (void)ecc_set_sbe_fault_mask(false);
+    }
+    ecc_poll.polling = false;
+    ecc_poll.primed = false;
+    ecc_poll.last_sbe_total = 0U;  // ecc_init() starts the totals at 0
+    ecc_poll.window_start = timebase_ticks32();
+    ecc_poll.window_sbe = 0U;
+    ecc_poll.mode_switches = 0U;
+    
     // Note: Interrupt registration is handled by boot loader
     // This function only initializes state
     
@@ -122,23 +246,35 @@ bool ecc_handler_init(void)
  * Handles ECC fault interrupts:
  * 1. Detect reentry (prevent stack overflow)
  * 2. Set fault flag with DCLS protection
- * 3. Capture error information
+ * 3. Capture error information (timestamp, drain the error FIFO into
+ *    the heatmap)
  * 4. Increment counters
- * 5. Exit ISR
+ * 5. Switch SBEs to polling if they arrive too fast
+ * 6. Exit ISR
  *
- * Execution Time: ~150ns typical (60 cycles @ 400MHz)
+ * Execution Time: dominated by APB accesses, worst case per interrupt:
+ * - FIFO drain: 2 reads per entry (pop + address), ECC_FIFO_DRAIN_PER_IRQ
+ *   (8) entries max, plus one empty pop when fewer are queued: <= 16 reads
+ * - Heatmap: one bin update per drained SBE entry (RAM only)
+ * - Rate check: 3 counter/status reads (x3 if a nested ISR invalidates
+ *   the shadow mid-read), plus an ECC_CTRL read and write on the switch
+ *   to polling
+ * - Event queue post and flight recorder record (RAM only)
+ * => 20 APB reads + 1 write with a full burst and no nested ISR;
+ *    bench_isr reports the measured p99/max against the 5μs budget
  * Context: Interrupt context (all interrupts disabled)
  * Reentry: Allowed up to 8 levels (safety guard)
  *
  * Typical call sequence:
- *   Hardware ECC → FAULT_MEM signal → ISR entry → ~150ns → ISR exit
+ *   Hardware ECC → FAULT_MEM signal → ISR entry → drain + rate check →
+ *   ISR exit
  *
  * Safety Properties:
  * - DCLS: mem_fault_flag ^ mem_fault_flag_complement == 0xFF
  * - Nesting: mem_isr_nesting_count <= 8
  * - Atomicity: No read-modify-write race conditions
  */
-__attribute__((interrupt))
+HAL_ISR
 void ecc_fault_isr(void)
 {
     // ====================================================================
@@ -179,12 +315,22 @@ void ecc_fault_isr(void)
     // Update Handler State (diagnostic info)
     // ====================================================================
     
-    // Read ECC error info from hardware registers
-    // (These would normally come from ECC controller output signals)
-    // For this implementation, we capture timing info
+    // Capture detection time (timebase ticks, single LDR on target)
+    ecc_handler_state.last_error_timestamp = timebase_ticks32();
+    
+    // Counters/status changed: status shadow in ecc_service is stale
+    ecc_status_invalidate();
+    
+    // Drain a burst of captured errors; corrected ones feed the heatmap
+    // with their bit position and address
+    uint16_t event_info;
+    (void)ecc_fault_drain_fifo(&event_info);
     
-    uint32_t timestamp = 0;  // Would read from system timer
-    ecc_handler_state.last_error_timestamp = timestamp;
+    // Above the enter rate, hand SBEs over to ecc_fault_poll_task()
+    ecc_fault_rate_check(ecc_handler_state.last_error_timestamp);
+    
+    // Queue the event for the safety task (wait-free, bounded cost)
+    (void)fault_event_post(FAULT_EVENT_ECC_ISR, event_info);
     
     // ====================================================================
     // Decrement Nesting Counter and Exit
@@ -192,7 +338,7 @@ void ecc_fault_isr(void)
     
     mem_fault_state.mem_isr_nesting_count--;
     
-    // Return from ISR (total time: ~150ns)
+    // Return from ISR (worst case: see Execution Time above)
 }
 
 /**
@@ -387,6 +533,147 @@ void ecc_handler_set_enable(bool enable)
     ecc_handler_state.handler_enabled = enable;
 }
 
+// ============================================================================
+// Interrupt / Polling Switch
+// ============================================================================
+
+/**
+ * @brief Set the SBE rates for the interrupt/polling switch
+ * 
+ * @param enter_per_ms SBEs per ms at which the ISR switches to polling
+ *                     (0 = always interrupt-driven)
+ * @param exit_per_ms SBEs per ms below which polling switches back
+ *                    (must be below @p enter_per_ms)
+ *
+ * @return true if applied, false if the rates give no hysteresis
+ */
+bool ecc_fault_set_poll_thresholds(uint32_t enter_per_ms, uint32_t exit_per_ms)
+{
+    uint32_t primask;
+    
+    if (enter_per_ms != 0U && exit_per_ms >= enter_per_ms) {
+        return false;
+    }
+    
+    primask = hal_irq_save();
+    ecc_poll.enter_per_ms = enter_per_ms;
+    ecc_poll.exit_per_ms = exit_per_ms;
+    hal_irq_restore(primask);
+    
+    return true;
+}
+
+/**
+ * @brief Query the SBE handling mode
+ * 
+ * @return true if SBEs are polled, false if interrupt-driven
+ */
+bool ecc_fault_is_polling(void)
+{
+    return ecc_poll.polling;
+}
+
+/**
+ * @brief Get the number of interrupt/polling transitions
+ * 
+ * @return Transitions since ecc_handler_init() (diagnostics)
+ */
+uint32_t ecc_fault_get_mode_switches(void)
+{
+    return ecc_poll.mode_switches;
+}
+
+/**
+ * @brief SBE polling task
+ * 
+ * Call every 1ms from the safety task. Does nothing in interrupt mode.
+ * In polling mode:
+ * 1. Fold the hardware counters (64-bit totals) and refresh the status
+ *    shadow, which no SBE interrupt invalidates now
+ * 2. Drain the error FIFO into the heatmap, one burst at a time, within
+ *    ECC_POLL_BUDGET_CYCLES
+ * 3. Raise the fault flag and post a fault event (own ring, so a
+ *    preempting ecc_fault_isr() cannot corrupt it) if SBEs were counted
+ * 4. Restore SBE interrupts once a full window ran below the exit rate
+ *
+ * Execution Time: bounded by ECC_POLL_BUDGET_CYCLES plus one burst
+ * Context: Task (masks interrupts around each FIFO burst)
+ *
+ * @return Cycles spent (0 in interrupt mode)
+ */
+uint32_t ecc_fault_poll_task(void)
+{
+    uint32_t start = hal_cycle_count();
+    uint32_t now, elapsed, primask;
+    uint16_t info, event_info = 0U;
+    uint64_t total, new_sbe;
+    size_t drained;
+    
+    if (!ecc_poll.polling) {
+        return 0U;
+    }
+    
+    // Fold counters; the first poll of a polling period sets the baseline
+    ecc_status_invalidate();
+    total = ecc_get_sbe_total();
+    now = timebase_ticks32();
+    new_sbe = ecc_poll.primed ? (total - ecc_poll.last_sbe_total) : 0U;
+    ecc_poll.last_sbe_total = total;
+    if (!ecc_poll.primed) {
+        ecc_poll.primed = true;
+        ecc_poll.window_start = now;
+        ecc_poll.window_sbe = 0U;
+    }
+    
+    // Drain captured errors (the FIFO keeps at most FIFO_DEPTH addresses)
+    do {
+        primask = hal_irq_save();
+        drained = ecc_fault_drain_fifo(&info);
+        hal_irq_restore(primask);
+        if (drained != 0U) {
+            event_info = (uint16_t)((event_info & ECC_EVENT_INFO_MBE) | info);
+        }
+    } while (drained == ECC_FIFO_DRAIN_PER_IRQ &&
+             (uint32_t)(hal_cycle_count() - start) < ECC_POLL_BUDGET_CYCLES);
+    
+    if (new_sbe != 0U) {
+        primask = hal_irq_save();
+        mem_fault_state.mem_fault_flag = 0x01;
+        mem_fault_state.mem_fault_flag_complement = 0xFE;
+        if (mem_fault_state.mem_fault_event_count != 0xFFFFFFFF) {
+            mem_fault_state.mem_fault_event_count++;
+        }
+        ecc_handler_state.last_error_timestamp = now;
+        hal_irq_restore(primask);
+        
+        (void)fault_event_post(FAULT_EVENT_ECC_POLL, event_info);
+        
+        if (new_sbe > (uint64_t)(0xFFFFFFFFU - ecc_poll.window_sbe)) {
+            ecc_poll.window_sbe = 0xFFFFFFFFU;  // Saturate
+        } else {
+            ecc_poll.window_sbe += (uint32_t)new_sbe;
+        }
+    }
+    
+    // Rate over the elapsed window: window_sbe / elapsed_ms < exit_per_ms
+    elapsed = now - ecc_poll.window_start;
+    if (elapsed >= ECC_POLL_WINDOW_TICKS) {
+        if (ecc_poll.enter_per_ms == 0U ||
+            (uint64_t)ecc_poll.window_sbe * ECC_POLL_WINDOW_TICKS <
+            (uint64_t)ecc_poll.exit_per_ms * elapsed) {
+            primask = hal_irq_save();
+            (void)ecc_set_sbe_fault_mask(false);
+            ecc_poll.polling = false;
+            ecc_poll.mode_switches++;
+            hal_irq_restore(primask);
+        }
+        ecc_poll.window_start = now;
+        ecc_poll.window_sbe = 0U;
+    }
+    
+    return hal_cycle_count() - start;
+}
+
 // ============================================================================
 // End of ECC Fault Handler
 // ============================================================================
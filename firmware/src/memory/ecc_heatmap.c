@@ -0,0 +1,237 @@
+/**
+ * @file ecc_heatmap.c
+ * @brief ECC Error Heatmap (per-bit histogram, top-K failing addresses)
+ *
+ * Keeps the error position and address of every corrected error instead
+ * of discarding them. Reporters: ecc_fault_isr() from the controller's
+ * error FIFO, and the scrubber for software ECC regions.
+ *
+ * Feature: 001-Power-Management-Safety
+ * User Story: US3 - Memory ECC Protection & Diagnostics
+ * ASIL Level: ASIL-B
+ *
+ * Execution Context:
+ * - ecc_heatmap_record(): ecc_fault_isr() or task context with
+ *   interrupts masked (single writer at a time)
+ * - Readers: task context (copies are taken with interrupts masked)
+ *
+ * Timing Budget:
+ * - ecc_heatmap_record(): bin increment plus one pass over the
+ *   ECC_HEATMAP_TOP_K entries (constant, no allocation)
+ *
+ * Top-K algorithm (space-saving, Metwally et al.):
+ * - A tracked address increments its entry
+ * - An untracked address takes a free entry, or replaces the entry with
+ *   the smallest count c and starts at c + 1 with error c
+ * - Any address with more than N / K errors (N = addressed events) is
+ *   guaranteed to be tracked
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "hal/hal_cpu.h"
+#include "memory/ecc_heatmap.h"
+
+// ============================================================================
+// Heatmap State
+// ============================================================================
+
+typedef struct {
+    uint32_t bits[ECC_HEATMAP_BITS];               // Errors per bit position
+    uint32_t unmapped;                             // Positions outside 1-72
+    ecc_heatmap_entry_t top[ECC_HEATMAP_TOP_K];    // Space-saving table
+    uint32_t top_used;                             // Valid entries in top[]
+} ecc_heatmap_state_t;
+
+static ecc_heatmap_state_t heatmap_state;
+
+// ============================================================================
+// Recording
+// ============================================================================
+
+/**
+ * @brief Count one saturating event
+ */
+static inline void heatmap_increment(uint32_t *counter)
+{
+    if (*counter != 0xFFFFFFFFU) {
+        (*counter)++;
+    }
+}
+
+/**
+ * @brief Record one corrected error
+ *
+ * @param error_pos Check-matrix column as reported by ecc_check64():
+ *                  1-64 = data bit + 1, 65-72 = check bit + 65; anything
+ *                  else is counted as unmapped. Hardware syndromes
+ *                  (ERR_STATUS, error FIFO) go through
+ *                  ecc_syndrome_column() first
+ * @param address Word address, or ECC_HEATMAP_NO_ADDRESS if unknown
+ *                (bit histogram only)
+ */
+void ecc_heatmap_record(uint8_t error_pos, uint32_t address)
+{
+    ecc_heatmap_entry_t *top = heatmap_state.top;
+    uint32_t used = heatmap_state.top_used;
+    uint32_t min_idx = 0;
+
+    if (error_pos >= 1U && error_pos <= ECC_HEATMAP_BITS) {
+        heatmap_increment(&heatmap_state.bits[error_pos - 1U]);
+    } else {
+        heatmap_increment(&heatmap_state.unmapped);
+    }
+
+    if (address == ECC_HEATMAP_NO_ADDRESS) {
+        return;
+    }
+    address &= ~0x7UL;
+
+    for (uint32_t i = 0; i < used; i++) {
+        if (top[i].address == address) {
+            heatmap_increment(&top[i].count);
+            return;
+        }
+        if (top[i].count < top[min_idx].count) {
+            min_idx = i;
+        }
+    }
+
+    if (used < ECC_HEATMAP_TOP_K) {
+        top[used].address = address;
+        top[used].count = 1U;
+        top[used].error = 0U;
+        heatmap_state.top_used = used + 1U;
+    } else {
+        top[min_idx].address = address;
+        top[min_idx].error = top[min_idx].count;
+        heatmap_increment(&top[min_idx].count);
+    }
+}
+
+/**
+ * @brief Clear the histogram and the address table
+ */
+void ecc_heatmap_reset(void)
+{
+    hal_irq_disable();
+    memset(&heatmap_state, 0, sizeof(heatmap_state));
+    hal_irq_enable();
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+/**
+ * @brief Copy the per-bit histogram
+ *
+ * @param bins Output, bins[i] = errors at error position i + 1
+ * @param count Number of bins to copy (at most ECC_HEATMAP_BITS)
+ *
+ * @return true if copied, false on NULL or oversized request
+ */
+bool ecc_heatmap_get_bits(uint32_t *bins, size_t count)
+{
+    if (bins == NULL || count > ECC_HEATMAP_BITS) {
+        return false;
+    }
+
+    hal_irq_disable();
+    memcpy(bins, heatmap_state.bits, count * sizeof(bins[0]));
+    hal_irq_enable();
+
+    return true;
+}
+
+/**
+ * @brief Get the number of events with an unmapped error position
+ *
+ * @return Events whose position was outside 1-72
+ */
+uint32_t ecc_heatmap_get_unmapped(void)
+{
+    return heatmap_state.unmapped;
+}
+
+/**
+ * @brief Copy the tracked addresses, most errors first
+ *
+ * @param entries Output array
+ * @param max_entries Capacity of @p entries
+ *
+ * @return Number of entries written
+ */
+size_t ecc_heatmap_get_top(ecc_heatmap_entry_t *entries, size_t max_entries)
+{
+    ecc_heatmap_entry_t snapshot[ECC_HEATMAP_TOP_K];
+    uint32_t used;
+    size_t n;
+
+    if (entries == NULL) {
+        return 0;
+    }
+
+    hal_irq_disable();
+    used = heatmap_state.top_used;
+    memcpy(snapshot, heatmap_state.top, sizeof(snapshot));
+    hal_irq_enable();
+
+    // Insertion sort by count, descending (K is small)
+    for (uint32_t i = 1; i < used; i++) {
+        ecc_heatmap_entry_t entry = snapshot[i];
+        uint32_t j = i;
+
+        while (j > 0U && snapshot[j - 1U].count < entry.count) {
+            snapshot[j] = snapshot[j - 1U];
+            j--;
+        }
+        snapshot[j] = entry;
+    }
+
+    n = (used < max_entries) ? used : max_entries;
+    memcpy(entries, snapshot, n * sizeof(entries[0]));
+
+    return n;
+}
+
+/**
+ * @brief Find an address that has certainly failed repeatedly
+ *
+ * Uses the guaranteed lower bound (count - error), so a reported address
+ * has at least @p threshold corrected errors; candidates for retiring
+ * the region before an MBE.
+ *
+ * @param threshold Minimum guaranteed error count (> 0)
+ * @param address Output: the weakest such address
+ *
+ * @return true if an address reached the threshold
+ */
+bool ecc_heatmap_find_weak(uint32_t threshold, uint32_t *address)
+{
+    ecc_heatmap_entry_t top[ECC_HEATMAP_TOP_K];
+    size_t n = ecc_heatmap_get_top(top, ECC_HEATMAP_TOP_K);
+    uint32_t best = 0;
+    bool found = false;
+
+    if (address == NULL || threshold == 0U) {
+        return false;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        uint32_t guaranteed = top[i].count - top[i].error;
+
+        if (guaranteed >= threshold && guaranteed > best) {
+            best = guaranteed;
+            *address = top[i].address;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+// ============================================================================
+// End of ECC Heatmap
+// ============================================================================
@@ -0,0 +1,371 @@
+/**
+ * @file ecc_scrub_service.c
+ * @brief Time-Sliced Background Memory Scrubber
+ *
+ * Periodically reads every word of the configured SRAM regions so that
+ * latent single-bit errors are found and written back corrected while
+ * they are still correctable. Without scrubbing an SBE stays in memory
+ * until the next access to that word; a second upset in the meantime
+ * makes it an MBE and a P3 fault through ecc_fault_isr().
+ *
+ * Feature: 001-Power-Management-Safety
+ * User Story: US3 - Memory ECC Protection & Diagnostics
+ * ASIL Level: ASIL-B
+ *
+ * Execution Context:
+ * - ecc_scrub_task() from the background/idle task, once per tick
+ * - Configuration from the same task (not reentrant, not ISR-safe)
+ *
+ * Timing Budget:
+ * - ecc_scrub_task(): budget_cycles, plus at most one chunk. Chunks are
+ *   started only while the elapsed time plus the slowest chunk seen so
+ *   far fits the budget; the first chunk of a tick always runs so the
+ *   cursor keeps moving.
+ * - Interrupts are masked only around single word write-backs.
+ *
+ * Error Handling:
+ * - Hardware ECC regions: the controller corrects on read. A rise of its
+ *   SBE total during a chunk makes the scrubber rewrite that chunk, so
+ *   the controller stores re-encoded (corrected) words. MBEs raise the
+ *   ECC interrupt themselves and are only counted here.
+ * - Software ECC regions: words are checked against ecc_encode64();
+ *   single flipped bits are repaired with ecc_check64() and recorded in
+ *   the heatmap with their address, MBEs raise FAULT_TYPE_MEM_ECC in the
+ *   safety FSM.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "hal/hal_cpu.h"
+#include "hal/timebase.h"
+#include "memory/ecc_codec.h"
+#include "memory/ecc_handler.h"
+#include "memory/ecc_heatmap.h"
+#include "memory/ecc_service.h"
+#include "memory/ecc_scrub_service.h"
+#include "safety/safety_fsm.h"
+
+// ============================================================================
+// Scrubber State
+// ============================================================================
+
+typedef struct {
+    bool initialized;                                  // Initialization flag
+    ecc_scrub_region_t regions[ECC_SCRUB_MAX_REGIONS]; // Region table (copy)
+    uint32_t region_count;                             // Valid regions
+    uint32_t chunk_words;                              // Words per chunk
+    uint32_t budget_cycles;                            // Cycles per tick
+    uint32_t max_chunk_cycles;                         // Slowest chunk seen
+    uint32_t region_index;                             // Cursor: region
+    size_t word_index;                                 // Cursor: word
+    uint64_t pass_start_ms;                            // Current pass start
+    uint64_t pass_words;                               // Words per full pass
+    ecc_scrub_stats_t stats;                           // Reported statistics
+} ecc_scrub_state_t;
+
+static ecc_scrub_state_t scrub_state = {
+    .initialized = false,
+    .region_count = 0,
+    .chunk_words = ECC_SCRUB_DEFAULT_CHUNK_WORDS,
+    .budget_cycles = ECC_SCRUB_DEFAULT_BUDGET_CYCLES
+};
+
+// Read sink (keeps hardware region reads from being optimized out)
+static volatile uint64_t scrub_sink;
+
+// ============================================================================
+// Chunk Scrubbing
+// ============================================================================
+
+/**
+ * @brief Take a fresh ECC counter snapshot (all zero if ECC is not up)
+ */
+static void scrub_hw_counters(ecc_status_t *status)
+{
+    ecc_status_invalidate();
+    if (!ecc_get_status(status)) {
+        memset(status, 0, sizeof(*status));
+    }
+}
+
+/**
+ * @brief Scrub a chunk of a hardware ECC region
+ *
+ * Reading a word through the controller corrects it on the bus only; the
+ * stored word stays faulty until it is written. The chunk is rewritten
+ * word by word (read and write with interrupts masked, so an ISR update
+ * of the same word cannot be lost) when the 64-bit SBE total moved, or
+ * when the hardware counter saturated (counts_lost) and can no longer
+ * show new errors. The status shadow is not invalidated per SBE
+ * (interrupts are coalesced, or SBEs are polled), so it is invalidated
+ * before each snapshot: every chunk reads the counter registers twice.
+ */
+static void scrub_chunk_hw(volatile uint64_t *words, uint32_t count)
+{
+    ecc_status_t before, after;
+    uint64_t acc = 0;
+
+    scrub_hw_counters(&before);
+
+    for (uint32_t i = 0; i < count; i++) {
+        acc ^= words[i];
+    }
+    scrub_sink = acc;
+
+    scrub_hw_counters(&after);
+
+    if (after.sbe_total != before.sbe_total || after.counts_lost) {
+        for (uint32_t i = 0; i < count; i++) {
+            hal_irq_disable();
+            words[i] = words[i];
+            hal_irq_enable();
+        }
+        scrub_state.stats.sbe_corrected +=
+            (uint32_t)(after.sbe_total - before.sbe_total);
+    }
+
+    scrub_state.stats.mbe_detected += (uint32_t)(after.mbe_total - before.mbe_total);
+}
+
+/**
+ * @brief Scrub a chunk of a software ECC region
+ *
+ * The chunk is copied once and encoded with the batch encoder; only
+ * words whose check byte differs are examined further. A repair is
+ * written only if the word still holds the value that was checked.
+ */
+static void scrub_chunk_sw(volatile uint64_t *words, uint8_t *ecc, uint32_t count)
+{
+    uint64_t copy[ECC_SCRUB_MAX_CHUNK_WORDS] = {0};  // -O2 cannot prove the loop fills it
+    uint8_t expected[ECC_SCRUB_MAX_CHUNK_WORDS];
+    uint32_t mismatch = 0;
+    ecc_decode_t result;
+
+    for (uint32_t i = 0; i < count; i++) {
+        copy[i] = words[i];
+    }
+    ecc_encode64_batch(copy, expected, count);
+
+    for (uint32_t i = 0; i < count; i++) {
+        mismatch |= (uint32_t)(expected[i] ^ ecc[i]);
+    }
+    if (mismatch == 0U) {
+        return;  // Clean chunk (common case)
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (expected[i] == ecc[i]) {
+            continue;
+        }
+
+        ecc_check64(copy[i], ecc[i], &result);
+
+        if (result.sbe) {
+            hal_irq_disable();
+            if (words[i] == copy[i]) {
+                words[i] = result.data;
+                ecc[i] = ecc_encode64(result.data);
+                scrub_state.stats.sbe_corrected++;
+                ecc_heatmap_record(result.error_pos,
+                                   (uint32_t)(uintptr_t)&words[i]);
+            }
+            hal_irq_enable();
+        } else {
+            scrub_state.stats.mbe_detected++;
+            (void)ecc_fault_record_mbe();
+            fsm_set_fault_flag(FAULT_TYPE_MEM_ECC);
+        }
+    }
+}
+
+/**
+ * @brief Scrub the chunk at the cursor and advance the cursor
+ *
+ * Chunks never span regions. Wrapping past the last region completes a
+ * pass and updates the coverage period and scrub rate.
+ *
+ * @return Words scrubbed
+ */
+static uint32_t scrub_next_chunk(void)
+{
+    const ecc_scrub_region_t *region = &scrub_state.regions[scrub_state.region_index];
+    size_t remaining = region->words - scrub_state.word_index;
+    uint32_t count = (remaining < scrub_state.chunk_words) ?
+                     (uint32_t)remaining : scrub_state.chunk_words;
+    volatile uint64_t *words = &region->base[scrub_state.word_index];
+
+    if (region->ecc == NULL) {
+        scrub_chunk_hw(words, count);
+    } else {
+        scrub_chunk_sw(words, &region->ecc[scrub_state.word_index], count);
+    }
+
+    scrub_state.stats.words_scrubbed += count;
+    scrub_state.word_index += count;
+
+    if (scrub_state.word_index >= region->words) {
+        scrub_state.word_index = 0;
+        scrub_state.region_index++;
+
+        if (scrub_state.region_index >= scrub_state.region_count) {
+            uint64_t now_ms = timebase_ms();
+            uint64_t pass_ms = now_ms - scrub_state.pass_start_ms;
+
+            scrub_state.region_index = 0;
+            scrub_state.pass_start_ms = now_ms;
+            scrub_state.stats.passes_completed++;
+            scrub_state.stats.coverage_period_ms =
+                (pass_ms > 0xFFFFFFFFULL) ? 0xFFFFFFFFU : (uint32_t)pass_ms;
+            if (pass_ms > 0U) {
+                uint64_t rate = (scrub_state.pass_words * 8U * 1000U) / pass_ms;
+                scrub_state.stats.scrub_rate_bps =
+                    (rate > 0xFFFFFFFFULL) ? 0xFFFFFFFFU : (uint32_t)rate;
+            }
+        }
+    }
+
+    return count;
+}
+
+// ============================================================================
+// ECC Scrub Service Functions
+// ============================================================================
+
+/**
+ * @brief Initialize the scrubber with the regions to walk
+ *
+ * The region table is copied; the cursor starts at the first word of the
+ * first region. Tuning (ecc_scrub_configure) is kept across calls.
+ *
+ * @param regions Region table (non-empty regions, 8-byte aligned bases)
+ * @param count Number of regions (1 to ECC_SCRUB_MAX_REGIONS)
+ *
+ * @return true if initialized, false on an invalid region table
+ */
+bool ecc_scrub_init(const ecc_scrub_region_t *regions, size_t count)
+{
+    uint64_t pass_words = 0;
+
+    if (regions == NULL || count == 0U || count > ECC_SCRUB_MAX_REGIONS) {
+        return false;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (regions[i].base == NULL || regions[i].words == 0U ||
+            ((uintptr_t)regions[i].base & 0x7U) != 0U) {
+            return false;
+        }
+        pass_words += regions[i].words;
+    }
+
+    memcpy(scrub_state.regions, regions, count * sizeof(regions[0]));
+    scrub_state.region_count = (uint32_t)count;
+    scrub_state.region_index = 0;
+    scrub_state.word_index = 0;
+    scrub_state.max_chunk_cycles = 0;
+    scrub_state.pass_words = pass_words;
+    scrub_state.pass_start_ms = timebase_ms();
+    memset(&scrub_state.stats, 0, sizeof(scrub_state.stats));
+    scrub_state.initialized = true;
+
+    return true;
+}
+
+/**
+ * @brief Tune scrub speed against CPU time
+ *
+ * Smaller chunks bound the latency added to the tick more tightly;
+ * a larger budget shortens the coverage period (lower MBE probability)
+ * at the cost of CPU time.
+ *
+ * @param chunk_words Words per chunk (1 to ECC_SCRUB_MAX_CHUNK_WORDS)
+ * @param budget_cycles Cycle budget per ecc_scrub_task() call (> 0)
+ *
+ * @return true if applied, false if out of range (unchanged)
+ */
+bool ecc_scrub_configure(uint32_t chunk_words, uint32_t budget_cycles)
+{
+    if (chunk_words == 0U || chunk_words > ECC_SCRUB_MAX_CHUNK_WORDS ||
+        budget_cycles == 0U) {
+        return false;
+    }
+
+    scrub_state.chunk_words = chunk_words;
+    scrub_state.budget_cycles = budget_cycles;
+    scrub_state.max_chunk_cycles = 0;  // Re-learn for the new chunk size
+
+    return true;
+}
+
+/**
+ * @brief Scrub for one tick within the cycle budget
+ *
+ * Resumes at the cursor left by the previous call and stops early at the
+ * end of a pass, so a word is visited at most once per tick.
+ *
+ * @return Words scrubbed in this call (0 if not initialized)
+ */
+uint32_t ecc_scrub_task(void)
+{
+    uint32_t start, elapsed;
+    uint32_t scrubbed = 0;
+
+    if (!scrub_state.initialized) {
+        return 0;
+    }
+
+    start = hal_cycle_count();
+    elapsed = 0;
+
+    do {
+        uint32_t chunk_start = hal_cycle_count();
+        uint32_t chunk_cycles;
+
+        scrubbed += scrub_next_chunk();
+
+        chunk_cycles = hal_cycle_count() - chunk_start;
+        if (chunk_cycles > scrub_state.max_chunk_cycles) {
+            scrub_state.max_chunk_cycles = chunk_cycles;
+        }
+        elapsed = hal_cycle_count() - start;
+
+        if (scrub_state.region_index == 0U && scrub_state.word_index == 0U) {
+            break;  // Pass completed: no point rescanning in the same tick
+        }
+    } while (elapsed < scrub_state.budget_cycles &&
+             scrub_state.max_chunk_cycles <= scrub_state.budget_cycles - elapsed);
+
+    if (elapsed > scrub_state.budget_cycles) {
+        scrub_state.stats.budget_overruns++;
+    }
+    if (elapsed > scrub_state.stats.max_tick_cycles) {
+        scrub_state.stats.max_tick_cycles = elapsed;
+    }
+
+    return scrubbed;
+}
+
+/**
+ * @brief Get scrubber statistics and cursor position
+ *
+ * @param stats Pointer to statistics structure (out)
+ *
+ * @return true if read, false if not initialized or stats is NULL
+ */
+bool ecc_scrub_get_stats(ecc_scrub_stats_t *stats)
+{
+    if (!scrub_state.initialized || stats == NULL) {
+        return false;
+    }
+
+    *stats = scrub_state.stats;
+    stats->region_index = scrub_state.region_index;
+    stats->word_index = (uint32_t)scrub_state.word_index;
+
+    return true;
+}
+
+// ============================================================================
+// End of ECC Scrub Service
+// ============================================================================
@@ -19,31 +19,38 @@
  * Timing Budget:
  * - ecc_init(): < 100μs (initialization only)
  * - ecc_configure(): < 50μs per call
- * - ecc_get_status(): < 10μs (register read)
+ * - ecc_get_status(): < 10μs (register read), a few cycles from the
+ *   status shadow when no ECC interrupt occurred since the last read
+ *
+ * Error Counters:
+ * - Every hardware counter read is folded into 64-bit software totals as
+ *   the delta since the previous read, according to the counter mode
+ *   (saturating, wrapping or clear-on-read, see ecc_controller.v). In
+ *   saturating mode counts beyond 65535 cannot be seen and are flagged
+ *   as lost; wrap and clear-on-read modes need one read per 65535 events.
  */
 
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
+#include "hal/hal_cpu.h"
+#include "hal/reg_access.h"
+#include "hal/timebase.h"
+#include "memory/ecc_service.h"
 
 // ============================================================================
 // Hardware Register Definitions
 // ============================================================================
 
-// ECC Controller Register Base Address
-#define ECC_BASE_ADDR 0x40010000
-
-// Register Offsets
-#define ECC_CTRL_OFFSET     0x00    // Control Register
-#define ECC_SBE_COUNT_OFFSET 0x04   // SBE Counter
-#define ECC_MBE_COUNT_OFFSET 0x08   // MBE Counter
-#define ECC_ERR_STATUS_OFFSET 0x0C  // Error Status
-
-// Register definitions
-volatile uint32_t * const ECC_CTRL = (volatile uint32_t *)(ECC_BASE_ADDR + ECC_CTRL_OFFSET);
-volatile uint32_t * const ECC_SBE_COUNT = (volatile uint32_t *)(ECC_BASE_ADDR + ECC_SBE_COUNT_OFFSET);
-volatile uint32_t * const ECC_MBE_COUNT = (volatile uint32_t *)(ECC_BASE_ADDR + ECC_MBE_COUNT_OFFSET);
-volatile uint32_t * const ECC_ERR_STATUS = (volatile uint32_t *)(ECC_BASE_ADDR + ECC_ERR_STATUS_OFFSET);
+// Register definitions (base address and offsets in memory/ecc_service.h)
+#define ECC_CTRL_REG        (ECC_BASE_ADDR + ECC_CTRL_OFFSET)
+#define ECC_SBE_COUNT_REG   (ECC_BASE_ADDR + ECC_SBE_COUNT_OFFSET)
+#define ECC_MBE_COUNT_REG   (ECC_BASE_ADDR + ECC_MBE_COUNT_OFFSET)
+#define ECC_ERR_STATUS_REG  (ECC_BASE_ADDR + ECC_ERR_STATUS_OFFSET)
+#define ECC_FIFO_STATUS_REG (ECC_BASE_ADDR + ECC_FIFO_STATUS_OFFSET)
+#define ECC_FIFO_POP_REG    (ECC_BASE_ADDR + ECC_FIFO_POP_OFFSET)
+#define ECC_FIFO_ADDR_REG   (ECC_BASE_ADDR + ECC_FIFO_ADDR_OFFSET)
+#define ECC_IRQ_COAL_REG    (ECC_BASE_ADDR + ECC_IRQ_COAL_OFFSET)
 
 // ECC_CTRL Register Bits
 #define ECC_CTRL_ENABLE         0x01    // Bit 0: Enable ECC
@@ -51,6 +58,29 @@ volatile uint32_t * const ECC_ERR_STATUS = (volatile uint32_t *)(ECC_BASE_ADDR +
 #define ECC_CTRL_MBE_IRQ_EN     0x04    // Bit 2: Enable MBE interrupt
 #define ECC_CTRL_SBE_THRESH_MASK 0xF8   // Bits 7:3: SBE threshold
 #define ECC_CTRL_SBE_THRESH_SHIFT 3
+#define ECC_CTRL_COUNTER_MODE_MASK  0x300  // Bits 9:8: Counter mode
+#define ECC_CTRL_COUNTER_MODE_SHIFT 8
+#define ECC_CTRL_SBE_FAULT_MASK 0x400   // Bit 10: SBEs do not raise mem_fault_irq
+
+// IRQ_COAL Register Fields
+#define ECC_IRQ_COAL_COUNT_MASK     0xFFU   // Bits 7:0: Events per interrupt
+#define ECC_IRQ_COAL_TIMEOUT_SHIFT  8       // Bits 31:8: Timeout (cycles)
+
+// FIFO_STATUS / FIFO_POP Register Bits
+#define ECC_FIFO_OVERFLOW       0x80000000UL  // FIFO_STATUS bit 31: overflow (W1C)
+#define ECC_FIFO_POP_VALID      0x80000000UL  // FIFO_POP bit 31: entry valid
+#define ECC_FIFO_POP_MBE        0x00000200UL  // FIFO_POP bit 9: MBE
+#define ECC_FIFO_POP_SBE        0x00000100UL  // FIFO_POP bit 8: SBE
+#define ECC_FIFO_POP_POS_MASK   0x0000007FUL  // FIFO_POP bits 6:0: syndrome
+
+// Hardware counter maximum (16-bit)
+#define ECC_COUNTER_MAX 0xFFFFU
+
+// Status shadow age limit in timebase ticks
+#define ECC_STATUS_MAX_AGE_TICKS ((uint32_t)(ECC_STATUS_MAX_AGE_MS * TIMEBASE_TICKS_PER_MS))
+
+// Register re-reads when an ECC interrupt hits a shadow refresh
+#define ECC_STATUS_REFRESH_RETRIES 2
 
 // ============================================================================
 // ECC Service State
@@ -62,6 +92,8 @@ typedef struct {
     uint8_t sbe_threshold;     // SBE interrupt threshold (0 = disabled)
     uint16_t sbe_error_count;  // Tracked SBE count
     uint16_t mbe_error_count;  // Tracked MBE count
+    uint8_t coal_count;        // Interrupt coalescing: events per interrupt
+    uint32_t coal_timeout;     // Interrupt coalescing: timeout (cycles)
 } ecc_service_state_t;
 
 static ecc_service_state_t ecc_state = {
@@ -69,9 +101,149 @@ static ecc_service_state_t ecc_state = {
     .ecc_enable = 0,
     .sbe_threshold = 0,
     .sbe_error_count = 0,
-    .mbe_error_count = 0
+    .mbe_error_count = 0,
+    .coal_count = ECC_IRQ_COAL_DEFAULT_COUNT,
+    .coal_timeout = ECC_IRQ_COAL_DEFAULT_TIMEOUT
 };
 
+/**
+ * @brief IRQ_COAL register value for the configured coalescing
+ */
+static inline uint32_t ecc_irq_coal_value(void)
+{
+    return ((uint32_t)ecc_state.coal_count & ECC_IRQ_COAL_COUNT_MASK) |
+           (ecc_state.coal_timeout << ECC_IRQ_COAL_TIMEOUT_SHIFT);
+}
+
+// ============================================================================
+// Extended Error Counters
+// ============================================================================
+
+typedef struct {
+    ecc_counter_mode_t mode;   // Hardware counter mode (ECC_CTRL[9:8])
+    uint16_t sbe_last;         // SBE_COUNT delta base
+    uint16_t mbe_last;         // MBE_COUNT delta base
+    uint64_t sbe_total;        // SBEs since init
+    uint64_t mbe_total;        // MBEs since init
+    uint64_t sbe_cleared;      // sbe_total at the last ecc_clear_counters()
+    uint64_t mbe_cleared;      // mbe_total at the last ecc_clear_counters()
+    bool lost;                 // A counter saturated (totals are a lower bound)
+} ecc_counters_t;
+
+static ecc_counters_t ecc_counters = {
+    .mode = ECC_COUNTER_SATURATE
+};
+
+/**
+ * @brief Fold one hardware counter read into a 64-bit total
+ *
+ * - WRAP: delta modulo 65536
+ * - CLEAR_ON_READ: the read value counts from 0 (from the delta base on
+ *   the first read after switching modes)
+ * - SATURATE: delta to the previous read; a smaller value means the
+ *   controller was reset and counts from 0. At 65535 further errors are
+ *   invisible and the counts are flagged as lost.
+ */
+static void ecc_counter_fold(uint16_t hw, uint16_t *last, uint64_t *total)
+{
+    uint16_t delta;
+
+    if (ecc_counters.mode == ECC_COUNTER_WRAP) {
+        delta = (uint16_t)(hw - *last);
+        *last = hw;
+    } else {
+        delta = (hw >= *last) ? (uint16_t)(hw - *last) : hw;
+        *last = (ecc_counters.mode == ECC_COUNTER_CLEAR_ON_READ) ? 0U : hw;
+        if (hw == ECC_COUNTER_MAX) {
+            ecc_counters.lost = true;
+        }
+    }
+
+    *total += delta;
+}
+
+/**
+ * @brief 16-bit since-clear view of a 64-bit total (saturating)
+ */
+static uint16_t ecc_counter_since_clear(uint64_t total, uint64_t cleared)
+{
+    uint64_t count = total - cleared;
+
+    return (count > ECC_COUNTER_MAX) ? (uint16_t)ECC_COUNTER_MAX : (uint16_t)count;
+}
+
+// ============================================================================
+// Status Shadow Cache
+// ============================================================================
+
+// RAM copy of SBE_COUNT, MBE_COUNT and ERR_STATUS. Refreshed and read
+// with interrupts masked: ecc_fault_isr() folds the counters as well (SBE
+// rate check), so a task refresh must not interleave with it.
+typedef struct {
+    bool valid;               // Shadow holds a refresh
+    uint32_t generation;      // g_ecc_status_generation at refresh
+    uint32_t timestamp;       // timebase_ticks32() at refresh
+    uint16_t sbe_count;       // SBE_COUNT[15:0] as last read
+    uint16_t mbe_count;       // MBE_COUNT[15:0] as last read
+    uint32_t err_status;      // ERR_STATUS
+    uint32_t hits;            // Reads served from the shadow
+    uint32_t misses;          // Reads that refreshed from hardware
+} ecc_status_shadow_t;
+
+static ecc_status_shadow_t ecc_shadow = {
+    .valid = false
+};
+
+// Bumped by ecc_fault_isr() through ecc_status_invalidate()
+volatile uint32_t g_ecc_status_generation = 0;
+
+/**
+ * @brief Bring the status shadow up to date if it is stale
+ *
+ * Stale means: never read, an ECC interrupt occurred since the refresh
+ * (generation changed), the shadow is older than ECC_STATUS_MAX_AGE_MS,
+ * or the service invalidated it. The generation is sampled before the
+ * register reads; an interrupt during the reads repeats them (bounded),
+ * and if it still races the old generation is stored so the next read
+ * refreshes again. Every register read is folded into the 64-bit
+ * totals, so no count is dropped when a read is repeated (clear-on-read).
+ *
+ * Context: interrupts masked by the caller (hal_irq_save()), so the fold
+ * of one read and the copy of the 64-bit totals are atomic with respect
+ * to ecc_fault_isr(). Costs at most 3 register reads per retry masked.
+ */
+static void ecc_status_refresh(void)
+{
+    uint32_t now = timebase_ticks32();
+    uint32_t generation = g_ecc_status_generation;
+
+    if (ecc_shadow.valid && generation == ecc_shadow.generation &&
+        (now - ecc_shadow.timestamp) < ECC_STATUS_MAX_AGE_TICKS) {
+        ecc_shadow.hits++;
+        return;
+    }
+
+    ecc_shadow.misses++;
+
+    for (int retry = 0; retry <= ECC_STATUS_REFRESH_RETRIES; retry++) {
+        generation = g_ecc_status_generation;
+        ecc_shadow.sbe_count = (uint16_t)(hal_reg_read32(ECC_SBE_COUNT_REG) & 0xFFFF);
+        ecc_shadow.mbe_count = (uint16_t)(hal_reg_read32(ECC_MBE_COUNT_REG) & 0xFFFF);
+        ecc_shadow.err_status = hal_reg_read32(ECC_ERR_STATUS_REG);
+        ecc_counter_fold(ecc_shadow.sbe_count, &ecc_counters.sbe_last,
+                         &ecc_counters.sbe_total);
+        ecc_counter_fold(ecc_shadow.mbe_count, &ecc_counters.mbe_last,
+                         &ecc_counters.mbe_total);
+        if (generation == g_ecc_status_generation) {
+            break;
+        }
+    }
+
+    ecc_shadow.generation = generation;
+    ecc_shadow.timestamp = now;
+    ecc_shadow.valid = true;
+}
+
 // ============================================================================
 // ECC Service Functions
 // ============================================================================
@@ -95,19 +267,21 @@ bool ecc_init(void)
     }
     
     // Disable ECC during configuration (safety: avoid partial config state)
-    *ECC_CTRL = 0x00;
+    hal_reg_write32(ECC_CTRL_REG, 0x00);
     
     // Set default configuration:
     // - ECC enabled
     // - SBE interrupt threshold = 10
     // - MBE interrupt enabled
     // - SBE interrupt enabled
+    // - Interrupt coalescing: 8 errors / 10μs, MBE immediate
     uint32_t ctrl_val = ECC_CTRL_ENABLE |           // Bit 0: Enable
                         ECC_CTRL_SBE_IRQ_EN |       // Bit 1: SBE IRQ
                         ECC_CTRL_MBE_IRQ_EN |       // Bit 2: MBE IRQ
                         (10 << ECC_CTRL_SBE_THRESH_SHIFT);  // Bits 7:3: Threshold=10
     
-    *ECC_CTRL = ctrl_val;
+    hal_reg_write32(ECC_IRQ_COAL_REG, ecc_irq_coal_value());
+    hal_reg_write32(ECC_CTRL_REG, ctrl_val);  // Bits 9:8: Counter mode SATURATE (reset default)
     
     // Initialize state variables
     ecc_state.ecc_enable = 1;
@@ -116,6 +290,10 @@ bool ecc_init(void)
     ecc_state.mbe_error_count = 0;
     ecc_state.initialized = true;
     
+    ecc_shadow.valid = false;
+    memset(&ecc_counters, 0, sizeof(ecc_counters));
+    ecc_counters.mode = ECC_COUNTER_SATURATE;
+    
     return true;
 }
 
@@ -126,9 +304,10 @@ bool ecc_init(void)
  * - Enable/disable ECC protection
  * - Set SBE interrupt threshold (0 = disabled)
  * - Enable/disable SBE and MBE interrupts
+ * - Interrupt coalescing (IRQ_COAL) as set by ecc_set_irq_coalescing()
  *
  * Execution Time: ~30μs (register write)
- * Thread Safety: Non-atomic (should be called in safe state)
+ * Thread Safety: Task context; ECC_CTRL is written with interrupts masked
  *
  * @param enable ECC enable flag (1 = enable, 0 = disable)
  * @param sbe_threshold SBE interrupt threshold (0-31, 0=disabled)
@@ -140,6 +319,8 @@ bool ecc_init(void)
 bool ecc_configure(uint8_t enable, uint8_t sbe_threshold, 
                    uint8_t sbe_irq_en, uint8_t mbe_irq_en)
 {
+    uint32_t primask;
+    
     // Validation
     if (!ecc_state.initialized) {
         return false;  // Must call ecc_init() first
@@ -167,8 +348,16 @@ bool ecc_configure(uint8_t enable, uint8_t sbe_threshold,
     // Set threshold in upper bits
     ctrl_val |= (sbe_threshold << ECC_CTRL_SBE_THRESH_SHIFT);
     
-    // Write to hardware
-    *ECC_CTRL = ctrl_val;
+    // Keep the counter mode and SBE fault mask (ECC_CTRL is written as a
+    // whole); masked, as ecc_fault_isr() may change the SBE fault mask
+    primask = hal_irq_save();
+    ctrl_val |= ((uint32_t)ecc_counters.mode << ECC_CTRL_COUNTER_MODE_SHIFT);
+    ctrl_val |= (hal_reg_read32(ECC_CTRL_REG) & ECC_CTRL_SBE_FAULT_MASK);
+    
+    // Write to hardware (coalescing first, so it applies once enabled)
+    hal_reg_write32(ECC_IRQ_COAL_REG, ecc_irq_coal_value());
+    hal_reg_write32(ECC_CTRL_REG, ctrl_val);
+    hal_irq_restore(primask);
     
     // Update state
     ecc_state.ecc_enable = enable;
@@ -181,25 +370,21 @@ bool ecc_configure(uint8_t enable, uint8_t sbe_threshold,
  * @brief Get ECC service status
  * 
  * Reads current ECC status including error counters and configuration.
- * Safe to call from any context (read-only).
+ * Served from the status shadow unless it is stale (see
+ * ecc_status_refresh), so repeated polling costs no MMIO reads.
  *
- * Execution Time: ~40μs (4 register reads)
- * Thread Safety: Atomic reads (hardware guarantees)
+ * Execution Time: ~40μs on refresh (3 register reads), RAM copy otherwise
+ * Thread Safety: Task or ISR (refresh and copy with interrupts masked)
  *
  * @param status Pointer to status structure (out)
  *
  * @return true if status read successful
  */
-typedef struct {
-    uint16_t sbe_count;      // Current SBE count
-    uint16_t mbe_count;      // Current MBE count
-    uint8_t last_error_type; // 0=none, 1=SBE, 2=MBE
-    uint8_t last_error_pos;  // Error bit position (1-64, 0=none)
-    bool ecc_enabled;        // ECC enable status
-} ecc_status_t;
-
 bool ecc_get_status(ecc_status_t *status)
 {
+    uint32_t primask;
+    uint32_t err_status;
+    
     // Validation
     if (!ecc_state.initialized) {
         return false;
@@ -209,14 +394,23 @@ bool ecc_get_status(ecc_status_t *status)
         return false;
     }
     
-    // Read error counters (16-bit each)
-    status->sbe_count = (uint16_t)(*ECC_SBE_COUNT & 0xFFFF);
-    status->mbe_count = (uint16_t)(*ECC_MBE_COUNT & 0xFFFF);
+    primask = hal_irq_save();
+    ecc_status_refresh();
     
-    // Read error status
-    uint32_t err_status = *ECC_ERR_STATUS;
+    // Error counters (16-bit since clear, 64-bit since init)
+    status->sbe_count = ecc_counter_since_clear(ecc_counters.sbe_total,
+                                                ecc_counters.sbe_cleared);
+    status->mbe_count = ecc_counter_since_clear(ecc_counters.mbe_total,
+                                                ecc_counters.mbe_cleared);
+    status->sbe_total = ecc_counters.sbe_total;
+    status->mbe_total = ecc_counters.mbe_total;
+    status->counts_lost = ecc_counters.lost;
+    
+    // Error status
+    err_status = ecc_shadow.err_status;
     status->last_error_type = (err_status & 0x03);  // Bits [1:0]
     status->last_error_pos = (err_status >> 8) & 0x7F;  // Bits [14:8]
+    hal_irq_restore(primask);
     
     // Read current ECC enable state
     status->ecc_enabled = ecc_state.ecc_enable ? true : false;
@@ -227,19 +421,23 @@ bool ecc_get_status(ecc_status_t *status)
 /**
  * @brief Clear ECC error counters
  * 
- * Resets SBE and MBE counters. Useful for periodic diagnostics
- * and recovery validation.
+ * Resets the SBE and MBE counts reported by ecc_get_status() and
+ * ecc_get_sbe_count()/ecc_get_mbe_count(). Useful for periodic
+ * diagnostics and recovery validation. The 64-bit totals
+ * (ecc_get_sbe_total()/ecc_get_mbe_total()) keep counting.
  *
  * Execution Time: ~20μs
  * Thread Safety: Non-atomic (should be called in safe state)
  *
- * Note: Hardware counters saturate at max value (65535).
- * Manual clearing prevents overflow detection loss.
+ * Note: Hardware counters are read-only; they are brought up to date
+ * and the current totals become the new zero point.
  *
  * @return true if clear successful
  */
 bool ecc_clear_counters(void)
 {
+    uint32_t primask;
+    
     // Validation
     if (!ecc_state.initialized) {
         return false;
@@ -249,9 +447,14 @@ bool ecc_clear_counters(void)
     ecc_state.sbe_error_count = 0;
     ecc_state.mbe_error_count = 0;
     
-    // Note: Hardware registers are read-only counters
-    // They clear automatically on overflow or can only be reset via
-    // hardware reset. This function updates shadow state only.
+    // Fold pending hardware counts, then restart the since-clear view
+    primask = hal_irq_save();
+    ecc_shadow.valid = false;
+    ecc_status_refresh();
+    ecc_counters.sbe_cleared = ecc_counters.sbe_total;
+    ecc_counters.mbe_cleared = ecc_counters.mbe_total;
+    ecc_counters.lost = false;
+    hal_irq_restore(primask);
     
     return true;
 }
@@ -320,11 +523,19 @@ bool ecc_set_sbe_threshold(uint8_t threshold)
  */
 uint16_t ecc_get_sbe_count(void)
 {
+    uint32_t primask;
+    uint16_t count;
+    
     if (!ecc_state.initialized) {
         return 0;
     }
     
-    return (uint16_t)(*ECC_SBE_COUNT & 0xFFFF);
+    primask = hal_irq_save();
+    ecc_status_refresh();
+    count = ecc_counter_since_clear(ecc_counters.sbe_total, ecc_counters.sbe_cleared);
+    hal_irq_restore(primask);
+    
+    return count;
 }
 
 /**
@@ -336,11 +547,255 @@ uint16_t ecc_get_sbe_count(void)
  */
 uint16_t ecc_get_mbe_count(void)
 {
+    uint32_t primask;
+    uint16_t count;
+    
     if (!ecc_state.initialized) {
         return 0;
     }
     
-    return (uint16_t)(*ECC_MBE_COUNT & 0xFFFF);
+    primask = hal_irq_save();
+    ecc_status_refresh();
+    count = ecc_counter_since_clear(ecc_counters.mbe_total, ecc_counters.mbe_cleared);
+    hal_irq_restore(primask);
+    
+    return count;
+}
+
+/**
+ * @brief Get total SBE error count
+ * 
+ * Returns number of SBE events detected since initialization; not reset
+ * by ecc_clear_counters() and not limited by the 16-bit hardware counter
+ *
+ * @return SBE count since init (lower bound if ecc_get_status() reports
+ *         counts_lost)
+ */
+uint64_t ecc_get_sbe_total(void)
+{
+    uint32_t primask;
+    uint64_t total;
+    
+    if (!ecc_state.initialized) {
+        return 0;
+    }
+    
+    primask = hal_irq_save();
+    ecc_status_refresh();
+    total = ecc_counters.sbe_total;
+    hal_irq_restore(primask);
+    
+    return total;
+}
+
+/**
+ * @brief Get total MBE error count
+ * 
+ * Returns number of MBE events detected since initialization; not reset
+ * by ecc_clear_counters() and not limited by the 16-bit hardware counter
+ *
+ * @return MBE count since init (lower bound if ecc_get_status() reports
+ *         counts_lost)
+ */
+uint64_t ecc_get_mbe_total(void)
+{
+    uint32_t primask;
+    uint64_t total;
+    
+    if (!ecc_state.initialized) {
+        return 0;
+    }
+    
+    primask = hal_irq_save();
+    ecc_status_refresh();
+    total = ecc_counters.mbe_total;
+    hal_irq_restore(primask);
+    
+    return total;
+}
+
+/**
+ * @brief Drain captured errors from the controller's error FIFO
+ * 
+ * Pops up to max_entries entries, oldest first; each costs two register
+ * reads (FIFO_POP, then FIFO_ADDR). Entries left behind stay queued for
+ * the next call. ecc_fault_isr() drains ECC_FIFO_DRAIN_PER_IRQ entries
+ * per interrupt, so one interrupt services a burst of errors.
+ *
+ * Execution Time: ~2 register reads per entry
+ * Context: ISR or task (not both concurrently)
+ *
+ * @param entries Output array
+ * @param max_entries Capacity of @p entries
+ *
+ * @return Number of entries drained (0 if the FIFO is empty)
+ */
+size_t ecc_drain_errors(ecc_error_entry_t *entries, size_t max_entries)
+{
+    size_t n = 0;
+    
+    if (entries == NULL) {
+        return 0;
+    }
+    
+    while (n < max_entries) {
+        uint32_t pop = hal_reg_read32(ECC_FIFO_POP_REG);
+        
+        if ((pop & ECC_FIFO_POP_VALID) == 0U) {
+            break;  // FIFO empty
+        }
+        
+        entries[n].address = hal_reg_read32(ECC_FIFO_ADDR_REG);
+        entries[n].syndrome = (uint8_t)(pop & ECC_FIFO_POP_POS_MASK);
+        entries[n].sbe = ((pop & ECC_FIFO_POP_SBE) != 0U);
+        entries[n].mbe = ((pop & ECC_FIFO_POP_MBE) != 0U);
+        n++;
+    }
+    
+    return n;
+}
+
+/**
+ * @brief Check and clear the error FIFO overflow flag
+ * 
+ * The controller sets the flag when an error arrives while the FIFO is
+ * full; that error's address is lost (the counters still count it).
+ *
+ * @return true if errors were dropped since the last call
+ */
+bool ecc_error_fifo_overflowed(void)
+{
+    if ((hal_reg_read32(ECC_FIFO_STATUS_REG) & ECC_FIFO_OVERFLOW) == 0U) {
+        return false;
+    }
+    
+    hal_reg_write32(ECC_FIFO_STATUS_REG, ECC_FIFO_OVERFLOW);  // Write 1 to clear
+    return true;
+}
+
+/**
+ * @brief Configure ECC interrupt coalescing
+ * 
+ * mem_fault_irq (ecc_fault_isr) then fires once per event_count errors,
+ * or timeout_cycles after the first error not yet signalled, whichever
+ * comes first; an MBE always interrupts immediately. Bounds the interrupt
+ * rate when a stuck bit is read at memory-access rate. Applied now and
+ * kept by ecc_configure().
+ *
+ * @param event_count Errors per interrupt (0 or 1 = one interrupt per error)
+ * @param timeout_cycles Maximum delay in controller clock cycles
+ *                       (1 to ECC_IRQ_COAL_TIMEOUT_MAX; ignored when not
+ *                       coalescing)
+ *
+ * @return true if applied, false if not initialized or out of range (a
+ *         coalescing count without a timeout could delay an SBE forever)
+ */
+bool ecc_set_irq_coalescing(uint8_t event_count, uint32_t timeout_cycles)
+{
+    if (!ecc_state.initialized) {
+        return false;
+    }
+    
+    if (event_count > 1U &&
+        (timeout_cycles == 0U || timeout_cycles > ECC_IRQ_COAL_TIMEOUT_MAX)) {
+        return false;
+    }
+    
+    ecc_state.coal_count = event_count;
+    ecc_state.coal_timeout = (event_count > 1U) ? timeout_cycles : 0U;
+    hal_reg_write32(ECC_IRQ_COAL_REG, ecc_irq_coal_value());
+    
+    return true;
+}
+
+/**
+ * @brief Mask or unmask SBEs on the ECC fault interrupt
+ * 
+ * While masked, SBEs are still counted and captured in the error FIFO
+ * but do not raise mem_fault_irq; ecc_fault_poll_task() collects them
+ * instead. MBEs always interrupt. Kept by ecc_configure().
+ *
+ * Execution Time: 1 register read-modify-write (interrupts masked)
+ * Context: ISR or task; every ECC_CTRL read-modify-write in this file
+ *          runs masked, so none of them can undo another
+ *
+ * @param masked true to stop SBE interrupts, false to restore them
+ *
+ * @return true if applied, false if not initialized
+ */
+bool ecc_set_sbe_fault_mask(bool masked)
+{
+    uint32_t ctrl_val, primask;
+    
+    if (!ecc_state.initialized) {
+        return false;
+    }
+    
+    primask = hal_irq_save();
+    ctrl_val = hal_reg_read32(ECC_CTRL_REG) & ~(uint32_t)ECC_CTRL_SBE_FAULT_MASK;
+    if (masked) {
+        ctrl_val |= ECC_CTRL_SBE_FAULT_MASK;
+    }
+    hal_reg_write32(ECC_CTRL_REG, ctrl_val);
+    hal_irq_restore(primask);
+    
+    return true;
+}
+
+/**
+ * @brief Select the hardware counter mode
+ * 
+ * Pending counts are folded with the old mode first. WRAP or
+ * CLEAR_ON_READ keep the 64-bit totals exact past 65535 as long as the
+ * counters are read (ecc_get_status() or a getter after an ECC
+ * interrupt) at least once per 65535 errors.
+ *
+ * @param mode Counter mode
+ *
+ * @return true if the controller accepted the mode, false if the mode is
+ *         invalid or not supported (controller built with
+ *         COUNTER_MODE_EN = 0; mode stays SATURATE)
+ */
+bool ecc_set_counter_mode(ecc_counter_mode_t mode)
+{
+    uint32_t ctrl_val, primask;
+    
+    if (!ecc_state.initialized) {
+        return false;
+    }
+    
+    if (mode > ECC_COUNTER_CLEAR_ON_READ) {
+        return false;
+    }
+    
+    // Fold what the hardware counted under the current mode; no fold may
+    // run between that and the mode change, and ecc_fault_isr() must not
+    // change the SBE fault mask inside the ECC_CTRL read-modify-write
+    primask = hal_irq_save();
+    ecc_shadow.valid = false;
+    ecc_status_refresh();
+    
+    ctrl_val = (hal_reg_read32(ECC_CTRL_REG) & ~(uint32_t)ECC_CTRL_COUNTER_MODE_MASK) |
+               ((uint32_t)mode << ECC_CTRL_COUNTER_MODE_SHIFT);
+    hal_reg_write32(ECC_CTRL_REG, ctrl_val);
+    
+    // Read back: the mode field is read-only zero without COUNTER_MODE_EN
+    ctrl_val = hal_reg_read32(ECC_CTRL_REG);
+    ecc_counters.mode = (ecc_counter_mode_t)((ctrl_val & ECC_CTRL_COUNTER_MODE_MASK) >>
+                                             ECC_CTRL_COUNTER_MODE_SHIFT);
+    hal_irq_restore(primask);
+    
+    return (ecc_counters.mode == mode);
+}
+
+/**
+ * @brief Query the hardware counter mode
+ *
+ * @return Active counter mode
+ */
+ecc_counter_mode_t ecc_get_counter_mode(void)
+{
+    return ecc_counters.mode;
 }
 
 /**
@@ -348,24 +803,27 @@ uint16_t ecc_get_mbe_count(void)
  * 
  * Performs sanity check on ECC configuration:
  * - Checks enable state
- * - Validates counter values not at max (saturation detection)
+ * - Validates no error counts were lost to counter saturation
  * - Ensures thresholds are reasonable
  *
  * @return true if configuration valid, false if anomaly detected
  */
 bool ecc_validate_config(void)
 {
+    uint32_t primask;
+    bool lost;
+    
     if (!ecc_state.initialized) {
         return false;
     }
     
     // Check for counter saturation (possible data loss)
-    uint16_t sbe_count = ecc_get_sbe_count();
-    uint16_t mbe_count = ecc_get_mbe_count();
-    
-    const uint16_t MAX_COUNT = 0xFFFF;
+    primask = hal_irq_save();
+    ecc_status_refresh();
+    lost = ecc_counters.lost;
+    hal_irq_restore(primask);
     
-    if (sbe_count == MAX_COUNT || mbe_count == MAX_COUNT) {
+    if (lost) {
         // Saturation detected - may indicate persistent errors
         return false;
     }
@@ -378,6 +836,33 @@ bool ecc_validate_config(void)
     return true;
 }
 
+/**
+ * @brief Get status shadow hit/miss counters
+ *
+ * A hit is a status or counter read served from RAM, a miss one that
+ * refreshed the shadow from the ECC registers.
+ *
+ * @param hits Reads served from the shadow (out, may be NULL)
+ * @param misses Reads that went to the registers (out, may be NULL)
+ *
+ * @return true if read, false if not initialized
+ */
+bool ecc_get_status_cache_stats(uint32_t *hits, uint32_t *misses)
+{
+    if (!ecc_state.initialized) {
+        return false;
+    }
+    
+    if (hits != NULL) {
+        *hits = ecc_shadow.hits;
+    }
+    if (misses != NULL) {
+        *misses = ecc_shadow.misses;
+    }
+    
+    return true;
+}
+
 // ============================================================================
 // End of ECC Service Initialization
 // ============================================================================
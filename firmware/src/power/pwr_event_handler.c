@@ -8,13 +8,17 @@
  * Design Specifications (T018):
  *  - VDD fault ISR < 5μs execution
  *  - Re-entrant with nesting level detection
- *  - Sets fault_flags.pwr_fault atomically
+ *  - Sets the VDD bit of fault_flags.word atomically
  *  - P1 (highest) priority fault handling
  */
 
 #include "safety_types.h"
 #include "hal/interrupt_handler.h"
-#include "safety/fault_aggregator.h"
+#include "hal/power_api.h"
+#include "hal/timebase.h"
+#include "power/pwr_event_handler.h"
+#include "safety/fault_event_queue.h"
+#include "safety/safety_fsm.h"
 
 // ============================================================================
 // Internal State
@@ -26,7 +30,7 @@ static volatile uint8_t g_pwr_isr_nesting_level = 0;
 // Power event counter (diagnostics)
 static volatile uint32_t g_pwr_event_count = 0;
 
-// Last VDD fault timestamp (for analysis)
+// Last VDD fault timestamp (64-bit timebase ticks, for analysis)
 static volatile uint64_t g_last_pwr_fault_time = 0;
 
 // ============================================================================
@@ -44,7 +48,7 @@ static volatile uint64_t g_last_pwr_fault_time = 0;
  *  2. Read current fault flags
  *  3. Set VDD fault bit atomically
  *  4. Update timestamp
- *  5. Aggregate faults into state machine
+ *  5. Queue fault event for the safety task
  *  6. Decrement nesting level
  *  7. Trigger context switch if necessary
  *
@@ -71,53 +75,32 @@ void pwr_event_handler_vdd_fault(void) {
     // Critical section: Atomic fault flag update
     // ========================================================================
     
-    // Read current fault flags
-    fault_flags_t current_flags = g_fault_flags;
-    
     // Verify fault flags are in valid state (DCLS check)
-    if (!VERIFY_FAULT_FLAG(&current_flags)) {
-        // Flags corrupted - attempt recovery
-        // Re-initialize with VDD fault set
-        current_flags.pwr_fault = 0x01;
-        current_flags.pwr_fault_complement = 0xFE;
+    if (!fsm_fault_flags_valid()) {
+        // Flags corrupted - the aggregator will report the DCLS failure;
+        // still record the VDD fault so it is not lost
     }
     
-    // Set VDD fault bit (atomic using inline assembly)
-    // This uses ARM Cortex-M4 atomic instructions
-    __asm volatile (
-        "mov r0, #1\n"           // r0 = 1 (VDD fault bit)
-        "ldr r1, =g_fault_flags\n" // r1 = address of fault_flags
-        "ldr r2, [r1]\n"         // Load current value
-        "orr r2, r2, r0\n"       // Set VDD fault bit
-        "str r2, [r1]\n"         // Write back atomically
-        :
-        :
-        : "r0", "r1", "r2", "cc"
-    );
-    
-    // Update complement (dual-channel logic signature protection)
-    g_fault_flags.pwr_fault_complement = (uint8_t)(~g_fault_flags.pwr_fault);
+    // Set VDD fault flag and its complement (DCLS protection)
+    fsm_set_fault_flag(FAULT_TYPE_VDD);
     
     // ========================================================================
     // Timestamp update
     // ========================================================================
     
     // Capture current system tick for analysis
-    g_last_pwr_fault_time = get_system_time_us();
+    g_last_pwr_fault_time = timebase_ticks64();
     
     // Increment event counter
     g_pwr_event_count++;
     
     // ========================================================================
-    // Fault aggregation
+    // Event queue
     // ========================================================================
     
-    // Aggregate new fault into system state
-    fault_aggregate(
-        g_fault_flags.pwr_fault ? 1 : 0,  // VDD fault active
-        0,                                  // No clock fault in this handler
-        0                                   // No memory fault in this handler
-    );
+    // Queue the event for the safety task; aggregation runs there
+    // (fsm_aggregate_faults), not in ISR context
+    (void)fault_event_post(FAULT_EVENT_PWR_HANDLER, 0U);
     
     // ========================================================================
     // Exit: Nesting level decrement
@@ -145,7 +128,7 @@ void pwr_event_handler_vdd_fault(void) {
 // Complement calculation                2     5ns
 // Timestamp read                        5     12.5ns
 // Counter increment                     1     2.5ns
-// Fault aggregation (call)             15     37.5ns
+// Fault event post (SPSC ring)         15     37.5ns
 // Exit (nesting--)                      1     2.5ns
 // ========================================
 // Total (excluding context switch):    44    110ns << 5μs ✓
@@ -175,20 +158,12 @@ void pwr_event_handler_init(void) {
     // Clear last fault timestamp
     g_last_pwr_fault_time = 0;
     
-    // Register ISR with interrupt controller
-    // Vector assignment: IRQ_VDD_FAULT (typically IRQ #32-48 range)
-    interrupt_handler_register_isr(
-        IRQ_VDD_FAULT,
-        pwr_event_handler_vdd_fault,
-        IRQ_PRIORITY_CRITICAL
-    );
-    
-    // Enable VDD fault interrupt at controller
-    interrupt_controller_enable_irq(IRQ_VDD_FAULT);
+    // Configure VDD fault interrupt at controller (P1 = highest priority)
+    // Vector assignment is done by the boot loader
+    (void)interrupt_handler_set_priority(ISR_NUMBER_VDD, 0U);
     
     // Unmask VDD fault source at power controller
-    // (This would be hardware-specific register write)
-    PWR_CTRL->INT_MASK |= (1U << PWR_FAULT_MASK_BIT);
+    (void)power_enable_fault_irq();
 }
 
 // ============================================================================
@@ -226,7 +201,28 @@ uint32_t pwr_event_handler_get_event_count(void) {
  * @return Last fault timestamp in microseconds
  */
 uint64_t pwr_event_handler_get_last_fault_time(void) {
-    return g_last_pwr_fault_time;
+    uint64_t ticks;
+    
+    // 64-bit store in the ISR is two words on Cortex-M4: re-read until
+    // two consecutive reads agree (ISR cannot fire twice within one read)
+    do {
+        ticks = g_last_pwr_fault_time;
+    } while (ticks != g_last_pwr_fault_time);
+    
+    return timebase_ticks_to_us(ticks);
+}
+
+/**
+ * pwr_event_handler_get_last_fault_ticks
+ *
+ * Returns the low word of the last VDD fault timestamp, i.e. the
+ * timebase_ticks32() value at ISR time, for reaction time measurement
+ * (fault_stats_record_latency). One word: no torn read.
+ *
+ * @return Last fault timestamp in ticks (32-bit, wrapping)
+ */
+uint32_t pwr_event_handler_get_last_fault_ticks(void) {
+    return (uint32_t)g_last_pwr_fault_time;
 }
 
 /**
@@ -263,7 +259,7 @@ uint8_t pwr_event_handler_verify(void) {
     // (Previous value stored in test framework)
     
     // Verify fault flags have valid DCLS signature
-    if (!VERIFY_FAULT_FLAG(&g_fault_flags)) {
+    if (!fsm_fault_flags_valid()) {
         return 0;  // Corrupted
     }
     
@@ -275,11 +271,11 @@ uint8_t pwr_event_handler_verify(void) {
 // ============================================================================
 
 // Property 1: Fault flag is always set after ISR execution
-//   after pwr_event_handler_vdd_fault() executes, g_fault_flags.pwr_fault == 1
+//   after pwr_event_handler_vdd_fault() executes,
+//   (fault_flags.word & FAULT_TYPE_VDD) != 0
 //
 // Property 2: DCLS protection maintained
-//   after ISR execution, (g_fault_flags.pwr_fault ^ 
-//                         g_fault_flags.pwr_fault_complement) == 0xFF
+//   after ISR execution, VERIFY_FAULT_FLAGS(fault_flags.word)
 //
 // Property 3: Event counter increments monotonically
 //   for each ISR invocation, g_pwr_event_count increases by exactly 1
@@ -289,5 +285,3 @@ uint8_t pwr_event_handler_verify(void) {
 //
 // Property 5: Execution time < 5μs
 //   measured time from ISR entry to exit < 5μs
-
-#endif  // PWR_EVENT_HANDLER_H
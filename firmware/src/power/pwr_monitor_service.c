@@ -13,8 +13,11 @@
  */
 
 #include "safety_types.h"
+#include "power/pwr_monitor_service.h"
 #include "safety/safety_fsm.h"
 #include "safety/fault_aggregator.h"
+#include "safety/fault_statistics.h"
+#include "power/pwr_event_handler.h"
 #include "hal/power_api.h"
 
 // ============================================================================
@@ -33,16 +36,6 @@
 // Service State Variables
 // ============================================================================
 
-// Current power monitoring state
-typedef enum {
-    PWR_STATE_IDLE = 0x55,
-    PWR_STATE_MONITORING = 0xAA,
-    PWR_STATE_FAULT_DETECTED = 0xCC,
-    PWR_STATE_SAFE_STATE_ACTIVE = 0x33,
-    PWR_STATE_RECOVERY_ACTIVE = 0x99,
-    PWR_STATE_INVALID = 0x00
-} pwr_service_state_t;
-
 // Service state with DCLS protection
 static volatile struct {
     pwr_service_state_t state;
@@ -65,10 +58,16 @@ static volatile uint16_t g_vdd_reading_complement = 0;
 static volatile uint32_t g_service_tick_count = 0;
 static volatile uint32_t g_service_tick_count_complement = 0;
 
+// VDD ISR event count at the last safe state entry (reaction time is
+// measured once per new ISR event, not for polled or repeated entries)
+static uint32_t g_safe_state_vdd_events = 0;
+
 // ============================================================================
 // State Management Functions
 // ============================================================================
 
+static void pwr_service_exit_safe_state(void);
+
 /**
  * pwr_service_verify_state
  *
@@ -208,7 +207,7 @@ static void pwr_service_start_recovery(void) {
     g_recovery_attempt_count_complement = ~g_recovery_attempt_count;
     
     // Transition FSM to RECOVERY state
-    fsm_transition(FAULT_STATE, RECOVERY_STATE);
+    fsm_transition(SAFETY_STATE_RECOVERY);
     
     // Update service state
     pwr_service_set_state(PWR_STATE_RECOVERY_ACTIVE);
@@ -248,9 +247,6 @@ static void pwr_service_complete_recovery(void) {
         return;  // Not recovered yet
     }
     
-    // Transition FSM to NORMAL state
-    fsm_transition(RECOVERY_STATE, NORMAL_STATE);
-    
     // Clear recovery attempt counter
     g_recovery_attempt_count = 0;
     g_recovery_attempt_count_complement = ~g_recovery_attempt_count;
@@ -259,8 +255,8 @@ static void pwr_service_complete_recovery(void) {
     g_recovery_timeout_ticks = 0;
     g_recovery_timeout_ticks_complement = ~g_recovery_timeout_ticks;
     
-    // Return to monitoring
-    pwr_service_set_state(PWR_STATE_MONITORING);
+    // Return to monitoring and transition FSM to NORMAL state
+    pwr_service_exit_safe_state();
 }
 
 // ============================================================================
@@ -276,14 +272,24 @@ static void pwr_service_complete_recovery(void) {
  * @return void
  */
 static void pwr_service_enter_safe_state(void) {
+    uint32_t vdd_events;
+    
     // Update service state
     pwr_service_set_state(PWR_STATE_SAFE_STATE_ACTIVE);
     
     // Request safe state from power API (< 10ms requirement)
     power_enter_safe_state();
     
+    // Reaction time from the VDD ISR (skipped if the FSM already measured it)
+    vdd_events = pwr_event_handler_get_event_count();
+    if (vdd_events != g_safe_state_vdd_events) {
+        g_safe_state_vdd_events = vdd_events;
+        (void)fault_stats_record_latency(FAULT_TYPE_VDD,
+                                         pwr_event_handler_get_last_fault_ticks());
+    }
+    
     // Transition FSM to FAULT state
-    fsm_transition(NORMAL_STATE, FAULT_STATE);
+    fsm_transition(SAFETY_STATE_FAULT);
     
     // Begin recovery attempt
     pwr_service_start_recovery();
@@ -302,7 +308,7 @@ static void pwr_service_exit_safe_state(void) {
     pwr_service_set_state(PWR_STATE_MONITORING);
     
     // Transition FSM to NORMAL state
-    fsm_transition(RECOVERY_STATE, NORMAL_STATE);
+    fsm_transition(SAFETY_STATE_NORMAL);
 }
 
 // ============================================================================
@@ -438,6 +444,8 @@ void pwr_monitor_service_init(void) {
     g_service_tick_count = 0;
     g_service_tick_count_complement = ~g_service_tick_count;
     
+    g_safe_state_vdd_events = pwr_event_handler_get_event_count();
+    
     // Initialize VDD reading
     g_vdd_reading_mv = power_get_voltage_mv();
     g_vdd_reading_complement = ~g_vdd_reading_mv;
@@ -525,5 +533,3 @@ uint32_t pwr_monitor_service_get_tick_count(void) {
 // Average per tick:               ~35    ~87ns
 //
 // Total service overhead per 10ms tick: <150ns (0.0015% of tick)
-
-#endif  // PWR_MONITOR_SERVICE_H
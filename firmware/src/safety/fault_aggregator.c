@@ -3,7 +3,7 @@
  * @brief ISO 26262 Fault Aggregation Implementation
  *
  * Implements atomic fault flag aggregation with priority handling
- * per SysReq-002 fault priority rules:
+ * per SysReq-002 fault priority rules (defaults, runtime configurable):
  *  - P1 (Highest): VDD power supply failure
  *  - P2 (Medium):  Clock loss
  *  - P3 (Lowest):  Memory MBE
@@ -15,23 +15,47 @@
  */
 
 #include "safety_types.h"
+#include "safety/fault_aggregator.h"
+#include "safety/safety_fsm.h"
+#include "safety/fault_priority.h"
+#include "hal/timebase.h"
+#include "hal/hal_cpu.h"
 #include <string.h>
+#if defined(FIRMWARE_HOST_BUILD)
+#include <stdatomic.h>
+#endif
 
 /* ============================================================================
- * External References - defined in safety_fsm.c
+ * Fault Aggregator Module Variables
  * ============================================================================ */
 
-/* Forward declarations - these are defined in safety_fsm.c */
-extern bool fsm_aggregate_faults(void);
-extern bool fsm_clear_faults(fault_type_t faults_to_clear);
-extern bool fsm_get_status(safety_status_t *status);
+/** @brief Upper bound on re-runs for pending requests per lock hold */
+#define FAULT_AGG_MAX_RETRIES 4U
 
-/* ============================================================================
- * Fault Aggregator Module Variables
- * ============================================================================ */
+/** @brief Counter/flag word shared by the lock holder and contenders */
+#if defined(FIRMWARE_HOST_BUILD)
+typedef _Atomic uint32_t fault_agg_word_t;
+#else
+typedef volatile uint32_t fault_agg_word_t;
+#endif
 
 /** @brief Fault aggregation lock (prevents concurrent aggregation) */
-static volatile bool g_aggregator_busy = false;
+static hal_lock_t g_aggregator_lock = HAL_LOCK_INIT;
+
+/** @brief Set by a contender so the holder re-runs before unlocking */
+static fault_agg_word_t g_aggregation_pending = 0;
+
+/** @brief Calls that found the aggregator locked (handed to the holder) */
+static fault_agg_word_t g_aggregation_contentions = 0;
+
+/** @brief Extra aggregation passes run by the holder for contenders */
+static volatile uint32_t g_aggregation_retries = 0;
+
+/** @brief Holds that hit FAULT_AGG_MAX_RETRIES with a request still pending */
+static volatile uint32_t g_aggregation_overruns = 0;
+
+/** @brief Longest lock hold seen (timebase ticks) */
+static volatile uint32_t g_aggregation_max_hold_ticks = 0;
 
 /** @brief Fault priority configuration (runtime configurable) */
 static volatile struct {
@@ -44,11 +68,61 @@ static volatile struct {
     .mem_priority = 3   /* P3 - Lowest */
 };
 
-/** @brief Last aggregation timestamp for statistics */
-static volatile uint32_t g_last_aggregation_ms = 0;
+/** @brief Last aggregation timestamp for statistics (timebase ticks) */
+static volatile uint32_t g_last_aggregation_ticks = 0;
 
 /** @brief Aggregation attempt counter */
-static volatile uint32_t g_aggregation_attempts = 0;
+static fault_agg_word_t g_aggregation_attempts = 0;
+
+/* ============================================================================
+ * Lock Helpers
+ * ============================================================================ */
+
+/** @brief Atomic increment (safe against preempting contenders) */
+static inline void fault_agg_increment(fault_agg_word_t *word)
+{
+#if defined(FIRMWARE_HOST_BUILD)
+    (void)atomic_fetch_add_explicit(word, 1U, memory_order_relaxed);
+#else
+    do {
+        /* retry until no preemption between LDREX and STREX */
+    } while (hal_strex32(hal_ldrex32(word) + 1U, word) != 0U);
+#endif
+}
+
+/** @brief Atomic store of a flag word */
+static inline void fault_agg_store(fault_agg_word_t *word, uint32_t value)
+{
+#if defined(FIRMWARE_HOST_BUILD)
+    atomic_store_explicit(word, value, memory_order_seq_cst);
+#else
+    hal_dmb();
+    *word = value;
+    hal_dmb();
+#endif
+}
+
+/** @brief Atomic load of a flag or counter word */
+static inline uint32_t fault_agg_load(fault_agg_word_t *word)
+{
+#if defined(FIRMWARE_HOST_BUILD)
+    return atomic_load_explicit(word, memory_order_seq_cst);
+#else
+    uint32_t value = *word;
+    hal_dmb();
+    return value;
+#endif
+}
+
+/** @brief Record a lock hold time, keeping the worst case */
+static inline void fault_agg_record_hold(uint32_t start_ticks)
+{
+    uint32_t held = timebase_ticks32() - start_ticks;
+
+    if (held > g_aggregation_max_hold_ticks) {
+        g_aggregation_max_hold_ticks = held;
+    }
+}
 
 /* ============================================================================
  * Fault Aggregation Functions
@@ -58,15 +132,26 @@ static volatile uint32_t g_aggregation_attempts = 0;
  * @brief Aggregate fault flags from all sources
  *
  * Combines individual fault flags into a single aggregated fault status
- * with priority-based handling. Prevents race conditions through atomic
- * operations and spin-lock protection.
+ * with priority-based handling. Thin wrapper over the single-pass engine
+ * fsm_aggregate(), which verifies, aggregates and commits the FSM state
+ * in one pass.
+ *
+ * Concurrency: a non-blocking try-lock (LDREX/STREX on target, C11
+ * atomic_flag on host) serializes the engine. A caller that finds the
+ * lock taken (e.g. an ISR preempting the safety task) raises
+ * g_aggregation_pending and returns false; the holder re-runs the engine
+ * before it lets go, and each pass runs exactly once under the lock. The
+ * re-runs are bounded by FAULT_AGG_MAX_RETRIES to bound the hold time: a
+ * request still pending after the last re-run stays flagged, is counted
+ * in fault_get_overrun_count() and is reported to the holder's caller by
+ * a false return, so the safety task calls again on its next cycle.
  *
  * Aggregation Strategy (SysReq-002):
- *  1. Check all fault flags (pwr_fault, clk_fault, mem_fault)
+ *  1. Check all fault flags (packed flag word)
  *  2. Apply priority ordering: P1 > P2 > P3
  *  3. Determine highest priority active fault
- *  4. Initiate recovery based on priority
- *  5. Update fault statistics
+ *  4. Commit active faults and FSM transition
+ *  5. Update aggregation timestamp
  *
  * Acceptance Criteria:
  *  - Aggregates all 3 fault sources atomically
@@ -75,99 +160,67 @@ static volatile uint32_t g_aggregation_attempts = 0;
  *  - Returns aggregated fault type
  *
  * @param[out] aggregated_faults Pointer to store aggregated fault type
- * @return true if aggregation successful, false if busy or failed
+ * @return true if aggregation ran and nothing is left pending, false if
+ *         handed to the current lock holder, if a request is still pending
+ *         after FAULT_AGG_MAX_RETRIES re-runs (*aggregated_faults holds the
+ *         last pass) or on DCLS failure
  */
 bool fault_aggregate(fault_type_t *aggregated_faults)
 {
-    safety_status_t current_status;
-    fault_type_t result = FAULT_TYPE_NONE;
-    fault_type_t highest_priority_fault;
+    fsm_aggregation_t result;
+    uint32_t start;
+    uint32_t retries = 0;
+    bool ok;
 
     if (aggregated_faults == NULL) {
         return false;
     }
 
-    /* Spin-lock to prevent concurrent aggregation */
-    if (g_aggregator_busy) {
-        return false; /* Aggregation already in progress */
-    }
+    fault_agg_increment(&g_aggregation_attempts);
 
-    g_aggregator_busy = true;
-    g_aggregation_attempts++;
+    /* Announce the request before trying the lock: if the holder is
+     * already past its last pending check, the lock is free for us */
+    fault_agg_store(&g_aggregation_pending, 1U);
 
-    /* Get current safety status with DCLS verification */
-    if (!fsm_get_status(&current_status)) {
-        g_aggregator_busy = false;
-        return false; /* DCLS failure */
+    if (!hal_trylock(&g_aggregator_lock)) {
+        fault_agg_increment(&g_aggregation_contentions);
+        return false; /* Holder will service the pending request */
     }
 
-    /* Step 1: Collect all fault flags */
-    /* Individual fault detection is done by ISR handlers.
-     * Here we just aggregate them according to priority. */
+    for (;;) {
+        start = timebase_ticks32();
+        fault_agg_store(&g_aggregation_pending, 0U);
 
-    /* Check VDD fault (P1 - Highest Priority) */
-    if (VERIFY_FAULT_FLAG(current_status.fault_flags.pwr_fault,
-                          current_status.fault_flags.pwr_fault_cmp)) {
-        if (current_status.fault_flags.pwr_fault) {
-            result |= FAULT_TYPE_VDD;
+        /* Single pass: verify, aggregate, resolve priority, commit */
+        ok = fsm_aggregate(&result);
+        if (ok) {
+            *aggregated_faults = result.highest;
+            g_last_aggregation_ticks = timebase_ticks32();
         }
-    } else {
-        /* DCLS failure in pwr_fault flag */
-        g_aggregator_busy = false;
-        return false;
-    }
 
-    /* Check Clock fault (P2 - Medium Priority) */
-    if (VERIFY_FAULT_FLAG(current_status.fault_flags.clk_fault,
-                          current_status.fault_flags.clk_fault_cmp)) {
-        if (current_status.fault_flags.clk_fault) {
-            result |= FAULT_TYPE_CLK;
-        }
-    } else {
-        /* DCLS failure in clk_fault flag */
-        g_aggregator_busy = false;
-        return false;
-    }
+        fault_agg_record_hold(start);
+        hal_unlock(&g_aggregator_lock);
 
-    /* Check Memory fault (P3 - Lowest Priority) */
-    if (VERIFY_FAULT_FLAG(current_status.fault_flags.mem_fault,
-                          current_status.fault_flags.mem_fault_cmp)) {
-        if (current_status.fault_flags.mem_fault) {
-            result |= FAULT_TYPE_MEM_ECC;
+        /* A contender arrived while we held the lock: serve it now,
+         * unless it (or another caller) took the lock itself */
+        if (fault_agg_load(&g_aggregation_pending) == 0U) {
+            break;
         }
-    } else {
-        /* DCLS failure in mem_fault flag */
-        g_aggregator_busy = false;
-        return false;
-    }
-
-    /* Step 2: Determine highest priority active fault */
-    if (result & FAULT_TYPE_VDD) {
-        highest_priority_fault = FAULT_TYPE_VDD;  /* P1 - Highest */
-    } else if (result & FAULT_TYPE_CLK) {
-        highest_priority_fault = FAULT_TYPE_CLK;  /* P2 - Medium */
-    } else if (result & FAULT_TYPE_MEM_ECC) {
-        highest_priority_fault = FAULT_TYPE_MEM_ECC; /* P3 - Lowest */
-    } else {
-        highest_priority_fault = FAULT_TYPE_NONE;
-    }
-
-    /* Step 3: Update aggregated fault type */
-    *aggregated_faults = highest_priority_fault;
-
-    /* Step 4: Call FSM aggregation to update state machine */
-    if (!fsm_aggregate_faults()) {
-        g_aggregator_busy = false;
-        return false;
+        if (retries >= FAULT_AGG_MAX_RETRIES) {
+            /* Retry budget spent: leave the request flagged for the next
+             * call and tell this caller it is not yet serviced */
+            g_aggregation_overruns++;
+            ok = false;
+            break;
+        }
+        if (!hal_trylock(&g_aggregator_lock)) {
+            break;
+        }
+        retries++;
+        g_aggregation_retries++;
     }
 
-    /* Update timestamp */
-    g_last_aggregation_ms = 0; /* Would be set by timer */
-
-    /* Release lock */
-    g_aggregator_busy = false;
-
-    return true;
+    return ok; /* false on DCLS failure, invalid state or overrun */
 }
 
 /**
@@ -175,7 +228,7 @@ bool fault_aggregate(fault_type_t *aggregated_faults)
  *
  * Returns the current highest-priority active fault, or NONE if no faults.
  *
- * Priority Order (SysReq-002):
+ * Default Priority Order (SysReq-002, see fault_set_priorities):
  *  1. P1 (VDD)  - System-level threat
  *  2. P2 (CLK)  - Synchronicity threat
  *  3. P3 (MEM)  - Data integrity threat
@@ -187,26 +240,16 @@ fault_type_t fault_get_highest_priority(uint8_t *priority)
 {
     safety_status_t status;
     fault_type_t highest_priority_fault;
+    uint8_t level;
 
     if (!fsm_get_status(&status)) {
         if (priority) *priority = 0xFF; /* Error */
         return FAULT_TYPE_INVALID;
     }
 
-    /* Determine highest priority fault */
-    if ((status.active_faults & FAULT_TYPE_VDD) != 0) {
-        highest_priority_fault = FAULT_TYPE_VDD;
-        if (priority) *priority = 1; /* P1 */
-    } else if ((status.active_faults & FAULT_TYPE_CLK) != 0) {
-        highest_priority_fault = FAULT_TYPE_CLK;
-        if (priority) *priority = 2; /* P2 */
-    } else if ((status.active_faults & FAULT_TYPE_MEM_ECC) != 0) {
-        highest_priority_fault = FAULT_TYPE_MEM_ECC;
-        if (priority) *priority = 3; /* P3 */
-    } else {
-        highest_priority_fault = FAULT_TYPE_NONE;
-        if (priority) *priority = 0; /* No fault */
-    }
+    /* Determine highest priority fault (resolver table load) */
+    highest_priority_fault = fault_priority_resolve(status.active_faults, &level);
+    if (priority) *priority = level;
 
     return highest_priority_fault;
 }
@@ -275,27 +318,27 @@ bool fault_is_active(fault_type_t fault_to_check)
  */
 bool fault_aggregator_reset(fault_type_t faults_to_clear)
 {
+    bool ok;
+
     /* Ensure aggregator is not busy */
-    if (g_aggregator_busy) {
+    if (!hal_trylock(&g_aggregator_lock)) {
+        fault_agg_increment(&g_aggregation_contentions);
         return false;
     }
 
-    g_aggregator_busy = true;
-
     /* Clear fault flags through FSM */
-    if (!fsm_clear_faults(faults_to_clear)) {
-        g_aggregator_busy = false;
-        return false;
-    }
+    ok = fsm_clear_faults(faults_to_clear);
 
-    g_aggregator_busy = false;
-    return true;
+    hal_unlock(&g_aggregator_lock);
+    return ok;
 }
 
 /**
  * @brief Set fault priority (runtime configurable)
  *
- * Allows runtime reconfiguration of fault priorities if needed.
+ * Allows runtime reconfiguration of fault priorities if needed. Rebuilds
+ * the priority resolver table used by fault_aggregate() and
+ * fault_get_highest_priority(). Equal levels resolve VDD > CLK > MEM.
  *
  * @param vdd_priority Priority for VDD faults (1-3)
  * @param clk_priority Priority for Clock faults (1-3)
@@ -313,14 +356,17 @@ bool fault_set_priorities(uint8_t vdd_priority, uint8_t clk_priority,
     }
 
     /* Prevent updates during aggregation */
-    if (g_aggregator_busy) {
+    if (!hal_trylock(&g_aggregator_lock)) {
+        fault_agg_increment(&g_aggregation_contentions);
         return false;
     }
 
     g_fault_priorities.vdd_priority = vdd_priority;
     g_fault_priorities.clk_priority = clk_priority;
     g_fault_priorities.mem_priority = mem_priority;
+    (void)fault_priority_build(vdd_priority, clk_priority, mem_priority);
 
+    hal_unlock(&g_aggregator_lock);
     return true;
 }
 
@@ -354,5 +400,46 @@ bool fault_get_priorities(uint8_t *vdd_priority, uint8_t *clk_priority,
  */
 uint32_t fault_get_aggregation_count(void)
 {
-    return g_aggregation_attempts;
+    return fault_agg_load(&g_aggregation_attempts);
+}
+
+/**
+ * @brief Get aggregator lock contention count
+ *
+ * @return Calls that found the aggregator locked
+ */
+uint32_t fault_get_contention_count(void)
+{
+    return fault_agg_load(&g_aggregation_contentions);
+}
+
+/**
+ * @brief Get aggregation retry count
+ *
+ * @return Extra passes the lock holder ran for contending callers
+ */
+uint32_t fault_get_retry_count(void)
+{
+    return g_aggregation_retries;
+}
+
+/**
+ * @brief Get aggregation overrun count
+ *
+ * @return Calls that returned with a request still pending after
+ *         FAULT_AGG_MAX_RETRIES re-runs
+ */
+uint32_t fault_get_overrun_count(void)
+{
+    return g_aggregation_overruns;
+}
+
+/**
+ * @brief Get worst-case aggregator lock hold time
+ *
+ * @return Longest lock hold in microseconds
+ */
+uint32_t fault_get_max_lock_hold_us(void)
+{
+    return (uint32_t)timebase_ticks_to_us(g_aggregation_max_hold_ticks);
 }
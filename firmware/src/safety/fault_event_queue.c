@@ -0,0 +1,245 @@
+/**
+ * @file fault_event_queue.c
+ * @brief Lock-free ISR-to-Safety-Task Fault Event Queue
+ *
+ * Implements one Lamport single-producer/single-consumer ring per
+ * producer (fault_event_producer_t). The producer owns `head`, the
+ * consumer (safety task)
+ * owns `tail`; each index is published with a release store and observed
+ * with an acquire load, so no lock or interrupt masking is needed on
+ * either side.
+ *
+ * Every post is also appended to the flight recorder (one short masked
+ * section), including events the full ring has to drop.
+ *
+ * Compliance:
+ *  - ISO 26262-6:2018 Section 7.4.9 (Freedom from interference)
+ *  - TSR-002 (ISR framework with < 5μs latency)
+ */
+
+#include "safety_types.h"
+#include "safety/fault_event_queue.h"
+#include "safety/flight_recorder.h"
+#include "hal/timebase.h"
+#include <stdatomic.h>
+
+/* ============================================================================
+ * Configuration
+ * ============================================================================ */
+
+/** @brief Cache line / bus burst size used to separate producer and consumer */
+#if defined(FIRMWARE_HOST_BUILD)
+#define FAULT_EVENT_CACHE_LINE 64
+#else
+#define FAULT_EVENT_CACHE_LINE 32
+#endif
+
+#define FAULT_EVENT_QUEUE_MASK (FAULT_EVENT_QUEUE_DEPTH - 1U)
+
+#if (FAULT_EVENT_QUEUE_DEPTH & FAULT_EVENT_QUEUE_MASK) != 0U
+#error "FAULT_EVENT_QUEUE_DEPTH must be a power of two"
+#endif
+
+/* ============================================================================
+ * Ring Storage
+ * ============================================================================ */
+
+/**
+ * @brief SPSC ring for one producer
+ *
+ * Producer-written and consumer-written fields live on separate cache
+ * lines so the ISR never contends with the safety task on the host, and
+ * slot writes never share a line with the consumer index.
+ */
+typedef struct {
+    /* Producer side (fault ISR) */
+    _Alignas(FAULT_EVENT_CACHE_LINE) atomic_uint head;   /*!< Next slot to write */
+    uint32_t posted;                                     /*!< Posts incl. drops (seq) */
+    atomic_uint overflow_count;                          /*!< Events dropped (full) */
+
+    /* Consumer side (safety task) */
+    _Alignas(FAULT_EVENT_CACHE_LINE) atomic_uint tail;   /*!< Next slot to read */
+
+    /* Event slots */
+    _Alignas(FAULT_EVENT_CACHE_LINE) fault_event_t slots[FAULT_EVENT_QUEUE_DEPTH];
+} fault_event_ring_t;
+
+/** @brief Rings indexed by fault_event_producer_t */
+static fault_event_ring_t g_fault_event_rings[FAULT_EVENT_PRODUCERS];
+
+/** @brief Fault source of each producer's events */
+static const fault_type_t g_fault_event_source[FAULT_EVENT_PRODUCERS] = {
+    [FAULT_EVENT_VDD_ISR] = FAULT_TYPE_VDD,
+    [FAULT_EVENT_PWR_HANDLER] = FAULT_TYPE_VDD,
+    [FAULT_EVENT_CLK_ISR] = FAULT_TYPE_CLK,
+    [FAULT_EVENT_CLK_HANDLER] = FAULT_TYPE_CLK,
+    [FAULT_EVENT_MEM_ISR] = FAULT_TYPE_MEM_ECC,
+    [FAULT_EVENT_ECC_ISR] = FAULT_TYPE_MEM_ECC,
+    [FAULT_EVENT_ECC_POLL] = FAULT_TYPE_MEM_ECC,
+};
+
+/* ============================================================================
+ * Queue Functions
+ * ============================================================================ */
+
+/**
+ * @brief Reset all rings and overflow counters
+ */
+void fault_event_queue_init(void)
+{
+    for (uint32_t i = 0; i < FAULT_EVENT_PRODUCERS; i++) {
+        atomic_store_explicit(&g_fault_event_rings[i].head, 0U, memory_order_relaxed);
+        atomic_store_explicit(&g_fault_event_rings[i].tail, 0U, memory_order_relaxed);
+        atomic_store_explicit(&g_fault_event_rings[i].overflow_count, 0U,
+                              memory_order_relaxed);
+        g_fault_event_rings[i].posted = 0U;
+    }
+    atomic_thread_fence(memory_order_release);
+}
+
+/**
+ * @brief Post a fault event from ISR context (producer)
+ *
+ * Execution: ~15 instructions plus the flight recorder write, no loops,
+ * no locks (wait-free).
+ */
+bool fault_event_post(fault_event_producer_t producer, uint16_t info)
+{
+    fault_event_ring_t *ring;
+    fault_type_t source;
+    uint32_t head, tail;
+
+    if ((uint32_t)producer >= FAULT_EVENT_PRODUCERS) {
+        return false;
+    }
+
+    source = g_fault_event_source[producer];
+    flight_recorder_fault(source, info);
+
+    ring = &g_fault_event_rings[producer];
+    head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+    /* Sequence advances on drops too, so the consumer sees the gap */
+    uint8_t seq = (uint8_t)ring->posted++;
+
+    if ((head - tail) >= FAULT_EVENT_QUEUE_DEPTH) {
+        /* Ring full: account the loss, never block the ISR */
+        atomic_store_explicit(&ring->overflow_count,
+            atomic_load_explicit(&ring->overflow_count, memory_order_relaxed) + 1U,
+            memory_order_relaxed);
+        return false;
+    }
+
+    fault_event_t *slot = &ring->slots[head & FAULT_EVENT_QUEUE_MASK];
+    slot->timestamp = timebase_ticks32();
+    slot->source = (uint8_t)source;
+    slot->seq = seq;
+    slot->info = info;
+
+    /* Publish the slot to the consumer */
+    atomic_store_explicit(&ring->head, head + 1U, memory_order_release);
+
+    return true;
+}
+
+/**
+ * @brief Drain up to max events, oldest first across all rings
+ */
+uint32_t fault_event_drain(fault_event_t *events, uint32_t max)
+{
+    uint32_t tail[FAULT_EVENT_PRODUCERS];
+    uint32_t head[FAULT_EVENT_PRODUCERS];
+    uint32_t start[FAULT_EVENT_PRODUCERS];
+    uint32_t available = 0;
+    uint32_t count = 0;
+    uint32_t i;
+
+    if (events == NULL) {
+        return 0U;
+    }
+
+    /* Snapshot what each producer has published */
+    for (i = 0; i < FAULT_EVENT_PRODUCERS; i++) {
+        tail[i] = atomic_load_explicit(&g_fault_event_rings[i].tail,
+                                       memory_order_relaxed);
+        head[i] = atomic_load_explicit(&g_fault_event_rings[i].head,
+                                       memory_order_acquire);
+        start[i] = tail[i];
+        available |= head[i] ^ tail[i];
+    }
+
+    /* Common case in the safety task: nothing queued, no stores */
+    if (available == 0U) {
+        return 0U;
+    }
+
+    /* N-way merge by timestamp (wrap-safe comparison) */
+    while (count < max) {
+        uint32_t best = FAULT_EVENT_PRODUCERS;
+        uint32_t best_ts = 0U;
+
+        for (i = 0; i < FAULT_EVENT_PRODUCERS; i++) {
+            if (tail[i] != head[i]) {
+                uint32_t ts = g_fault_event_rings[i].slots[tail[i] &
+                                  FAULT_EVENT_QUEUE_MASK].timestamp;
+                if (best == FAULT_EVENT_PRODUCERS || (int32_t)(ts - best_ts) < 0) {
+                    best = i;
+                    best_ts = ts;
+                }
+            }
+        }
+
+        if (best == FAULT_EVENT_PRODUCERS) {
+            break;  /* All rings empty */
+        }
+
+        events[count++] = g_fault_event_rings[best].slots[tail[best] &
+                              FAULT_EVENT_QUEUE_MASK];
+        tail[best]++;
+    }
+
+    /* Release consumed slots back to the producers */
+    for (i = 0; i < FAULT_EVENT_PRODUCERS; i++) {
+        if (tail[i] != start[i]) {
+            atomic_store_explicit(&g_fault_event_rings[i].tail, tail[i],
+                                  memory_order_release);
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Number of events currently queued across all sources
+ */
+uint32_t fault_event_pending(void)
+{
+    uint32_t pending = 0;
+
+    for (uint32_t i = 0; i < FAULT_EVENT_PRODUCERS; i++) {
+        pending += atomic_load_explicit(&g_fault_event_rings[i].head,
+                                        memory_order_acquire) -
+                   atomic_load_explicit(&g_fault_event_rings[i].tail,
+                                        memory_order_relaxed);
+    }
+
+    return pending;
+}
+
+/**
+ * @brief Number of events dropped because a ring was full
+ */
+uint32_t fault_event_get_overflow_count(fault_type_t source)
+{
+    uint32_t total = 0;
+
+    for (uint32_t i = 0; i < FAULT_EVENT_PRODUCERS; i++) {
+        if (source == FAULT_TYPE_NONE || g_fault_event_source[i] == source) {
+            total += atomic_load_explicit(&g_fault_event_rings[i].overflow_count,
+                                          memory_order_relaxed);
+        }
+    }
+
+    return total;
+}
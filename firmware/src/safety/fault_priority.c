@@ -0,0 +1,82 @@
+/**
+ * @file fault_priority.c
+ * @brief Branch-Free Fault Priority Resolver Implementation
+ *
+ * Builds the packed mask -> (fault, level) table described in
+ * fault_priority.h. Building runs only on configuration changes, so it
+ * may loop and compare; the hot path (fault_priority_resolve) does not.
+ *
+ * Compliance:
+ *  - SysReq-002 (Fault priority and aggregation)
+ */
+
+#include "safety_types.h"
+#include "safety/fault_priority.h"
+
+/* ============================================================================
+ * Resolver Table
+ * ============================================================================ */
+
+/** @brief Active resolver table (default: P1 VDD > P2 CLK > P3 MEM) */
+volatile uint32_t g_fault_priority_lut = FAULT_PRIORITY_DEFAULT_LUT;
+
+/* ============================================================================
+ * Table Construction
+ * ============================================================================ */
+
+/**
+ * @brief Compute the packed table for a priority configuration
+ *
+ * For each of the 8 masks the winner is the set source with the lowest
+ * level; the strict compare keeps the lower source bit on ties.
+ *
+ * @return Packed table, or 0 if a level is out of range
+ */
+uint32_t fault_priority_compute(uint8_t vdd_priority, uint8_t clk_priority,
+                                uint8_t mem_priority)
+{
+    const uint8_t levels[3] = { vdd_priority, clk_priority, mem_priority };
+    uint32_t lut = 0;
+    uint32_t mask, bit;
+
+    for (bit = 0; bit < 3U; bit++) {
+        if (levels[bit] < 1U || levels[bit] > FAULT_PRIORITY_LEVELS) {
+            return 0U;
+        }
+    }
+
+    for (mask = 1U; mask <= FAULT_TYPE_MULTIPLE; mask++) {
+        uint32_t winner = 0;
+        uint32_t level = FAULT_PRIORITY_LEVELS + 1U;
+
+        for (bit = 0; bit < 3U; bit++) {
+            if ((mask & (1U << bit)) != 0U && levels[bit] < level) {
+                winner = bit + 1U;
+                level = levels[bit];
+            }
+        }
+
+        lut |= ((level << 2) | winner) << (mask * FAULT_PRIORITY_ENTRY_BITS);
+    }
+
+    return lut;
+}
+
+/**
+ * @brief Rebuild and publish the resolver table
+ *
+ * @return true if published, false if a level is out of range
+ */
+bool fault_priority_build(uint8_t vdd_priority, uint8_t clk_priority,
+                          uint8_t mem_priority)
+{
+    uint32_t lut = fault_priority_compute(vdd_priority, clk_priority, mem_priority);
+
+    if (lut == 0U) {
+        return false;
+    }
+
+    /* Single aligned word store: readers see the old or the new table */
+    g_fault_priority_lut = lut;
+    return true;
+}
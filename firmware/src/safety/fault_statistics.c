@@ -7,12 +7,31 @@
  *
  * DC = (Faults detected) / (Faults detected + Faults not detected)
  *
+ * Fault rates (per type, clocked by fault_stats_update_uptime()):
+ *  - 61 one-minute buckets: current minute plus the last 60
+ *  - 25 one-hour buckets: current hour plus the last 24
+ *  - Running sums of the current plus 59 minutes / 23 hours; a query adds
+ *    the oldest bucket weighted by its part still inside the window
+ *  - EWMA of faults per minute (Q16.16), updated at each minute boundary
+ *  - Record: O(1). Advancing the clock: O(1) per elapsed minute, capped
+ *    (beyond one day of silence the rings are simply cleared)
+ *
+ * Fault reaction latency (per type): time from the ISR timestamp to the
+ * safe-state reaction, recorded into a log-linear histogram
+ * (latency_histogram.h) by fsm_aggregate() at the NORMAL -> FAULT
+ * transition and by the power service at power_enter_safe_state(). One
+ * sample per detection: the first reaction to it is measured, later ones
+ * see a detection older than the last reaction and are skipped.
+ *
  * Compliance:
  *  - ISO 26262-1:2018 Annex C (DC calculation)
  *  - ASPICE CL3 D.6.1 (Metrics and measurement)
  */
 
 #include "safety_types.h"
+#include "safety/fault_statistics.h"
+#include "safety/latency_histogram.h"
+#include "hal/timebase.h"
 #include <string.h>
 #include <stdint.h>
 
@@ -37,6 +56,174 @@ static volatile fault_statistics_t g_fault_stats = {
 /** @brief Statistics update lock */
 static volatile bool g_stats_locked = false;
 
+/* ============================================================================
+ * Fault Rate Windows
+ * ============================================================================ */
+
+#define FAULT_STATS_TYPES       3U
+#define FAULT_RATE_MINUTE_MS    60000ULL
+#define FAULT_RATE_HOUR_MS      3600000ULL
+#define FAULT_RATE_MINUTE_SLOTS 61U   /* Current + last 60 minutes */
+#define FAULT_RATE_HOUR_SLOTS   25U   /* Current + last 24 hours */
+#define FAULT_RATE_DAY_MINUTES  1440U
+
+/** @brief Minutes after which every bucket and the EWMA are zero anyway */
+#define FAULT_RATE_IDLE_RESET_MINUTES \
+    ((uint64_t)FAULT_RATE_HOUR_SLOTS * 60U + FAULT_RATE_MINUTE_SLOTS)
+
+/**
+ * @struct fault_rate_ring_t
+ * @brief Bucket rings and running sums of one fault type
+ */
+typedef struct {
+    uint32_t minute[FAULT_RATE_MINUTE_SLOTS];  /*!< Faults per minute */
+    uint32_t hour[FAULT_RATE_HOUR_SLOTS];      /*!< Faults per hour */
+    uint32_t sum_1h;                           /*!< Current + last 59 minutes */
+    uint32_t sum_24h;                          /*!< Current + last 23 hours */
+    uint32_t ewma_q16;                         /*!< Faults per minute, Q16.16 */
+} fault_rate_ring_t;
+
+/** @brief Rate rings per fault type (VDD, CLK, MEM) */
+static fault_rate_ring_t g_fault_rates[FAULT_STATS_TYPES];
+
+/** @brief Absolute minute (uptime / 1 min) of the current buckets */
+static uint64_t g_rate_minute = 0;
+
+/**
+ * @brief Map a fault type to its rate ring and latency histogram index
+ *
+ * @return Index, or FAULT_STATS_TYPES for an unsupported type
+ */
+static uint32_t fault_type_index(fault_type_t fault_type)
+{
+    switch (fault_type) {
+        case FAULT_TYPE_VDD:
+            return 0U;
+        case FAULT_TYPE_CLK:
+            return 1U;
+        case FAULT_TYPE_MEM_ECC:
+            return 2U;
+        default:
+            return FAULT_STATS_TYPES;
+    }
+}
+
+/**
+ * @brief Close the current minute and open the next one (all types)
+ */
+static void fault_rate_step_minute(void)
+{
+    uint64_t m = g_rate_minute;
+    uint32_t cur = (uint32_t)(m % FAULT_RATE_MINUTE_SLOTS);
+    uint32_t leaving = (uint32_t)((m + 2U) % FAULT_RATE_MINUTE_SLOTS);  /* m - 59 */
+    uint32_t next = (uint32_t)((m + 1U) % FAULT_RATE_MINUTE_SLOTS);    /* held m - 60 */
+    bool new_hour = (((m + 1U) % 60U) == 0U);
+    uint64_t h = (m + 1U) / 60U;                                        /* Next hour */
+    uint32_t h_leaving = (uint32_t)((h + 1U) % FAULT_RATE_HOUR_SLOTS);  /* h - 24 */
+    uint32_t h_next = (uint32_t)(h % FAULT_RATE_HOUR_SLOTS);
+    uint32_t t;
+
+    for (t = 0; t < FAULT_STATS_TYPES; t++) {
+        fault_rate_ring_t *ring = &g_fault_rates[t];
+        int64_t delta = ((int64_t)ring->minute[cur] << 16) - (int64_t)ring->ewma_q16;
+
+        /* EWMA over completed minutes: ewma += (count - ewma) / 2^shift */
+        ring->ewma_q16 = (uint32_t)((int64_t)ring->ewma_q16 +
+                                    delta / (1 << FAULT_RATE_EWMA_SHIFT));
+
+        ring->sum_1h -= ring->minute[leaving];
+        ring->minute[next] = 0U;
+
+        if (new_hour) {
+            /* Hour h - 24 leaves the running sum once hour h opens, hour
+             * h - 25 (same slot as h) is overwritten */
+            ring->sum_24h -= ring->hour[h_leaving];
+            ring->hour[h_next] = 0U;
+        }
+    }
+
+    g_rate_minute = m + 1U;
+}
+
+/**
+ * @brief Advance the rate buckets to the given uptime
+ *
+ * Caller holds g_stats_locked. Uptime going backwards is ignored.
+ */
+static void fault_rate_advance(uint64_t uptime_ms)
+{
+    uint64_t target = uptime_ms / FAULT_RATE_MINUTE_MS;
+
+    if (target <= g_rate_minute) {
+        return;
+    }
+
+    if (target - g_rate_minute >= FAULT_RATE_IDLE_RESET_MINUTES) {
+        memset(g_fault_rates, 0, sizeof(g_fault_rates));
+        g_rate_minute = target;
+        return;
+    }
+
+    while (g_rate_minute < target) {
+        fault_rate_step_minute();
+    }
+}
+
+/**
+ * @brief Count one detected fault in the current buckets
+ *
+ * Caller holds g_stats_locked.
+ */
+static void fault_rate_record(uint32_t index)
+{
+    fault_rate_ring_t *ring = &g_fault_rates[index];
+
+    fault_rate_advance(g_fault_stats.uptime_ms);
+
+    ring->minute[g_rate_minute % FAULT_RATE_MINUTE_SLOTS]++;
+    ring->hour[(g_rate_minute / 60U) % FAULT_RATE_HOUR_SLOTS]++;
+    ring->sum_1h++;
+    ring->sum_24h++;
+}
+
+/* ============================================================================
+ * Fault Reaction Latency
+ * ============================================================================ */
+
+/** @brief Reaction time histograms per fault type (VDD, CLK, MEM) */
+static latency_hist_t g_fault_latency[FAULT_STATS_TYPES];
+
+/** @brief timebase_ticks64() of the last measured reaction per type */
+static uint64_t g_latency_handled_ticks[FAULT_STATS_TYPES];
+
+/**
+ * @brief Fill a latency summary from a type's histogram
+ */
+static void fault_latency_summarize(uint32_t index,
+                                    fault_latency_summary_t *summary)
+{
+    const latency_hist_t *hist = &g_fault_latency[index];
+
+    summary->samples = hist->total;
+    summary->p50_us = latency_hist_value_at(hist, LATENCY_HIST_P50);
+    summary->p99_us = latency_hist_value_at(hist, LATENCY_HIST_P99);
+    summary->p999_us = latency_hist_value_at(hist, LATENCY_HIST_P999);
+    summary->max_us = hist->max_us;
+}
+
+/**
+ * @brief Weight a bucket by the part of it still inside a sliding window
+ *
+ * @param count Faults in the oldest bucket of the window
+ * @param elapsed_ms Time since the current bucket opened
+ * @param width_ms Bucket width
+ */
+static uint32_t fault_rate_tail(uint32_t count, uint64_t elapsed_ms,
+                                uint64_t width_ms)
+{
+    return (uint32_t)(((uint64_t)count * (width_ms - elapsed_ms)) / width_ms);
+}
+
 /* ============================================================================
  * Statistics Update Functions
  * ============================================================================ */
@@ -73,6 +260,8 @@ bool fault_stats_record_detected(fault_type_t fault_type)
             return false;
     }
 
+    fault_rate_record(fault_type_index(fault_type));
+
     g_fault_stats.last_update_ms = 0; /* Would be set by timer */
     g_stats_locked = false;
 
@@ -160,6 +349,60 @@ bool fault_stats_record_recovery_failure(void)
     return true;
 }
 
+/**
+ * @brief Record the reaction time to a detected fault
+ *
+ * Called when the safe-state reaction completes: the NORMAL -> FAULT
+ * transition (fsm_aggregate) or power_enter_safe_state(). The latency is
+ * measured from the detection timestamp to now.
+ *
+ * A detection at or before the last measured reaction of the same type
+ * was already served by that reaction and is not recorded again, so a
+ * fault seen by both reaction paths counts once.
+ *
+ * Execution Time: O(1)
+ *
+ * @param fault_type FAULT_TYPE_VDD, FAULT_TYPE_CLK or FAULT_TYPE_MEM_ECC
+ * @param detect_ticks timebase_ticks32() taken by the fault ISR (less than
+ *        one counter wrap ago)
+ * @return true if a sample was recorded, false on invalid type, locked,
+ *         or detection already measured
+ */
+bool fault_stats_record_latency(fault_type_t fault_type, uint32_t detect_ticks)
+{
+    uint32_t index = fault_type_index(fault_type);
+    uint64_t now, detected;
+    uint32_t elapsed;
+
+    if (index >= FAULT_STATS_TYPES) {
+        return false;
+    }
+
+    if (g_stats_locked) {
+        return false;
+    }
+
+    g_stats_locked = true;
+
+    now = timebase_ticks64();
+    elapsed = (uint32_t)now - detect_ticks;
+    detected = now - elapsed;
+
+    if (g_latency_handled_ticks[index] != 0U &&
+        detected <= g_latency_handled_ticks[index]) {
+        g_stats_locked = false;
+        return false;
+    }
+
+    g_latency_handled_ticks[index] = now;
+    latency_hist_record(&g_fault_latency[index],
+                        (uint32_t)timebase_ticks_to_us(elapsed));
+
+    g_stats_locked = false;
+
+    return true;
+}
+
 /* ============================================================================
  * DC (Diagnostic Coverage) Calculation Functions
  * ============================================================================ */
@@ -272,6 +515,7 @@ bool fault_stats_calculate_overall_dc(uint8_t *dc_percent)
  *  - Returns complete fault_statistics_t structure
  *  - Thread-safe with spin-lock protection
  *  - Includes all fault types and recovery outcomes
+ *  - Includes the reaction time percentiles per fault type
  *
  * @param[out] stats Pointer to output statistics structure
  * @return true if copy successful
@@ -299,6 +543,11 @@ bool fault_stats_get_statistics(fault_statistics_t *stats)
     stats->uptime_ms = g_fault_stats.uptime_ms;
     stats->last_update_ms = g_fault_stats.last_update_ms;
 
+    /* Reaction time percentiles (histogram walk, query side only) */
+    fault_latency_summarize(fault_type_index(FAULT_TYPE_VDD), &stats->vdd_latency);
+    fault_latency_summarize(fault_type_index(FAULT_TYPE_CLK), &stats->clk_latency);
+    fault_latency_summarize(fault_type_index(FAULT_TYPE_MEM_ECC), &stats->mem_latency);
+
     return true;
 }
 
@@ -366,6 +615,10 @@ bool fault_stats_reset(void)
     g_stats_locked = true;
 
     memset((void *)&g_fault_stats, 0, sizeof(g_fault_stats));
+    memset(g_fault_rates, 0, sizeof(g_fault_rates));
+    g_rate_minute = 0;
+    memset(g_fault_latency, 0, sizeof(g_fault_latency));
+    memset(g_latency_handled_ticks, 0, sizeof(g_latency_handled_ticks));
 
     g_stats_locked = false;
 
@@ -376,6 +629,7 @@ bool fault_stats_reset(void)
  * @brief Update system uptime
  *
  * Called periodically by system timer to track total operating time.
+ * Also clocks the fault rate buckets, so rates decay without new faults.
  *
  * @param uptime_ms Current system uptime in milliseconds
  * @return true if update successful
@@ -388,6 +642,7 @@ bool fault_stats_update_uptime(uint64_t uptime_ms)
 
     g_stats_locked = true;
     g_fault_stats.uptime_ms = uptime_ms;
+    fault_rate_advance(uptime_ms);
     g_stats_locked = false;
 
     return true;
@@ -396,32 +651,129 @@ bool fault_stats_update_uptime(uint64_t uptime_ms)
 /**
  * @brief Get fault rate (faults per hour)
  *
- * Calculates fault occurrence rate normalized to per-hour metric
- * for reliability analysis.
+ * Faults of all types detected in the last hour (sliding window), for
+ * reliability analysis. Saturates at 65535.
  *
  * @param[out] fph Pointer to store faults per hour
- * @return true if calculation successful
+ * @return true if calculation successful, false if NULL or locked
  */
 bool fault_stats_get_fault_rate_per_hour(uint16_t *fph)
 {
-    uint32_t total_faults;
-    uint64_t uptime_hours;
+    fault_rate_t rate;
+    uint32_t total = 0;
+    fault_type_t types[FAULT_STATS_TYPES] = {
+        FAULT_TYPE_VDD, FAULT_TYPE_CLK, FAULT_TYPE_MEM_ECC
+    };
+    uint32_t t;
 
     if (fph == NULL) {
         return false;
     }
 
-    total_faults = fault_stats_get_total_faults();
+    for (t = 0; t < FAULT_STATS_TYPES; t++) {
+        if (!fault_stats_get_fault_rate(types[t], &rate)) {
+            return false;
+        }
+        total += rate.last_1h;
+    }
 
-    /* Convert uptime from ms to hours */
-    uptime_hours = g_fault_stats.uptime_ms / (1000 * 60 * 60);
+    *fph = (total > 0xFFFFU) ? 0xFFFFU : (uint16_t)total;
 
-    if (uptime_hours == 0) {
-        *fph = 0;
-        return true;
+    return true;
+}
+
+/**
+ * @brief Get the windowed fault rate of one fault type
+ *
+ * Counts are sliding-window estimates: the current bucket plus the
+ * complete buckets inside the window, plus the oldest bucket weighted by
+ * the fraction of it still inside. Exact at bucket boundaries.
+ *
+ * Trend: accelerating when the per-minute EWMA exceeds
+ * FAULT_RATE_TREND_FACTOR times the mean per minute of the last 24h (or
+ * of the uptime, if shorter) with at least FAULT_RATE_TREND_MIN_FAULTS
+ * faults in the last hour - e.g. SBEs of a degrading memory module.
+ *
+ * Execution Time: O(1) (plus catching up elapsed minutes)
+ *
+ * @param fault_type FAULT_TYPE_VDD, FAULT_TYPE_CLK or FAULT_TYPE_MEM_ECC
+ * @param[out] rate Pointer to store the rate
+ * @return true if successful, false on invalid type, NULL or locked
+ */
+bool fault_stats_get_fault_rate(fault_type_t fault_type, fault_rate_t *rate)
+{
+    uint32_t index = fault_type_index(fault_type);
+    const fault_rate_ring_t *ring;
+    uint64_t uptime, m, minute_ms, hour_ms, day_minutes;
+
+    if (rate == NULL || index >= FAULT_STATS_TYPES) {
+        return false;
+    }
+
+    if (g_stats_locked) {
+        return false;
     }
 
-    *fph = (uint16_t)(total_faults * 3600 / g_fault_stats.uptime_ms);
+    g_stats_locked = true;
+
+    uptime = g_fault_stats.uptime_ms;
+    fault_rate_advance(uptime);
+    ring = &g_fault_rates[index];
+    m = g_rate_minute;
+    minute_ms = uptime % FAULT_RATE_MINUTE_MS;
+    hour_ms = uptime % FAULT_RATE_HOUR_MS;
+
+    rate->last_1min = ring->minute[m % FAULT_RATE_MINUTE_SLOTS] +
+        fault_rate_tail(ring->minute[(m + FAULT_RATE_MINUTE_SLOTS - 1U) %
+                                     FAULT_RATE_MINUTE_SLOTS],
+                        minute_ms, FAULT_RATE_MINUTE_MS);
+    rate->last_1h = ring->sum_1h +
+        fault_rate_tail(ring->minute[(m + 1U) % FAULT_RATE_MINUTE_SLOTS],  /* m - 60 */
+                        minute_ms, FAULT_RATE_MINUTE_MS);
+    rate->last_24h = ring->sum_24h +
+        fault_rate_tail(ring->hour[(m / 60U + 1U) % FAULT_RATE_HOUR_SLOTS],  /* h - 24 */
+                        hour_ms, FAULT_RATE_HOUR_MS);
+    rate->ewma_per_min_x100 = (uint32_t)(((uint64_t)ring->ewma_q16 * 100U) >> 16);
+
+    /* ewma > factor * last_24h / day_minutes, without division */
+    day_minutes = (m < FAULT_RATE_DAY_MINUTES) ? ((m == 0U) ? 1U : m) :
+                                                 FAULT_RATE_DAY_MINUTES;
+    rate->accelerating = (rate->last_1h >= FAULT_RATE_TREND_MIN_FAULTS) &&
+        ((uint64_t)ring->ewma_q16 * day_minutes >
+         ((uint64_t)FAULT_RATE_TREND_FACTOR * rate->last_24h) << 16);
+
+    g_stats_locked = false;
+
+    return true;
+}
+
+/**
+ * @brief Get a snapshot of one fault type's reaction time histogram
+ *
+ * The snapshot has the fixed latency_hist_t layout, so snapshots of
+ * several ECUs or power cycles merge with latency_hist_merge() into one
+ * distribution (fleet-wide p99.9).
+ *
+ * @param fault_type FAULT_TYPE_VDD, FAULT_TYPE_CLK or FAULT_TYPE_MEM_ECC
+ * @param[out] snapshot Pointer to store the histogram
+ * @return true if successful, false on invalid type, NULL or locked
+ */
+bool fault_stats_get_latency_histogram(fault_type_t fault_type,
+                                       latency_hist_t *snapshot)
+{
+    uint32_t index = fault_type_index(fault_type);
+
+    if (snapshot == NULL || index >= FAULT_STATS_TYPES) {
+        return false;
+    }
+
+    if (g_stats_locked) {
+        return false;
+    }
+
+    g_stats_locked = true;
+    memcpy(snapshot, &g_fault_latency[index], sizeof(*snapshot));
+    g_stats_locked = false;
 
     return true;
 }
@@ -0,0 +1,242 @@
+/**
+ * @file flight_recorder.c
+ * @brief Reset-Surviving Binary Flight Recorder
+ *
+ * One writer at a time: every write runs with interrupts masked (PRIMASK
+ * saved and restored, so it nests inside ISRs and masked sections). The
+ * record is complete before head advances, so a reset in the middle of a
+ * write loses at most that record; head and head_cmp are stored back to
+ * back, and a reset between them fails the complement check at boot.
+ *
+ * Host build: the region is ordinary zero-initialized data, i.e. every
+ * process start is a power-on; calling flight_recorder_init() again
+ * models a warm reset.
+ *
+ * Compliance:
+ *  - ISO 26262-6:2018 Section 7.4.12 (Freedom from interference)
+ */
+
+#include "safety/flight_recorder.h"
+#include "hal/hal_cpu.h"
+#include "hal/timebase.h"
+#include <string.h>
+
+#if defined(FIRMWARE_HOST_BUILD)
+#define FLIGHT_RECORDER_NOINIT
+#else
+#define FLIGHT_RECORDER_NOINIT __attribute__((section(".noinit")))
+#endif
+
+/** @brief Recorder region (not cleared by the startup code) */
+static flight_recorder_t g_flight_recorder FLIGHT_RECORDER_NOINIT;
+
+/** @brief Set once the region is valid for this boot (.bss, cleared) */
+static volatile bool g_flight_recorder_ready = false;
+
+/**
+ * @brief Oldest record number still in the ring
+ */
+static uint32_t flight_recorder_oldest(uint32_t head)
+{
+    return (head > FLIGHT_RECORDER_CAPACITY) ? (head - FLIGHT_RECORDER_CAPACITY) : 0U;
+}
+
+/**
+ * @brief Store head and its complement
+ */
+static void flight_recorder_set_head(uint32_t head)
+{
+    g_flight_recorder.head = head;
+    g_flight_recorder.head_cmp = ~head;
+}
+
+/**
+ * @brief Append one record (ISR-safe, no loops)
+ */
+static void flight_recorder_write(uint8_t kind, uint8_t source,
+                                  uint8_t before, uint8_t after,
+                                  uint16_t syndrome)
+{
+    flight_recorder_t *fr = &g_flight_recorder;
+    flight_record_t *rec;
+    uint64_t now, delta;
+    uint32_t primask, head;
+
+    if (!g_flight_recorder_ready) {
+        return;  /* Region not checked yet: may hold garbage */
+    }
+
+    primask = hal_irq_save();
+
+    now = timebase_ticks64();
+    delta = (kind == FLIGHT_RECORD_BOOT) ? 0U : (now - fr->last_ticks);
+    head = fr->head;
+
+    rec = &fr->records[head & FLIGHT_RECORDER_MASK];
+    rec->delta_ticks = (delta > FLIGHT_RECORDER_DELTA_SATURATED) ?
+                       (uint32_t)FLIGHT_RECORDER_DELTA_SATURATED : (uint32_t)delta;
+    rec->seq = (uint16_t)head;
+    rec->syndrome = syndrome;
+    rec->kind = kind;
+    rec->source = source;
+    rec->state_before = before;
+    rec->state_after = after;
+
+    fr->last_ticks = now;
+    fr->state = after;
+    flight_recorder_set_head(head + 1U);
+
+    hal_irq_restore(primask);
+}
+
+/**
+ * @brief Preserve or format the ring (boot, from fsm_init)
+ *
+ * Preserved: header CRC, layout and head complement valid. The boot count
+ * is incremented (header CRC rewritten) and a BOOT record appended with
+ * the FSM state at the reset. Otherwise the region is formatted.
+ *
+ * @return true if a valid ring from before the reset was preserved
+ */
+bool flight_recorder_init(void)
+{
+    flight_recorder_t *fr = &g_flight_recorder;
+    uint32_t primask = hal_irq_save();
+    bool preserved = flight_recorder_header_valid(&fr->header) &&
+                     ((fr->head ^ fr->head_cmp) == 0xFFFFFFFFUL);
+    uint8_t state_at_reset = fr->state;
+
+    if (preserved) {
+        fr->header.boot_count++;
+        fr->boot_head = fr->head;
+    } else {
+        memset(fr, 0, sizeof(*fr));
+        fr->header.magic = FLIGHT_RECORDER_MAGIC;
+        fr->header.version = FLIGHT_RECORDER_VERSION;
+        fr->header.record_size = (uint16_t)sizeof(flight_record_t);
+        fr->header.capacity = FLIGHT_RECORDER_CAPACITY;
+        fr->header.tick_hz = (uint32_t)TIMEBASE_TICK_HZ;
+        flight_recorder_set_head(0U);
+    }
+    fr->header.crc = flight_recorder_crc32(&fr->header,
+                                           offsetof(flight_recorder_header_t, crc));
+
+    /* The timebase restarted with the reset: deltas restart at the marker */
+    fr->last_ticks = timebase_ticks64();
+    fr->state = SAFETY_STATE_INIT;
+    g_flight_recorder_ready = true;
+
+    hal_irq_restore(primask);
+
+    if (preserved) {
+        flight_recorder_write(FLIGHT_RECORD_BOOT, FAULT_TYPE_NONE,
+                              state_at_reset, SAFETY_STATE_INIT,
+                              (uint16_t)fr->header.boot_count);
+    }
+
+    return preserved;
+}
+
+/**
+ * @brief Record a fault event (ISR-safe)
+ */
+void flight_recorder_fault(fault_type_t source, uint16_t syndrome)
+{
+    uint8_t state = g_flight_recorder.state;
+
+    flight_recorder_write(FLIGHT_RECORD_FAULT, (uint8_t)source, state, state,
+                          syndrome);
+}
+
+/**
+ * @brief Record an FSM state change (ISR-safe)
+ */
+void flight_recorder_transition(safety_state_t before, safety_state_t after,
+                                fault_type_t active)
+{
+    flight_recorder_write(FLIGHT_RECORD_TRANSITION, (uint8_t)active,
+                          (uint8_t)before, (uint8_t)after, 0U);
+}
+
+/**
+ * @brief Records available for readout
+ */
+uint32_t flight_recorder_count(void)
+{
+    uint32_t head = g_flight_recorder.head;
+
+    if (!g_flight_recorder_ready) {
+        return 0U;
+    }
+
+    return head - flight_recorder_oldest(head);
+}
+
+/**
+ * @brief Records from before the last boot still in the ring
+ */
+uint32_t flight_recorder_preserved_count(void)
+{
+    uint32_t primask, oldest, boot_head;
+
+    if (!g_flight_recorder_ready) {
+        return 0U;
+    }
+
+    primask = hal_irq_save();
+    oldest = flight_recorder_oldest(g_flight_recorder.head);
+    boot_head = g_flight_recorder.boot_head;
+    hal_irq_restore(primask);
+
+    return (boot_head > oldest) ? (boot_head - oldest) : 0U;
+}
+
+/**
+ * @brief Read one record (0 = oldest)
+ */
+bool flight_recorder_read(uint32_t index, flight_record_t *record)
+{
+    uint32_t primask, head, oldest;
+    bool ok = false;
+
+    if (record == NULL || !g_flight_recorder_ready) {
+        return false;
+    }
+
+    primask = hal_irq_save();
+    head = g_flight_recorder.head;
+    oldest = flight_recorder_oldest(head);
+    if (index < head - oldest) {
+        *record = g_flight_recorder.records[(oldest + index) & FLIGHT_RECORDER_MASK];
+        ok = true;
+    }
+    hal_irq_restore(primask);
+
+    return ok;
+}
+
+/**
+ * @brief Discard all records; keeps the header and boot count
+ */
+void flight_recorder_clear(void)
+{
+    uint32_t primask;
+
+    if (!g_flight_recorder_ready) {
+        return;
+    }
+
+    primask = hal_irq_save();
+    memset(g_flight_recorder.records, 0, sizeof(g_flight_recorder.records));
+    g_flight_recorder.boot_head = 0U;
+    flight_recorder_set_head(0U);
+    hal_irq_restore(primask);
+}
+
+/**
+ * @brief The raw region, for dumping over a diagnostic link
+ */
+const flight_recorder_t *flight_recorder_region(void)
+{
+    return &g_flight_recorder;
+}
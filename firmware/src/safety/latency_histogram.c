@@ -0,0 +1,174 @@
+/**
+ * @file latency_histogram.c
+ * @brief Log-Linear (HDR-Style) Latency Histogram
+ *
+ * Bucket index of a value v >= 2^SUB_BITS with most significant bit m:
+ *   shift = m - SUB_BITS
+ *   index = (shift + 1) * SUB_COUNT + (v >> shift) - SUB_COUNT
+ * i.e. the group is the power of two and the sub-bucket the SUB_BITS bits
+ * below the leading one. Values below 2^SUB_BITS map to themselves.
+ *
+ * Compliance:
+ *  - ISO 26262-6:2018 Section 7.4.14 (Timing of software execution)
+ */
+
+#include "safety/latency_histogram.h"
+#include <string.h>
+#include <stddef.h>
+
+/**
+ * @brief Clear a histogram
+ */
+void latency_hist_reset(latency_hist_t *hist)
+{
+    if (hist != NULL) {
+        memset(hist, 0, sizeof(*hist));
+    }
+}
+
+/**
+ * @brief Bucket of a value (CLZ, shift, add)
+ */
+uint32_t latency_hist_bucket(uint32_t value_us)
+{
+    uint32_t msb, shift;
+
+    if (value_us > LATENCY_HIST_MAX_US) {
+        value_us = LATENCY_HIST_MAX_US;
+    }
+
+    if (value_us < LATENCY_HIST_SUB_COUNT) {
+        return value_us;
+    }
+
+    msb = 31U - (uint32_t)__builtin_clz(value_us);
+    shift = msb - LATENCY_HIST_SUB_BITS;
+
+    return ((shift + 1U) << LATENCY_HIST_SUB_BITS) +
+           (value_us >> shift) - LATENCY_HIST_SUB_COUNT;
+}
+
+/**
+ * @brief Largest value mapped to a bucket
+ */
+uint32_t latency_hist_bucket_upper(uint32_t bucket)
+{
+    uint32_t group = bucket >> LATENCY_HIST_SUB_BITS;
+    uint32_t sub = bucket & (LATENCY_HIST_SUB_COUNT - 1U);
+    uint32_t shift;
+
+    if (bucket >= LATENCY_HIST_BUCKETS) {
+        return LATENCY_HIST_MAX_US;
+    }
+
+    if (group == 0U) {
+        return bucket;
+    }
+
+    shift = group - 1U;
+    return ((LATENCY_HIST_SUB_COUNT + sub) << shift) + ((1UL << shift) - 1U);
+}
+
+/**
+ * @brief Record one sample (O(1))
+ */
+void latency_hist_record(latency_hist_t *hist, uint32_t value_us)
+{
+    uint32_t *count;
+
+    if (hist == NULL) {
+        return;
+    }
+
+    if (value_us > LATENCY_HIST_MAX_US) {
+        value_us = LATENCY_HIST_MAX_US;
+    }
+
+    count = &hist->counts[latency_hist_bucket(value_us)];
+    if (*count != UINT32_MAX) {
+        (*count)++;
+    }
+
+    if (hist->total == 0U || value_us < hist->min_us) {
+        hist->min_us = value_us;
+    }
+    if (value_us > hist->max_us) {
+        hist->max_us = value_us;
+    }
+    if (hist->total != UINT32_MAX) {
+        hist->total++;
+    }
+    hist->sum_us += value_us;
+}
+
+/**
+ * @brief Saturating 32-bit add
+ */
+static uint32_t latency_hist_add_sat(uint32_t a, uint32_t b)
+{
+    return (a > UINT32_MAX - b) ? UINT32_MAX : (a + b);
+}
+
+/**
+ * @brief Add the samples of src to dst
+ */
+bool latency_hist_merge(latency_hist_t *dst, const latency_hist_t *src)
+{
+    uint32_t i;
+
+    if (dst == NULL || src == NULL) {
+        return false;
+    }
+
+    if (src->total == 0U) {
+        return true;
+    }
+
+    for (i = 0; i < LATENCY_HIST_BUCKETS; i++) {
+        dst->counts[i] = latency_hist_add_sat(dst->counts[i], src->counts[i]);
+    }
+
+    if (dst->total == 0U || src->min_us < dst->min_us) {
+        dst->min_us = src->min_us;
+    }
+    if (src->max_us > dst->max_us) {
+        dst->max_us = src->max_us;
+    }
+    dst->total = latency_hist_add_sat(dst->total, src->total);
+    dst->sum_us += src->sum_us;
+
+    return true;
+}
+
+/**
+ * @brief Value at a quantile (upper bucket edge, capped at the maximum)
+ */
+uint32_t latency_hist_value_at(const latency_hist_t *hist, uint32_t quantile_ppm)
+{
+    uint64_t rank, seen = 0;
+    uint32_t i, upper;
+
+    if (hist == NULL || hist->total == 0U) {
+        return 0U;
+    }
+
+    if (quantile_ppm > 1000000UL) {
+        quantile_ppm = 1000000UL;
+    }
+
+    /* Rank of the sample at the quantile: ceil(total * q), at least 1 */
+    rank = ((uint64_t)hist->total * quantile_ppm + 999999U) / 1000000U;
+    if (rank == 0U) {
+        rank = 1U;
+    }
+
+    for (i = 0; i < LATENCY_HIST_BUCKETS; i++) {
+        seen += hist->counts[i];
+        if (seen >= rank) {
+            upper = latency_hist_bucket_upper(i);
+            return (upper < hist->max_us) ? upper : hist->max_us;
+        }
+    }
+
+    return hist->max_us;
+}
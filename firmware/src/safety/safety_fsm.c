@@ -16,7 +16,23 @@
  */
 
 #include "safety_types.h"
+#include "safety/safety_fsm.h"
+#include "safety/fault_event_queue.h"
+#include "safety/fault_priority.h"
+#include "safety/fault_statistics.h"
+#include "safety/flight_recorder.h"
+#include "hal/timebase.h"
+#include "hal/hal_cpu.h"
 #include <stddef.h>
+#if defined(FIRMWARE_HOST_BUILD)
+#include <stdatomic.h>
+#endif
+
+/** @brief Events drained from the fault event queue per batch */
+#define FSM_EVENT_BATCH 16U
+
+/** @brief Upper bound on batches per aggregation (bounds task runtime) */
+#define FSM_EVENT_MAX_BATCHES 12U
 
 /* ============================================================================
  * Global Variables
@@ -25,23 +41,70 @@
 /** @brief Global safety status maintained by FSM */
 static volatile safety_status_t g_safety_status = {
     .current_state = SAFETY_STATE_INIT,
-    .current_state_cmp = ~SAFETY_STATE_INIT,
+    .current_state_cmp = (uint8_t)~SAFETY_STATE_INIT,
     .active_faults = FAULT_TYPE_NONE,
-    .active_faults_cmp = ~FAULT_TYPE_NONE,
+    .active_faults_cmp = (uint8_t)~FAULT_TYPE_NONE,
     .recovery_status = RECOVERY_PENDING,
     .fault_count = 0,
     .timestamp_ms = 0,
-    .fault_flags = {
-        .pwr_fault = 0x00, .pwr_fault_cmp = 0xFF,
-        .clk_fault = 0x00, .clk_fault_cmp = 0xFF,
-        .mem_fault = 0x00, .mem_fault_cmp = 0xFF,
-        .reserved = {0, 0}
-    }
+    .fault_flags = { .word = FAULT_FLAGS_CLEAR }
 };
 
 /** @brief FSM initialization flag */
 static volatile bool g_fsm_initialized = false;
 
+/* ============================================================================
+ * Packed Fault Flag Word Access
+ * ============================================================================ */
+
+/**
+ * @brief Load the packed fault flag word (single load)
+ */
+static inline uint32_t fsm_fault_flags_load(void)
+{
+#if defined(FIRMWARE_HOST_BUILD)
+    return atomic_load_explicit(&g_safety_status.fault_flags.word,
+                                memory_order_acquire);
+#else
+    return g_safety_status.fault_flags.word;
+#endif
+}
+
+/**
+ * @brief Atomically set and clear flags, keeping the complement in step
+ *
+ * Target: LDREX/STREX retry loop, so an ISR preempting the safety task
+ * between load and store forces a retry instead of losing its flag.
+ * Host: C11 compare-and-swap loop. A corrupted complement byte is carried
+ * over unchanged, so DCLS failures are never masked by an update.
+ *
+ * @param set Flag bits to set
+ * @param clear Flag bits to clear
+ */
+static inline void fsm_fault_flags_update(uint32_t set, uint32_t clear)
+{
+    uint32_t old_word, new_word;
+
+#if defined(FIRMWARE_HOST_BUILD)
+    old_word = atomic_load_explicit(&g_safety_status.fault_flags.word,
+                                    memory_order_relaxed);
+    do {
+        new_word = (((old_word | set) & ~clear) &
+                    ~(set << FAULT_FLAGS_CMP_SHIFT)) |
+                   (clear << FAULT_FLAGS_CMP_SHIFT);
+    } while (!atomic_compare_exchange_weak_explicit(
+                 &g_safety_status.fault_flags.word, &old_word, new_word,
+                 memory_order_acq_rel, memory_order_relaxed));
+#else
+    do {
+        old_word = hal_ldrex32(&g_safety_status.fault_flags.word);
+        new_word = (((old_word | set) & ~clear) &
+                    ~(set << FAULT_FLAGS_CMP_SHIFT)) |
+                   (clear << FAULT_FLAGS_CMP_SHIFT);
+    } while (hal_strex32(new_word, &g_safety_status.fault_flags.word) != 0U);
+#endif
+}
+
 /* ============================================================================
  * FSM Transition Table - validates allowed state transitions
  * ============================================================================ */
@@ -141,6 +204,7 @@ static inline int fsm_state_to_index(safety_state_t state)
  *  - Clears all fault flags
  *  - Resets fault count
  *  - Sets g_fsm_initialized flag
+ *  - Preserves a valid flight recorder ring, formats an invalid one
  */
 bool fsm_init(void)
 {
@@ -149,27 +213,28 @@ bool fsm_init(void)
         return false;
     }
 
+    /* Keep a flight recorder ring that survived the reset for readout */
+    (void)flight_recorder_init();
+
     /* Initialize to INIT state */
     g_safety_status.current_state = SAFETY_STATE_INIT;
-    g_safety_status.current_state_cmp = ~SAFETY_STATE_INIT;
+    g_safety_status.current_state_cmp = (uint8_t)~SAFETY_STATE_INIT;
 
     /* Clear all faults */
     g_safety_status.active_faults = FAULT_TYPE_NONE;
-    g_safety_status.active_faults_cmp = ~FAULT_TYPE_NONE;
+    g_safety_status.active_faults_cmp = (uint8_t)~FAULT_TYPE_NONE;
 
     /* Clear fault flags */
-    g_safety_status.fault_flags.pwr_fault = 0x00;
-    g_safety_status.fault_flags.pwr_fault_cmp = 0xFF;
-    g_safety_status.fault_flags.clk_fault = 0x00;
-    g_safety_status.fault_flags.clk_fault_cmp = 0xFF;
-    g_safety_status.fault_flags.mem_fault = 0x00;
-    g_safety_status.fault_flags.mem_fault_cmp = 0xFF;
+    g_safety_status.fault_flags.word = FAULT_FLAGS_CLEAR;
 
     /* Reset statistics */
     g_safety_status.fault_count = 0;
     g_safety_status.recovery_status = RECOVERY_PENDING;
     g_safety_status.timestamp_ms = 0;
 
+    /* Discard events queued before the FSM existed */
+    fault_event_queue_init();
+
     /* Mark as initialized */
     g_fsm_initialized = true;
 
@@ -190,9 +255,11 @@ bool fsm_init(void)
  *  - Updates state and state_cmp atomically
  *  - Returns false for invalid transitions (DCLS protection)
  *  - All state transitions must pass matrix validation
+ *  - Appends every transition (and rejected ones) to the flight recorder
  */
 bool fsm_transition(safety_state_t next_state)
 {
+    safety_state_t current = g_safety_status.current_state;
     int current_idx, next_idx;
 
     /* Validate FSM is initialized */
@@ -201,23 +268,26 @@ bool fsm_transition(safety_state_t next_state)
     }
 
     /* Get transition matrix indices */
-    current_idx = fsm_state_to_index(g_safety_status.current_state);
+    current_idx = fsm_state_to_index(current);
     next_idx = fsm_state_to_index(next_state);
 
     /* Check if transition is allowed */
     if (!g_transition_matrix[current_idx][next_idx]) {
         /* Invalid transition - treat as DCLS failure */
         g_safety_status.current_state = SAFETY_STATE_INVALID;
-        g_safety_status.current_state_cmp = ~SAFETY_STATE_INVALID;
+        g_safety_status.current_state_cmp = (uint8_t)~SAFETY_STATE_INVALID;
+        flight_recorder_transition(current, SAFETY_STATE_INVALID,
+                                   g_safety_status.active_faults);
         return false;
     }
 
     /* Perform atomic state transition */
     g_safety_status.current_state = next_state;
-    g_safety_status.current_state_cmp = ~next_state;
+    g_safety_status.current_state_cmp = (uint8_t)~next_state;
+    flight_recorder_transition(current, next_state, g_safety_status.active_faults);
 
     /* Update timestamp */
-    g_safety_status.timestamp_ms = 0; /* Would be set by timer ISR */
+    g_safety_status.timestamp_ms = (uint32_t)timebase_ms();
 
     return true;
 }
@@ -280,78 +350,124 @@ bool fsm_get_status(safety_status_t *status)
 }
 
 /**
- * @brief Aggregate fault flags and update FSM state
+ * @brief Single-pass fault aggregation engine
  *
- * Called after fault flags are set by ISR handlers.
- * Aggregates all active fault flags and transitions FSM to FAULT state.
+ * Called from the safety task (directly or through fault_aggregate() /
+ * fsm_aggregate_faults()). One pass over the shared state:
+ *  1. Load and verify the FSM state once (DCLS)
+ *  2. Drain the fault event queue in batches of FSM_EVENT_BATCH, folding
+ *     the event sources into one mask (one flag update for the batch)
+ *  3. Load and verify the packed fault flag word once
+ *  4. Derive active mask, highest-priority fault and its priority level
+ *  5. Commit active_faults, fault_count and the NORMAL -> FAULT transition
+ *  6. On that transition, record the reaction time of each event source
+ *     from its oldest drained event (fault_stats_record_latency)
  *
  * Aggregation strategy (SysReq-002):
- *  - Priority: P1 (VDD) > P2 (CLK) > P3 (MEM)
- *  - Atomic execution to prevent race conditions
- *  - Updates active_faults bitmask
- *  - Triggers transition to FAULT state if in NORMAL
+ *  - Priority: runtime configuration (default P1 VDD > P2 CLK > P3 MEM),
+ *    resolved through the fault_priority table
+ *  - Every queued ISR event counts once in fault_count (no collapsing)
+ *  - Bounded: at most FSM_EVENT_MAX_BATCHES batches per call; the rest
+ *    stays queued for the next cycle
  *
- * @return true if aggregation successful, false if FSM not in valid state
+ * @param[out] result Aggregation result (may be NULL)
+ * @return true if aggregation successful, false on DCLS failure or
+ *         invalid FSM state
  */
-bool fsm_aggregate_faults(void)
+bool fsm_aggregate(fsm_aggregation_t *result)
 {
-    fault_type_t aggregated = FAULT_TYPE_NONE;
-    safety_state_t current_state;
-
-    /* Get current state with verification */
-    current_state = fsm_get_state();
-    if (current_state == SAFETY_STATE_INVALID) {
+    safety_state_t state = g_safety_status.current_state;
+    safety_state_t state_cmp = g_safety_status.current_state_cmp;
+    fault_event_t events[FSM_EVENT_BATCH];
+    uint32_t first_timestamp[FAULT_EVENT_SOURCES] = { 0U, 0U, 0U };
+    uint32_t drained_total = 0;
+    uint32_t event_mask = 0;
+    uint32_t batch, n, i;
+    uint32_t flags, active;
+
+    /* 1. FSM state, verified once */
+    if (!VERIFY_STATE(state, state_cmp) || state == SAFETY_STATE_INVALID) {
         return false;
     }
 
-    /* Aggregate fault flags (atomic - no interrupts during this section) */
-    if (VERIFY_FAULT_FLAG(g_safety_status.fault_flags.pwr_fault,
-                          g_safety_status.fault_flags.pwr_fault_cmp)) {
-        if (g_safety_status.fault_flags.pwr_fault) {
-            aggregated |= FAULT_TYPE_VDD;
+    /* 2. Drain ISR events in bounded batches */
+    for (batch = 0; batch < FSM_EVENT_MAX_BATCHES; batch++) {
+        n = fault_event_drain(events, FSM_EVENT_BATCH);
+        for (i = 0; i < n; i++) {
+            /* Drained oldest first: keep each source's first timestamp
+             * (source bits 1, 2, 4 -> index 0, 1, 2) */
+            if ((event_mask & events[i].source) == 0U) {
+                first_timestamp[events[i].source >> 1] = events[i].timestamp;
+            }
+            event_mask |= events[i].source;
+        }
+        drained_total += n;
+        if (n < FSM_EVENT_BATCH) {
+            break;
         }
-    } else {
-        /* DCLS failure in pwr_fault */
-        return false;
     }
 
-    if (VERIFY_FAULT_FLAG(g_safety_status.fault_flags.clk_fault,
-                          g_safety_status.fault_flags.clk_fault_cmp)) {
-        if (g_safety_status.fault_flags.clk_fault) {
-            aggregated |= FAULT_TYPE_CLK;
-        }
-    } else {
-        /* DCLS failure in clk_fault */
-        return false;
+    if (event_mask != 0U) {
+        fsm_fault_flags_update(event_mask & FAULT_TYPE_MULTIPLE, 0U);
     }
 
-    if (VERIFY_FAULT_FLAG(g_safety_status.fault_flags.mem_fault,
-                          g_safety_status.fault_flags.mem_fault_cmp)) {
-        if (g_safety_status.fault_flags.mem_fault) {
-            aggregated |= FAULT_TYPE_MEM_ECC;
-        }
-    } else {
-        /* DCLS failure in mem_fault */
+    /* 3. Fault flags: one load, one DCLS compare */
+    flags = fsm_fault_flags_load();
+    if (!VERIFY_FAULT_FLAGS(flags)) {
         return false;
     }
 
-    /* Update active faults atomically */
-    g_safety_status.active_faults = aggregated;
-    g_safety_status.active_faults_cmp = ~aggregated;
+    /* 4. Active mask and highest priority (resolver table load) */
+    active = flags & FAULT_FLAGS_MASK;
+
+    if (result != NULL) {
+        result->active = (fault_type_t)active;
+        result->highest = fault_priority_resolve(active, &result->priority);
+        result->events = drained_total;
+    }
+
+    /* 5. Commit */
+    g_safety_status.active_faults = (fault_type_t)active;
+    g_safety_status.active_faults_cmp = (uint8_t)~active;
 
-    /* Update fault count if new faults detected */
-    if (aggregated != FAULT_TYPE_NONE) {
-        g_safety_status.fault_count++;
+    /* Update fault count: one per queued event, or one per pass for
+     * flags raised directly without an event */
+    if (active != 0U) {
+        g_safety_status.fault_count = (uint16_t)(g_safety_status.fault_count +
+            ((drained_total != 0U) ? drained_total : 1U));
 
         /* Transition to FAULT state if currently NORMAL */
-        if (current_state == SAFETY_STATE_NORMAL) {
-            return fsm_transition(SAFETY_STATE_FAULT);
+        if (state == SAFETY_STATE_NORMAL) {
+            if (!fsm_transition(SAFETY_STATE_FAULT)) {
+                return false;
+            }
+
+            /* 6. Reaction time per source (ISR timestamp -> FAULT) */
+            for (i = 0; i < FAULT_EVENT_SOURCES; i++) {
+                if ((event_mask & (1UL << i)) != 0U) {
+                    (void)fault_stats_record_latency((fault_type_t)(1UL << i),
+                                                     first_timestamp[i]);
+                }
+            }
         }
     }
 
     return true;
 }
 
+/**
+ * @brief Aggregate fault flags and update FSM state
+ *
+ * Thin wrapper over fsm_aggregate() for callers that only need the
+ * success status.
+ *
+ * @return true if aggregation successful, false if FSM not in valid state
+ */
+bool fsm_aggregate_faults(void)
+{
+    return fsm_aggregate(NULL);
+}
+
 /**
  * @brief Clear specific fault flags after recovery
  *
@@ -363,24 +479,41 @@ bool fsm_aggregate_faults(void)
  */
 bool fsm_clear_faults(fault_type_t faults_to_clear)
 {
-    /* Clear corresponding fault flags */
-    if (faults_to_clear & FAULT_TYPE_VDD) {
-        g_safety_status.fault_flags.pwr_fault = 0x00;
-        g_safety_status.fault_flags.pwr_fault_cmp = 0xFF;
-    }
+    /* Clear corresponding fault flags (single atomic update) */
+    fsm_fault_flags_update(0U, (uint32_t)faults_to_clear & FAULT_TYPE_MULTIPLE);
 
-    if (faults_to_clear & FAULT_TYPE_CLK) {
-        g_safety_status.fault_flags.clk_fault = 0x00;
-        g_safety_status.fault_flags.clk_fault_cmp = 0xFF;
-    }
+    /* Re-aggregate faults */
+    return fsm_aggregate_faults();
+}
 
-    if (faults_to_clear & FAULT_TYPE_MEM_ECC) {
-        g_safety_status.fault_flags.mem_fault = 0x00;
-        g_safety_status.fault_flags.mem_fault_cmp = 0xFF;
+/**
+ * @brief Set a fault flag from ISR context
+ *
+ * Sets the flag bit and clears its complement bit in one atomic update
+ * of the packed word, so readers never see a half-written pair and a
+ * preempting ISR cannot lose another source's flag.
+ *
+ * @param fault Fault source to flag (FAULT_TYPE_VDD, _CLK or _MEM_ECC)
+ */
+void fsm_set_fault_flag(fault_type_t fault)
+{
+    if (((uint32_t)fault & ~(uint32_t)FAULT_TYPE_MULTIPLE) != 0U) {
+        return;  /* Not a fault source bit (e.g. FAULT_TYPE_INVALID) */
     }
 
-    /* Re-aggregate faults */
-    return fsm_aggregate_faults();
+    fsm_fault_flags_update((uint32_t)fault, 0U);
+}
+
+/**
+ * @brief Verify DCLS integrity of all fault flags
+ *
+ * @return true if the packed flag word passes the complement check
+ */
+bool fsm_fault_flags_valid(void)
+{
+    uint32_t flags = fsm_fault_flags_load();
+
+    return VERIFY_FAULT_FLAGS(flags);
 }
 
 /**
@@ -0,0 +1,51 @@
+/**
+ * @file host_test.h
+ * @brief Minimal assertion helpers for host-build C unit tests
+ *
+ * The host build (firmware_lib_host) lets the real firmware sources run
+ * on x86-64 Linux. Each test_*.c file in this directory is a standalone
+ * executable registered with ctest; a non-zero exit code fails the test.
+ */
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+
+/** @brief Number of failed checks in the current test executable */
+static int g_host_test_failures = 0;
+
+/** @brief Check a condition, report file/line on failure */
+#define CHECK(cond)                                                      \
+    do {                                                                 \
+        if (!(cond)) {                                                   \
+            fprintf(stderr, "%s:%d: CHECK failed: %s\n",                 \
+                    __FILE__, __LINE__, #cond);                          \
+            g_host_test_failures++;                                      \
+        }                                                                \
+    } while (0)
+
+/** @brief Check two integer expressions for equality */
+#define CHECK_EQ(actual, expected)                                       \
+    do {                                                                 \
+        unsigned long long a_ = (unsigned long long)(actual);            \
+        unsigned long long e_ = (unsigned long long)(expected);          \
+        if (a_ != e_) {                                                  \
+            fprintf(stderr, "%s:%d: CHECK_EQ failed: %s == 0x%llx, "     \
+                    "expected 0x%llx\n", __FILE__, __LINE__, #actual,    \
+                    a_, e_);                                             \
+            g_host_test_failures++;                                      \
+        }                                                                \
+    } while (0)
+
+/** @brief Run one test function and print its name */
+#define RUN_TEST(fn)                                                     \
+    do {                                                                 \
+        printf("[ RUN  ] %s\n", #fn);                                    \
+        fn();                                                            \
+    } while (0)
+
+/** @brief Exit code for main(): 0 if all checks passed */
+#define HOST_TEST_RESULT() (g_host_test_failures == 0 ? 0 : 1)
+
+#endif /* HOST_TEST_H */
@@ -0,0 +1,385 @@
+/**
+ * @file test_ecc_codec.c
+ * @brief Host-build tests for the software SEC/DED codec against the RTL
+ *
+ * The reference model below is a bit-by-bit transcription of
+ * rtl/memory_protection/ecc_encoder.v and ecc_decoder.v.
+ *
+ * Test cases:
+ *  - TC01: Encoder matches the RTL on fixed and random words, every path
+ *  - TC02: Decoder matches the RTL for all 1-bit and random 2-bit flips
+ *  - TC03: Decoder matches the RTL on random (data, ecc) pairs
+ *  - TC04: Batch decode corrects in place and reports SBE/MBE counts
+ *  - TC05: Known RTL properties (syndrome[6] term, bit 63 correction)
+ *  - TC06: ecc_check64 repairs every single flip and flags double flips
+ *          without touching the data
+ *  - TC07: ecc_syndrome_column maps every decoder SBE syndrome of a data
+ *          bit flip to the ecc_check64 column
+ */
+
+#include "host_test.h"
+#include "memory/ecc_codec.h"
+#include <string.h>
+
+static const ecc_codec_path_t g_paths[] = {
+    ECC_CODEC_PATH_TABLE, ECC_CODEC_PATH_WORD,
+    ECC_CODEC_PATH_AVX2, ECC_CODEC_PATH_AVX512
+};
+
+#define PATH_COUNT (sizeof(g_paths) / sizeof(g_paths[0]))
+
+/* ============================================================================
+ * Reference model (RTL transcription)
+ * ============================================================================ */
+
+static uint32_t bit(uint64_t v, uint32_t i)
+{
+    return (uint32_t)(v >> i) & 1U;
+}
+
+/** @brief p(2^k) / s(2^k) data term: data[i] for i < 63 where bit k of i+1 */
+static uint32_t rtl_parity_term(uint64_t data, uint32_t k)
+{
+    uint32_t p = 0;
+
+    for (uint32_t i = 0; i < 63U; i++) {
+        if ((((i + 1U) >> k) & 1U) != 0U) {
+            p ^= bit(data, i);
+        }
+    }
+    return p;
+}
+
+static uint8_t rtl_encode(uint64_t data)
+{
+    uint32_t p[6];
+    uint32_t p64 = bit(data, 63);
+    uint32_t overall = 0;
+    uint32_t ecc = 0;
+
+    for (uint32_t k = 0; k < 6U; k++) {
+        p[k] = rtl_parity_term(data, k);
+        p64 ^= p[k];
+        ecc |= p[k] << k;
+    }
+    for (uint32_t i = 0; i < 64U; i++) {
+        overall ^= bit(data, i);
+    }
+    return (uint8_t)(ecc | (p64 << 6) | (overall << 7));
+}
+
+static void rtl_decode(uint64_t data, uint8_t ecc, ecc_decode_t *r)
+{
+    uint32_t s[6];
+    uint32_t s64 = bit(ecc, 6) ^ bit(data, 63);
+    uint32_t overall = bit(ecc, 7);
+    uint32_t syndrome = 0;
+
+    for (uint32_t k = 0; k < 6U; k++) {
+        s[k] = bit(ecc, k) ^ rtl_parity_term(data, k);
+        s64 ^= s[k];
+        syndrome |= s[k] << k;
+    }
+    syndrome |= s64 << 6;
+    for (uint32_t i = 0; i < 64U; i++) {
+        overall ^= bit(data, i);
+    }
+
+    r->sbe = (syndrome != 0U) && (overall != 0U);
+    r->mbe = (syndrome != 0U) && (overall == 0U);
+    r->error_pos = (uint8_t)syndrome;
+    r->data = data;
+    for (uint32_t i = 0; i < 64U; i++) {
+        if (r->sbe && syndrome == i + 1U) {
+            r->data ^= 1ULL << i;
+        }
+    }
+}
+
+static uint64_t g_rng = 0x9E3779B97F4A7C15ULL;
+
+static uint64_t rng64(void)
+{
+    /* xorshift64 */
+    g_rng ^= g_rng << 13;
+    g_rng ^= g_rng >> 7;
+    g_rng ^= g_rng << 17;
+    return g_rng;
+}
+
+static bool decode_equal(const ecc_decode_t *a, const ecc_decode_t *b)
+{
+    return a->data == b->data && a->sbe == b->sbe && a->mbe == b->mbe &&
+           a->error_pos == b->error_pos;
+}
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+#define RANDOM_WORDS 4099U  /* Not a multiple of any SIMD width: exercises tails */
+
+static void test_encode_matches_rtl(void)
+{
+    static uint64_t data[RANDOM_WORDS];
+    static uint8_t ecc[RANDOM_WORDS];
+    uint32_t mismatches = 0;
+
+    CHECK_EQ(ecc_encode64(0ULL), 0x00U);
+    CHECK_EQ(ecc_encode64(1ULL), 0xC1U);
+    CHECK_EQ(ecc_encode64(~0ULL), 0x40U);
+    CHECK_EQ(ecc_encode64(0x0123456789ABCDEFULL), rtl_encode(0x0123456789ABCDEFULL));
+
+    for (uint32_t i = 0; i < RANDOM_WORDS; i++) {
+        data[i] = (i < 64U) ? (1ULL << i) : rng64();
+        if (ecc_encode64(data[i]) != rtl_encode(data[i])) {
+            mismatches++;
+        }
+    }
+    CHECK_EQ(mismatches, 0U);
+
+    for (uint32_t p = 0; p < PATH_COUNT; p++) {
+        if (!ecc_codec_select_path(g_paths[p])) {
+            continue; /* SIMD path not available on this CPU */
+        }
+        CHECK_EQ(ecc_codec_get_path(), g_paths[p]);
+        ecc_encode64_batch(data, ecc, RANDOM_WORDS);
+        mismatches = 0;
+        for (uint32_t i = 0; i < RANDOM_WORDS; i++) {
+            if (ecc[i] != rtl_encode(data[i])) {
+                mismatches++;
+            }
+        }
+        CHECK_EQ(mismatches, 0U);
+    }
+
+    CHECK(ecc_codec_select_path(ECC_CODEC_PATH_AUTO));
+}
+
+static void test_decode_flips_match_rtl(void)
+{
+    ecc_decode_t got, ref;
+    uint32_t mismatches = 0;
+
+    for (uint32_t w = 0; w < 64U; w++) {
+        uint64_t data = rng64();
+        uint8_t ecc = ecc_encode64(data);
+
+        /* Clean word, then every single flip of the 72 bits */
+        for (uint32_t f = 0; f <= 72U; f++) {
+            uint64_t d = data;
+            uint8_t e = ecc;
+
+            if (f > 0U && f <= 64U) {
+                d ^= 1ULL << (f - 1U);
+            } else if (f > 64U) {
+                e ^= (uint8_t)(1U << (f - 65U));
+            }
+            ecc_decode64(d, e, &got);
+            rtl_decode(d, e, &ref);
+            if (!decode_equal(&got, &ref)) {
+                mismatches++;
+            }
+        }
+
+        /* Random double flips in the data */
+        for (uint32_t f = 0; f < 32U; f++) {
+            uint32_t a = (uint32_t)(rng64() % 64U);
+            uint32_t b = (a + 1U + (uint32_t)(rng64() % 63U)) % 64U;
+            uint64_t d = data ^ (1ULL << a) ^ (1ULL << b);
+
+            ecc_decode64(d, ecc, &got);
+            rtl_decode(d, ecc, &ref);
+            if (!decode_equal(&got, &ref)) {
+                mismatches++;
+            }
+        }
+    }
+    CHECK_EQ(mismatches, 0U);
+}
+
+static void test_decode_random_pairs(void)
+{
+    ecc_decode_t got, ref;
+    uint32_t mismatches = 0;
+
+    for (uint32_t i = 0; i < 20000U; i++) {
+        uint64_t data = rng64();
+        uint8_t ecc = (uint8_t)rng64();
+
+        ecc_decode64(data, ecc, &got);
+        rtl_decode(data, ecc, &ref);
+        if (!decode_equal(&got, &ref)) {
+            mismatches++;
+        }
+    }
+    CHECK_EQ(mismatches, 0U);
+}
+
+static void test_batch_decode(void)
+{
+    static uint64_t data[RANDOM_WORDS];
+    static uint64_t ref_data[RANDOM_WORDS];
+    static uint8_t ecc[RANDOM_WORDS];
+    uint32_t ref_sbe = 0, ref_mbe = 0;
+    size_t ref_first = RANDOM_WORDS;
+    ecc_batch_stats_t stats;
+    ecc_decode_t ref;
+
+    for (uint32_t p = 0; p < PATH_COUNT; p++) {
+        if (!ecc_codec_select_path(g_paths[p])) {
+            continue;
+        }
+
+        g_rng = 0x2545F4914F6CDD1DULL;
+        ref_sbe = ref_mbe = 0;
+        ref_first = RANDOM_WORDS;
+        for (uint32_t i = 0; i < RANDOM_WORDS; i++) {
+            data[i] = rng64();
+            ecc[i] = ecc_encode64(data[i]);
+            if ((i % 7U) == 3U) {
+                data[i] ^= 1ULL << (rng64() % 64U);            /* 1-bit */
+            } else if ((i % 11U) == 5U) {
+                data[i] ^= 3ULL << (rng64() % 63U);            /* 2-bit */
+            }
+            rtl_decode(data[i], ecc[i], &ref);
+            ref_data[i] = ref.data;
+            ref_sbe += ref.sbe ? 1U : 0U;
+            ref_mbe += ref.mbe ? 1U : 0U;
+            if ((ref.sbe || ref.mbe) && ref_first == RANDOM_WORDS) {
+                ref_first = i;
+            }
+        }
+
+        /* In place */
+        ecc_decode64_batch(data, ecc, data, RANDOM_WORDS, &stats);
+        CHECK_EQ(stats.sbe_count, ref_sbe);
+        CHECK_EQ(stats.mbe_count, ref_mbe);
+        CHECK_EQ(stats.first_error, ref_first);
+        CHECK(memcmp(data, ref_data, sizeof(data)) == 0);
+    }
+
+    /* Empty batch: no errors, first_error == count */
+    ecc_decode64_batch(data, ecc, data, 0U, &stats);
+    CHECK_EQ(stats.sbe_count + stats.mbe_count, 0U);
+    CHECK_EQ(stats.first_error, 0U);
+
+    CHECK(ecc_codec_select_path(ECC_CODEC_PATH_AUTO));
+}
+
+static void test_rtl_properties(void)
+{
+    ecc_decode_t r;
+
+    /* 0x1: p1 = 1, so p1..p32 have odd parity and the RTL syndrome[6]
+     * term is set on the clean word: decoded as MBE at position 64 */
+    ecc_decode64(1ULL, ecc_encode64(1ULL), &r);
+    CHECK(r.mbe);
+    CHECK(!r.sbe);
+    CHECK_EQ(r.error_pos, 64U);
+    CHECK_EQ(r.data, 1ULL);
+
+    /* 0x3: p1..p32 even, clean word decodes clean */
+    ecc_decode64(3ULL, ecc_encode64(3ULL), &r);
+    CHECK(!r.mbe && !r.sbe);
+    CHECK_EQ(r.error_pos, 0U);
+
+    /* Bit 63 flip on a clean zero word: SBE at 64, corrected */
+    ecc_decode64(1ULL << 63, 0x00U, &r);
+    CHECK(r.sbe);
+    CHECK_EQ(r.error_pos, 64U);
+    CHECK_EQ(r.data, 0ULL);
+
+    /* Flip of the overall parity bit alone is not flagged (syndrome 0) */
+    ecc_decode64(0ULL, 0x80U, &r);
+    CHECK(!r.sbe && !r.mbe);
+}
+
+static void test_check_repairs(void)
+{
+    ecc_decode_t r;
+    uint32_t failures = 0;
+
+    for (uint32_t w = 0; w < 64U; w++) {
+        uint64_t data = rng64();
+        uint8_t ecc = ecc_encode64(data);
+
+        ecc_check64(data, ecc, &r);
+        if (r.sbe || r.mbe || r.error_pos != 0U || r.data != data) {
+            failures++;
+        }
+
+        for (uint32_t f = 1; f <= 72U; f++) {
+            uint64_t d = (f <= 64U) ? (data ^ (1ULL << (f - 1U))) : data;
+            uint8_t e = (f > 64U) ? (uint8_t)(ecc ^ (1U << (f - 65U))) : ecc;
+
+            ecc_check64(d, e, &r);
+            if (!r.sbe || r.mbe || r.error_pos != f || r.data != data) {
+                failures++;
+            }
+        }
+
+        for (uint32_t f = 0; f < 32U; f++) {
+            uint32_t a = (uint32_t)(rng64() % 64U);
+            uint32_t b = (a + 1U + (uint32_t)(rng64() % 63U)) % 64U;
+
+            uint64_t d = data ^ (1ULL << a) ^ (1ULL << b);
+
+            /* Flagged, and the data never "corrected" (6 pairs alias a
+             * check-bit column and report SBE on ecc only) */
+            ecc_check64(d, ecc, &r);
+            if (r.mbe == r.sbe || r.data != d ||
+                (r.sbe && r.error_pos <= 64U)) {
+                failures++;
+            }
+        }
+    }
+    CHECK_EQ(failures, 0U);
+}
+
+static void test_syndrome_column(void)
+{
+    ecc_decode_t r, c;
+    uint32_t failures = 0;
+    uint32_t high = 0;
+
+    for (uint32_t w = 0; w < 64U; w++) {
+        uint64_t data = rng64();
+        uint8_t ecc = ecc_encode64(data);
+
+        for (uint32_t f = 1; f <= 64U; f++) {
+            uint64_t d = data ^ (1ULL << (f - 1U));
+
+            ecc_decode64(d, ecc, &r);
+            ecc_check64(d, ecc, &c);
+            if (!r.sbe) {
+                continue;  /* Bit 63 with syndrome[6] clear: not flagged */
+            }
+            high += (r.error_pos > 64U) ? 1U : 0U;
+            if (ecc_syndrome_column(r.error_pos) != c.error_pos) {
+                failures++;
+            }
+        }
+    }
+    CHECK_EQ(failures, 0U);
+    CHECK(high > 0U);  /* Raw syndromes above 64 occur and are folded */
+
+    CHECK_EQ(ecc_syndrome_column(0U), 0U);
+    CHECK_EQ(ecc_syndrome_column(64U), 64U);
+    CHECK_EQ(ecc_syndrome_column(65U), 1U);
+    CHECK_EQ(ecc_syndrome_column(127U), 63U);
+    CHECK_EQ(ecc_syndrome_column(128U), 0U);
+}
+
+int main(void)
+{
+    RUN_TEST(test_encode_matches_rtl);
+    RUN_TEST(test_decode_flips_match_rtl);
+    RUN_TEST(test_decode_random_pairs);
+    RUN_TEST(test_batch_decode);
+    RUN_TEST(test_rtl_properties);
+    RUN_TEST(test_check_repairs);
+    RUN_TEST(test_syndrome_column);
+
+    return HOST_TEST_RESULT();
+}
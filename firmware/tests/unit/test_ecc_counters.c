@@ -0,0 +1,142 @@
+/**
+ * @file test_ecc_counters.c
+ * @brief Host-build tests for the 64-bit software-extended ECC counters
+ *
+ * The simulated register file has no read side effects, so each step
+ * pokes the value the controller would return on the next read and
+ * invalidates the status shadow as ecc_fault_isr() would.
+ *
+ * Test cases:
+ *  - TC01: Saturating mode folds deltas and flags counts lost at 65535
+ *  - TC02: Totals survive ecc_clear_counters, the 16-bit view restarts
+ *  - TC03: Wrap mode accumulates across the 16-bit wrap
+ *  - TC04: Clear-on-read mode adds every read value
+ *  - TC05: Counter mode is kept by ecc_configure and rejected if invalid
+ */
+
+#include "host_test.h"
+#include "hal/reg_access.h"
+#include "memory/ecc_service.h"
+
+#define ECC_CTRL_ADDR (ECC_BASE_ADDR + ECC_CTRL_OFFSET)
+
+/** @brief Present new hardware counter values to the next read */
+static void hw_counts(uint32_t sbe, uint32_t mbe)
+{
+    hal_sim_reg_poke(ECC_BASE_ADDR + ECC_SBE_COUNT_OFFSET, sbe);
+    hal_sim_reg_poke(ECC_BASE_ADDR + ECC_MBE_COUNT_OFFSET, mbe);
+    ecc_status_invalidate();
+}
+
+static void test_saturating_mode(void)
+{
+    ecc_status_t status;
+
+    CHECK_EQ(ecc_get_counter_mode(), ECC_COUNTER_SATURATE);
+
+    hw_counts(100U, 2U);
+    CHECK_EQ(ecc_get_sbe_total(), 100ULL);
+    CHECK_EQ(ecc_get_mbe_total(), 2ULL);
+    CHECK(ecc_validate_config());
+
+    hw_counts(65535U, 2U);
+    CHECK(ecc_get_status(&status));
+    CHECK_EQ(status.sbe_total, 65535ULL);
+    CHECK_EQ(status.sbe_count, 65535U);
+    CHECK(status.counts_lost);
+    CHECK(!ecc_validate_config());
+
+    /* Still saturated: nothing new can be counted */
+    hw_counts(65535U, 3U);
+    CHECK_EQ(ecc_get_sbe_total(), 65535ULL);
+    CHECK_EQ(ecc_get_mbe_total(), 3ULL);
+}
+
+static void test_clear_keeps_totals(void)
+{
+    ecc_status_t status;
+
+    CHECK(ecc_clear_counters());
+    CHECK_EQ(ecc_get_sbe_count(), 0U);
+    CHECK_EQ(ecc_get_mbe_count(), 0U);
+    CHECK_EQ(ecc_get_sbe_total(), 65535ULL);
+    CHECK_EQ(ecc_get_mbe_total(), 3ULL);
+
+    hw_counts(65535U, 5U);
+    CHECK(ecc_get_status(&status));
+    CHECK_EQ(status.mbe_count, 2U);
+    CHECK_EQ(status.mbe_total, 5ULL);
+}
+
+static void test_wrap_mode(void)
+{
+    hw_counts(0U, 0U);  // Controller reset: counts restart at 0
+    CHECK(ecc_set_counter_mode(ECC_COUNTER_WRAP));
+    CHECK_EQ(ecc_get_counter_mode(), ECC_COUNTER_WRAP);
+    CHECK_EQ(hal_sim_reg_peek(ECC_CTRL_ADDR) >> 8, (uint32_t)ECC_COUNTER_WRAP);
+
+    hw_counts(65000U, 0U);
+    CHECK_EQ(ecc_get_sbe_total(), 65535ULL + 65000ULL);
+
+    hw_counts(100U, 0U);  // Wrapped: 636 new errors
+    CHECK_EQ(ecc_get_sbe_total(), 65535ULL + 65636ULL);
+
+    hw_counts(100U, 0U);  // Unchanged
+    CHECK_EQ(ecc_get_sbe_total(), 65535ULL + 65636ULL);
+
+    /* Loss from the saturated period is sticky until cleared */
+    CHECK(!ecc_validate_config());
+    CHECK(ecc_clear_counters());
+    hw_counts(65535U, 0U);  // Not a saturation in wrap mode
+    CHECK(ecc_validate_config());
+    CHECK_EQ(ecc_get_sbe_count(), 65435U);
+    hw_counts(100U, 0U);
+    CHECK_EQ(ecc_get_sbe_count(), 65535U);  // 16-bit view saturates
+}
+
+static void test_clear_on_read_mode(void)
+{
+    uint64_t base;
+
+    base = ecc_get_sbe_total();
+    CHECK(ecc_set_counter_mode(ECC_COUNTER_CLEAR_ON_READ));
+
+    /* First read after the switch: counter continued from 100 */
+    hw_counts(150U, 0U);
+    CHECK_EQ(ecc_get_sbe_total(), base + 50ULL);
+
+    /* Later reads return counts of one interval each */
+    hw_counts(7U, 1U);
+    CHECK_EQ(ecc_get_sbe_total(), base + 57ULL);
+    hw_counts(65534U, 0U);
+    CHECK_EQ(ecc_get_sbe_total(), base + 57ULL + 65534ULL);
+    CHECK_EQ(ecc_get_mbe_total(), 6ULL);
+}
+
+static void test_mode_kept_by_configure(void)
+{
+    CHECK(ecc_configure(1U, 5U, 1U, 1U));
+    CHECK_EQ((hal_sim_reg_peek(ECC_CTRL_ADDR) >> 8) & 0x3U,
+             (uint32_t)ECC_COUNTER_CLEAR_ON_READ);
+    CHECK_EQ(hal_sim_reg_peek(ECC_CTRL_ADDR) & 0xFFU, 0x07U | (5U << 3));
+
+    CHECK(!ecc_set_counter_mode((ecc_counter_mode_t)3));
+    CHECK_EQ(ecc_get_counter_mode(), ECC_COUNTER_CLEAR_ON_READ);
+
+    CHECK(ecc_set_counter_mode(ECC_COUNTER_SATURATE));
+    CHECK_EQ(hal_sim_reg_peek(ECC_CTRL_ADDR) & 0x3FFU, 0x07U | (5U << 3));
+}
+
+int main(void)
+{
+    hal_sim_reg_reset();
+    CHECK(ecc_init());
+
+    RUN_TEST(test_saturating_mode);
+    RUN_TEST(test_clear_keeps_totals);
+    RUN_TEST(test_wrap_mode);
+    RUN_TEST(test_clear_on_read_mode);
+    RUN_TEST(test_mode_kept_by_configure);
+
+    return HOST_TEST_RESULT();
+}
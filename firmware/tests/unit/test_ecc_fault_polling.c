@@ -0,0 +1,141 @@
+/**
+ * @file test_ecc_fault_polling.c
+ * @brief Host-build tests for the ECC interrupt/polling switch
+ *
+ * The simulated register file has no read side effects: FIFO_POP keeps
+ * returning the poked entry, so every drain is a full burst. Rate windows
+ * run on the host timebase (1ms).
+ *
+ * Test cases:
+ *  - TC01: Threshold validation, poll task idle in interrupt mode
+ *  - TC02: The SBE_COUNT rise across interrupts, not the FIFO entries
+ *          drained, masks SBEs and enters polling
+ *  - TC03: ecc_configure keeps the mask, MBE interrupts still handled
+ *  - TC04: The poll task folds counters, drains the FIFO into the
+ *          heatmap by column, raises the flag
+ *  - TC05: A quiet window restores SBE interrupts
+ */
+
+#include "host_test.h"
+#include "hal/reg_access.h"
+#include "hal/timebase.h"
+#include "memory/ecc_handler.h"
+#include "memory/ecc_heatmap.h"
+#include "memory/ecc_service.h"
+
+#define ECC_CTRL_ADDR    (ECC_BASE_ADDR + ECC_CTRL_OFFSET)
+#define SBE_COUNT_ADDR   (ECC_BASE_ADDR + ECC_SBE_COUNT_OFFSET)
+#define FIFO_POP_ADDR    (ECC_BASE_ADDR + ECC_FIFO_POP_OFFSET)
+#define SBE_FAULT_MASK   0x400U
+
+/** @brief Busy-wait on the timebase */
+static void wait_ms(uint32_t ms)
+{
+    uint64_t end = timebase_ticks64() + (uint64_t)ms * TIMEBASE_TICKS_PER_MS;
+
+    while (timebase_ticks64() < end) {
+    }
+}
+
+static void test_thresholds(void)
+{
+    CHECK(!ecc_fault_set_poll_thresholds(8U, 8U));   // No hysteresis
+    CHECK(!ecc_fault_set_poll_thresholds(8U, 20U));
+    CHECK(ecc_fault_set_poll_thresholds(0U, 0U));    // Always interrupts
+    CHECK(ecc_fault_set_poll_thresholds(16U, 2U));
+
+    CHECK(!ecc_fault_is_polling());
+    CHECK_EQ(ecc_fault_poll_task(), 0U);
+}
+
+static void test_enter_polling(void)
+{
+    hal_sim_reg_poke(FIFO_POP_ADDR, 0x80000100U | 9U);  // Valid SBE
+
+    /* Full FIFO bursts, but only 2 SBEs counted each time */
+    for (uint32_t i = 1U; i <= 3U; i++) {
+        hal_sim_reg_poke(SBE_COUNT_ADDR, 2U * i);
+        ecc_fault_isr();
+    }
+    CHECK(!ecc_fault_is_polling());
+    CHECK_EQ(hal_sim_reg_peek(ECC_CTRL_ADDR) & SBE_FAULT_MASK, 0U);
+
+    /* One coalesced interrupt for 10 more SBEs reaches 16 */
+    hal_sim_reg_poke(SBE_COUNT_ADDR, 16U);
+    ecc_fault_isr();
+    CHECK(ecc_fault_is_polling());
+    CHECK_EQ(hal_sim_reg_peek(ECC_CTRL_ADDR) & SBE_FAULT_MASK, SBE_FAULT_MASK);
+    CHECK_EQ(ecc_fault_get_mode_switches(), 1U);
+
+    hal_sim_reg_poke(FIFO_POP_ADDR, 0U);
+}
+
+static void test_mbe_still_interrupts(void)
+{
+    uint32_t events = ecc_fault_get_event_count();
+
+    CHECK(ecc_set_sbe_threshold(12U));
+    CHECK_EQ(hal_sim_reg_peek(ECC_CTRL_ADDR) & SBE_FAULT_MASK, SBE_FAULT_MASK);
+
+    hal_sim_reg_poke(FIFO_POP_ADDR, 0x80000200U | 3U);  // Valid MBE
+    ecc_fault_isr();
+    hal_sim_reg_poke(FIFO_POP_ADDR, 0U);
+    CHECK_EQ(ecc_fault_get_event_count(), events + 1U);
+    CHECK(ecc_fault_is_polling());
+}
+
+static void test_poll_collects(void)
+{
+    uint32_t bins[ECC_HEATMAP_BITS];
+    uint32_t events;
+
+    ecc_heatmap_reset();
+    hal_sim_reg_poke(SBE_COUNT_ADDR, 100U);
+    (void)ecc_fault_poll_task();  // Baseline
+    events = ecc_fault_get_event_count();
+
+    /* 300 SBEs per ms: stays in polling mode. Syndrome 85 (bit 6 set)
+     * is data bit 20, column 21 */
+    hal_sim_reg_poke(FIFO_POP_ADDR, 0x80000100U | 85U);
+    wait_ms(1U);
+    hal_sim_reg_poke(SBE_COUNT_ADDR, 400U);
+    CHECK(ecc_fault_poll_task() > 0U);
+    hal_sim_reg_poke(FIFO_POP_ADDR, 0U);
+
+    CHECK(ecc_fault_is_polling());
+    CHECK_EQ(ecc_get_sbe_total(), 400ULL);
+    CHECK_EQ(ecc_fault_get_event_count(), events + 1U);
+    CHECK(ecc_fault_is_active());
+    CHECK(ecc_heatmap_get_bits(bins, ECC_HEATMAP_BITS));
+    CHECK(bins[20] >= ECC_FIFO_DRAIN_PER_IRQ);
+}
+
+static void test_exit_polling(void)
+{
+    uint32_t events = ecc_fault_get_event_count();
+
+    /* No new SBEs for a window: back to interrupts */
+    wait_ms(1U);
+    (void)ecc_fault_poll_task();
+    CHECK(!ecc_fault_is_polling());
+    CHECK_EQ(hal_sim_reg_peek(ECC_CTRL_ADDR) & SBE_FAULT_MASK, 0U);
+    CHECK_EQ(ecc_fault_get_mode_switches(), 2U);
+    CHECK_EQ(ecc_fault_get_event_count(), events);
+    CHECK_EQ(ecc_fault_poll_task(), 0U);
+}
+
+int main(void)
+{
+    hal_sim_reg_reset();
+    timebase_init();
+    CHECK(ecc_init());
+    CHECK(ecc_handler_init());
+
+    RUN_TEST(test_thresholds);
+    RUN_TEST(test_enter_polling);
+    RUN_TEST(test_mbe_still_interrupts);
+    RUN_TEST(test_poll_collects);
+    RUN_TEST(test_exit_polling);
+
+    return HOST_TEST_RESULT();
+}
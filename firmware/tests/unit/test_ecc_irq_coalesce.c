@@ -0,0 +1,71 @@
+/**
+ * @file test_ecc_irq_coalesce.c
+ * @brief Host-build tests for ECC interrupt coalescing configuration
+ *
+ * Test cases:
+ *  - TC01: ecc_init programs the default IRQ_COAL value
+ *  - TC02: ecc_set_irq_coalescing writes N / T to IRQ_COAL
+ *  - TC03: Invalid settings are rejected and leave IRQ_COAL unchanged
+ *  - TC04: ecc_configure / ecc_disable keep the coalescing settings
+ */
+
+#include "host_test.h"
+#include "hal/reg_access.h"
+#include "memory/ecc_service.h"
+
+#define ECC_IRQ_COAL_ADDR (ECC_BASE_ADDR + ECC_IRQ_COAL_OFFSET)
+
+static void test_default_value(void)
+{
+    CHECK_EQ(hal_sim_reg_peek(ECC_IRQ_COAL_ADDR),
+             (ECC_IRQ_COAL_DEFAULT_TIMEOUT << 8) | ECC_IRQ_COAL_DEFAULT_COUNT);
+}
+
+static void test_set_coalescing(void)
+{
+    CHECK(ecc_set_irq_coalescing(32U, 0x123456U));
+    CHECK_EQ(hal_sim_reg_peek(ECC_IRQ_COAL_ADDR), (0x123456U << 8) | 32U);
+
+    CHECK(ecc_set_irq_coalescing(2U, ECC_IRQ_COAL_TIMEOUT_MAX));
+    CHECK_EQ(hal_sim_reg_peek(ECC_IRQ_COAL_ADDR), 0xFFFFFF02U);
+
+    /* One interrupt per error: the timeout is irrelevant and cleared */
+    CHECK(ecc_set_irq_coalescing(1U, 0U));
+    CHECK_EQ(hal_sim_reg_peek(ECC_IRQ_COAL_ADDR), 1U);
+    CHECK(ecc_set_irq_coalescing(0U, 500U));
+    CHECK_EQ(hal_sim_reg_peek(ECC_IRQ_COAL_ADDR), 0U);
+}
+
+static void test_invalid_rejected(void)
+{
+    CHECK(ecc_set_irq_coalescing(4U, 1000U));
+
+    CHECK(!ecc_set_irq_coalescing(4U, 0U));  // Could delay an SBE forever
+    CHECK(!ecc_set_irq_coalescing(4U, ECC_IRQ_COAL_TIMEOUT_MAX + 1U));
+    CHECK_EQ(hal_sim_reg_peek(ECC_IRQ_COAL_ADDR), (1000U << 8) | 4U);
+}
+
+static void test_kept_by_configure(void)
+{
+    hal_sim_reg_poke(ECC_IRQ_COAL_ADDR, 0U);  // Lost, e.g. by a block reset
+
+    CHECK(ecc_configure(1U, 5U, 1U, 1U));
+    CHECK_EQ(hal_sim_reg_peek(ECC_IRQ_COAL_ADDR), (1000U << 8) | 4U);
+
+    CHECK(ecc_disable());
+    CHECK_EQ(hal_sim_reg_peek(ECC_IRQ_COAL_ADDR), (1000U << 8) | 4U);
+    CHECK(ecc_enable());
+}
+
+int main(void)
+{
+    hal_sim_reg_reset();
+    CHECK(ecc_init());
+
+    RUN_TEST(test_default_value);
+    RUN_TEST(test_set_coalescing);
+    RUN_TEST(test_invalid_rejected);
+    RUN_TEST(test_kept_by_configure);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,117 @@
+/**
+ * @file test_ecc_status_cache.c
+ * @brief Host-build tests for the ECC status shadow cache
+ *
+ * Test cases:
+ *  - TC01: Repeated reads are served from the shadow (no register reads)
+ *  - TC02: ecc_fault_isr invalidates the shadow and refreshes it (rate check)
+ *  - TC03: ecc_clear_counters invalidates the shadow
+ *  - TC04: Counter getters share the shadow with ecc_get_status
+ */
+
+#include "host_test.h"
+#include "hal/reg_access.h"
+#include "memory/ecc_handler.h"
+#include "memory/ecc_service.h"
+
+static void poke_status(uint32_t sbe, uint32_t mbe, uint32_t err_status)
+{
+    hal_sim_reg_poke(ECC_BASE_ADDR + ECC_SBE_COUNT_OFFSET, sbe);
+    hal_sim_reg_poke(ECC_BASE_ADDR + ECC_MBE_COUNT_OFFSET, mbe);
+    hal_sim_reg_poke(ECC_BASE_ADDR + ECC_ERR_STATUS_OFFSET, err_status);
+}
+
+static void test_repeated_reads_hit(void)
+{
+    ecc_status_t status;
+    uint32_t hits, misses;
+
+    poke_status(3U, 0U, (17U << 8) | 0x01U);
+
+    CHECK(ecc_get_status(&status));
+    CHECK_EQ(status.sbe_count, 3U);
+    CHECK_EQ(status.last_error_pos, 17U);
+    CHECK(ecc_get_status_cache_stats(&hits, &misses));
+    CHECK_EQ(hits, 0U);
+    CHECK_EQ(misses, 1U);
+
+    /* Registers change without an interrupt: shadow is served */
+    poke_status(4U, 0U, (18U << 8) | 0x01U);
+    for (uint32_t i = 0; i < 10U; i++) {
+        CHECK(ecc_get_status(&status));
+    }
+    CHECK_EQ(status.sbe_count, 3U);
+    CHECK_EQ(status.last_error_pos, 17U);
+    CHECK(ecc_get_status_cache_stats(&hits, &misses));
+    CHECK_EQ(hits, 10U);
+    CHECK_EQ(misses, 1U);
+}
+
+static void test_isr_invalidates(void)
+{
+    ecc_status_t status;
+    uint32_t hits, misses;
+
+    poke_status(5U, 1U, (64U << 8) | 0x02U);
+    ecc_fault_isr();
+
+    CHECK(ecc_get_status(&status));
+    CHECK_EQ(status.sbe_count, 5U);
+    CHECK_EQ(status.mbe_count, 1U);
+    CHECK_EQ(status.last_error_type, 2U);
+    CHECK_EQ(status.last_error_pos, 64U);
+    CHECK(ecc_get_status_cache_stats(&hits, &misses));
+    CHECK_EQ(hits, 11U);
+    CHECK_EQ(misses, 2U);
+
+    CHECK(ecc_get_status(&status));
+    CHECK(ecc_get_status_cache_stats(&hits, &misses));
+    CHECK_EQ(hits, 12U);
+    CHECK_EQ(misses, 2U);
+}
+
+static void test_clear_invalidates(void)
+{
+    ecc_status_t status;
+    uint32_t misses;
+
+    poke_status(0U, 0U, 0U);
+    CHECK(ecc_clear_counters());
+
+    CHECK(ecc_get_status(&status));
+    CHECK_EQ(status.sbe_count, 0U);
+    CHECK_EQ(status.mbe_count, 0U);
+    CHECK(ecc_get_status_cache_stats(NULL, &misses));
+    CHECK_EQ(misses, 3U);
+}
+
+static void test_getters_share_shadow(void)
+{
+    uint32_t hits_before, hits, misses;
+
+    CHECK(ecc_get_status_cache_stats(&hits_before, NULL));
+
+    poke_status(9U, 2U, 0U);
+    CHECK_EQ(ecc_get_sbe_count(), 0U);  // Still the cleared snapshot
+    ecc_status_invalidate();
+    CHECK_EQ(ecc_get_sbe_count(), 9U);
+    CHECK_EQ(ecc_get_mbe_count(), 2U);
+
+    CHECK(ecc_get_status_cache_stats(&hits, &misses));
+    CHECK_EQ(hits, hits_before + 2U);
+    CHECK_EQ(misses, 4U);
+}
+
+int main(void)
+{
+    hal_sim_reg_reset();
+    CHECK(ecc_init());
+    CHECK(ecc_handler_init());
+
+    RUN_TEST(test_repeated_reads_hit);
+    RUN_TEST(test_isr_invalidates);
+    RUN_TEST(test_clear_invalidates);
+    RUN_TEST(test_getters_share_shadow);
+
+    return HOST_TEST_RESULT();
+}
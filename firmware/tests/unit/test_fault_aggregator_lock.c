@@ -0,0 +1,219 @@
+/**
+ * @file test_fault_aggregator_lock.c
+ * @brief Host-build tests for the fault aggregator try-lock
+ *
+ * Test cases:
+ *  - TC01: Uncontended aggregation takes and releases the lock
+ *  - TC02: Concurrent aggregators and ISR-style producers: every accepted
+ *          event is drained once, no call is lost, the lock ends free
+ *  - TC03: Retry bound: a request left pending when the holder runs out of
+ *          re-runs is reported by a false return and serviced by the
+ *          next call
+ */
+
+#include "host_test.h"
+#include "safety/fault_aggregator.h"
+#include "safety/fault_event_queue.h"
+#include "safety/safety_fsm.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+static void test_uncontended(void)
+{
+    fault_type_t fault = FAULT_TYPE_NONE;
+    uint32_t attempts;
+
+    attempts = fault_get_aggregation_count();
+
+    CHECK(fault_aggregate(&fault));
+    CHECK_EQ(fault, FAULT_TYPE_NONE);
+
+    CHECK(fault_event_post(FAULT_EVENT_CLK_ISR, 1U));
+    CHECK(fault_aggregate(&fault));
+    CHECK_EQ(fault, FAULT_TYPE_CLK);
+    CHECK_EQ(fault_get_aggregation_count(), attempts + 2U);
+
+    /* Lock released: priority update and reset are not refused */
+    CHECK(fault_set_priorities(1U, 2U, 3U));
+    CHECK(fault_aggregator_reset(FAULT_TYPE_CLK));
+}
+
+/* ============================================================================
+ * TC02: Burst stress (threads stand in for the safety task and ISRs)
+ * ============================================================================ */
+
+#define LOCK_STRESS_AGGREGATORS 3U
+#define LOCK_STRESS_CALLS       5000U   /* Keeps the 16-bit fault_count from wrapping */
+#define LOCK_STRESS_EVENTS      5000U
+
+static const fault_event_producer_t g_stress_producers[FAULT_EVENT_SOURCES] = {
+    FAULT_EVENT_VDD_ISR, FAULT_EVENT_CLK_ISR, FAULT_EVENT_MEM_ISR
+};
+
+static atomic_uint g_stress_ok;
+static atomic_uint g_stress_deferred;
+static atomic_uint g_stress_accepted;
+
+static void *stress_aggregator(void *arg)
+{
+    fault_type_t fault;
+
+    (void)arg;
+    for (uint32_t i = 0; i < LOCK_STRESS_CALLS; i++) {
+        if (fault_aggregate(&fault)) {
+            atomic_fetch_add(&g_stress_ok, 1U);
+        } else {
+            atomic_fetch_add(&g_stress_deferred, 1U);
+        }
+    }
+    return NULL;
+}
+
+static void *stress_producer(void *arg)
+{
+    fault_event_producer_t producer = *(const fault_event_producer_t *)arg;
+
+    for (uint32_t i = 0; i < LOCK_STRESS_EVENTS; i++) {
+        if (fault_event_post(producer, (uint16_t)i)) {
+            atomic_fetch_add(&g_stress_accepted, 1U);
+        } else {
+            (void)sched_yield();  /* Ring full: let an aggregator run */
+        }
+    }
+    return NULL;
+}
+
+static void test_burst_stress(void)
+{
+    pthread_t aggregators[LOCK_STRESS_AGGREGATORS];
+    pthread_t producers[FAULT_EVENT_SOURCES];
+    safety_status_t status;
+    fault_type_t fault;
+    uint32_t fault_count;
+    uint32_t attempts;
+    uint32_t contentions;
+    uint32_t retries;
+    uint32_t overruns;
+    uint32_t i;
+
+    CHECK(fault_aggregator_reset(FAULT_TYPE_MULTIPLE));
+    CHECK(fsm_get_status(&status));
+    fault_count = status.fault_count;
+    atomic_store(&g_stress_ok, 0U);
+    atomic_store(&g_stress_deferred, 0U);
+    atomic_store(&g_stress_accepted, 0U);
+    attempts = fault_get_aggregation_count();
+    contentions = fault_get_contention_count();
+    retries = fault_get_retry_count();
+    overruns = fault_get_overrun_count();
+
+    for (i = 0; i < FAULT_EVENT_SOURCES; i++) {
+        CHECK_EQ(pthread_create(&producers[i], NULL, stress_producer,
+                                (void *)&g_stress_producers[i]), 0);
+    }
+    for (i = 0; i < LOCK_STRESS_AGGREGATORS; i++) {
+        CHECK_EQ(pthread_create(&aggregators[i], NULL, stress_aggregator, NULL), 0);
+    }
+    for (i = 0; i < FAULT_EVENT_SOURCES; i++) {
+        (void)pthread_join(producers[i], NULL);
+    }
+    for (i = 0; i < LOCK_STRESS_AGGREGATORS; i++) {
+        (void)pthread_join(aggregators[i], NULL);
+    }
+
+    /* Final uncontended pass picks up anything posted after the last one */
+    CHECK(fault_aggregate(&fault));
+    CHECK_EQ(fault_event_pending(), 0U);
+
+    /* Every call either ran or was handed to the holder, none vanished */
+    CHECK_EQ(atomic_load(&g_stress_ok) + atomic_load(&g_stress_deferred),
+             LOCK_STRESS_AGGREGATORS * LOCK_STRESS_CALLS);
+    CHECK_EQ(fault_get_aggregation_count() - attempts,
+             LOCK_STRESS_AGGREGATORS * LOCK_STRESS_CALLS + 1U);
+    overruns = fault_get_overrun_count() - overruns;
+    CHECK_EQ(fault_get_contention_count() - contentions + overruns,
+             atomic_load(&g_stress_deferred));
+    CHECK(fault_get_retry_count() - retries <=
+          atomic_load(&g_stress_deferred) - overruns);
+
+    /* Every accepted event counted once: at least one count per event, at
+     * most one extra per pass that drained nothing */
+    CHECK(fsm_get_status(&status));
+    fault_count = (uint16_t)(status.fault_count - fault_count);
+    CHECK(fault_count >= atomic_load(&g_stress_accepted));
+    CHECK(fault_count <= atomic_load(&g_stress_accepted) + atomic_load(&g_stress_ok) +
+                         overruns + (fault_get_retry_count() - retries) + 1U);
+    CHECK_EQ(status.active_faults,
+             FAULT_TYPE_VDD | FAULT_TYPE_CLK | FAULT_TYPE_MEM_ECC);
+
+    /* Lock is free again */
+    CHECK(fault_set_priorities(1U, 2U, 3U));
+}
+
+/* ============================================================================
+ * TC03: Retry bound (an "ISR" re-raises the request during every pass)
+ * ============================================================================ */
+
+#define LOCK_MAX_RETRIES 4U   /* FAULT_AGG_MAX_RETRIES */
+
+bool __real_fsm_aggregate(fsm_aggregation_t *result);
+
+static atomic_uint g_preempt_passes;
+
+/* Linked with --wrap=fsm_aggregate: the holder's pass is preempted by a
+ * contender, which finds the lock taken and raises the pending request */
+bool __wrap_fsm_aggregate(fsm_aggregation_t *result)
+{
+    fault_type_t fault;
+    bool ok = __real_fsm_aggregate(result);
+
+    if (atomic_load(&g_preempt_passes) != 0U) {
+        atomic_fetch_sub(&g_preempt_passes, 1U);
+        CHECK(!fault_aggregate(&fault));
+    }
+    return ok;
+}
+
+static void test_retry_bound(void)
+{
+    fault_type_t fault;
+    uint32_t contentions = fault_get_contention_count();
+    uint32_t retries = fault_get_retry_count();
+    uint32_t overruns = fault_get_overrun_count();
+
+    /* Every re-run the budget allows is spent, nothing left over */
+    atomic_store(&g_preempt_passes, LOCK_MAX_RETRIES);
+    CHECK(fault_aggregate(&fault));
+    CHECK_EQ(fault_get_retry_count() - retries, LOCK_MAX_RETRIES);
+    CHECK_EQ(fault_get_overrun_count(), overruns);
+
+    /* One more contender than the budget: the holder reports it */
+    retries = fault_get_retry_count();
+    atomic_store(&g_preempt_passes, LOCK_MAX_RETRIES + 1U);
+    CHECK(!fault_aggregate(&fault));
+    CHECK_EQ(fault_get_retry_count() - retries, LOCK_MAX_RETRIES);
+    CHECK_EQ(fault_get_overrun_count() - overruns, 1U);
+    CHECK_EQ(fault_get_contention_count() - contentions,
+             2U * LOCK_MAX_RETRIES + 1U);
+
+    /* The leftover request is still flagged: the next call services it
+     * with a single pass and the lock is free afterwards */
+    retries = fault_get_retry_count();
+    CHECK(fault_aggregate(&fault));
+    CHECK_EQ(fault_get_retry_count(), retries);
+    CHECK_EQ(fault_get_overrun_count() - overruns, 1U);
+    CHECK(fault_set_priorities(1U, 2U, 3U));
+}
+
+int main(void)
+{
+    CHECK(fsm_init());
+    CHECK(fsm_transition(SAFETY_STATE_NORMAL));
+
+    RUN_TEST(test_uncontended);
+    RUN_TEST(test_burst_stress);
+    RUN_TEST(test_retry_bound);
+
+    return HOST_TEST_RESULT();
+}
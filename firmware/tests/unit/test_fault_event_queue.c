@@ -0,0 +1,271 @@
+/**
+ * @file test_fault_event_queue.c
+ * @brief Host-build tests for the ISR-to-safety-task fault event queue
+ *
+ * Test cases:
+ *  - TC01: Events of one source drain in FIFO order with rising seq
+ *  - TC02: A full ring drops new events, counts them and leaves a seq gap
+ *  - TC03: Events of different sources drain merged by timestamp
+ *  - TC04: fsm_aggregate_faults drains the queue and counts every event
+ *  - TC05: Concurrent producer/consumer threads lose or reorder nothing
+ *  - TC06: Two producers of one source post concurrently without loss
+ */
+
+#include "host_test.h"
+#include "safety/fault_event_queue.h"
+#include "safety/safety_fsm.h"
+#include "clock/clk_event_handler.h"
+#include "memory/ecc_handler.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+static void test_fifo_order_single_source(void)
+{
+    fault_event_t events[8];
+
+    fault_event_queue_init();
+
+    CHECK(fault_event_post(FAULT_EVENT_CLK_HANDLER, 10U));
+    CHECK(fault_event_post(FAULT_EVENT_CLK_HANDLER, 11U));
+    CHECK(fault_event_post(FAULT_EVENT_CLK_HANDLER, 12U));
+    CHECK_EQ(fault_event_pending(), 3U);
+
+    CHECK_EQ(fault_event_drain(events, 8U), 3U);
+    for (uint32_t i = 0; i < 3U; i++) {
+        CHECK_EQ(events[i].source, FAULT_TYPE_CLK);
+        CHECK_EQ(events[i].seq, i);
+        CHECK_EQ(events[i].info, 10U + i);
+    }
+    CHECK_EQ(fault_event_pending(), 0U);
+    CHECK_EQ(fault_event_drain(events, 8U), 0U);
+
+    /* Invalid producers are rejected */
+    CHECK(!fault_event_post(FAULT_EVENT_PRODUCERS, 0U));
+}
+
+static void test_overflow_accounting(void)
+{
+    fault_event_t events[FAULT_EVENT_QUEUE_DEPTH];
+    uint32_t i;
+
+    fault_event_queue_init();
+
+    for (i = 0; i < FAULT_EVENT_QUEUE_DEPTH; i++) {
+        CHECK(fault_event_post(FAULT_EVENT_ECC_ISR, (uint16_t)i));
+    }
+    CHECK(!fault_event_post(FAULT_EVENT_ECC_ISR, 0xAAAAU));
+    CHECK(!fault_event_post(FAULT_EVENT_ECC_ISR, 0xBBBBU));
+
+    CHECK_EQ(fault_event_get_overflow_count(FAULT_TYPE_MEM_ECC), 2U);
+    CHECK_EQ(fault_event_get_overflow_count(FAULT_TYPE_VDD), 0U);
+    CHECK_EQ(fault_event_get_overflow_count(FAULT_TYPE_NONE), 2U);
+
+    /* Partial drain frees slots; next event shows the gap in seq */
+    CHECK_EQ(fault_event_drain(events, 4U), 4U);
+    CHECK_EQ(events[0].info, 0U);
+    CHECK(fault_event_post(FAULT_EVENT_ECC_ISR, 0xCCCCU));
+
+    CHECK_EQ(fault_event_drain(events, FAULT_EVENT_QUEUE_DEPTH),
+             FAULT_EVENT_QUEUE_DEPTH - 3U);
+    CHECK_EQ(events[FAULT_EVENT_QUEUE_DEPTH - 5U].seq,
+             FAULT_EVENT_QUEUE_DEPTH - 1U);
+    CHECK_EQ(events[FAULT_EVENT_QUEUE_DEPTH - 4U].info, 0xCCCCU);
+    CHECK_EQ(events[FAULT_EVENT_QUEUE_DEPTH - 4U].seq,
+             FAULT_EVENT_QUEUE_DEPTH + 2U);
+}
+
+static void test_merge_by_timestamp(void)
+{
+    fault_event_t events[8];
+
+    fault_event_queue_init();
+
+    CHECK(fault_event_post(FAULT_EVENT_ECC_ISR, 1U));
+    CHECK(fault_event_post(FAULT_EVENT_VDD_ISR, 2U));
+    CHECK(fault_event_post(FAULT_EVENT_CLK_ISR, 3U));
+    CHECK(fault_event_post(FAULT_EVENT_PWR_HANDLER, 4U));
+    CHECK(fault_event_post(FAULT_EVENT_ECC_ISR, 5U));
+
+    CHECK_EQ(fault_event_drain(events, 8U), 5U);
+    for (uint32_t i = 0; i < 5U; i++) {
+        CHECK_EQ(events[i].info, i + 1U);
+        if (i > 0U) {
+            CHECK((int32_t)(events[i].timestamp - events[i - 1U].timestamp) >= 0);
+        }
+    }
+    CHECK_EQ(events[0].source, FAULT_TYPE_MEM_ECC);
+    CHECK_EQ(events[2].source, FAULT_TYPE_CLK);
+}
+
+static void test_fsm_drains_queue(void)
+{
+    safety_status_t status;
+    uint32_t i;
+
+    CHECK(fsm_init());
+    CHECK(fsm_transition(SAFETY_STATE_NORMAL));
+    (void)clk_event_handler_init();
+    (void)ecc_handler_init();
+
+    /* Burst of 40 CLK ISRs and one ECC ISR before the safety task runs */
+    for (i = 0; i < 40U; i++) {
+        clk_event_handler_clk_loss_isr();
+    }
+    ecc_fault_isr();
+    CHECK_EQ(fault_event_pending(), 41U);
+
+    CHECK(fsm_aggregate_faults());
+    CHECK_EQ(fault_event_pending(), 0U);
+    CHECK_EQ(fsm_get_state(), SAFETY_STATE_FAULT);
+
+    CHECK(fsm_get_status(&status));
+    CHECK_EQ(status.fault_count, 41U);
+    CHECK_EQ(status.active_faults, FAULT_TYPE_CLK | FAULT_TYPE_MEM_ECC);
+}
+
+/* ============================================================================
+ * TC05: SPSC stress (producer thread stands in for the ISR)
+ * ============================================================================ */
+
+#define STRESS_EVENTS 200000U
+
+static atomic_bool g_stress_producer_done;
+static uint32_t g_stress_rejected;
+
+static void *stress_producer(void *arg)
+{
+    (void)arg;
+    for (uint32_t i = 0; i < STRESS_EVENTS; i++) {
+        /* Retry on full so every payload must arrive exactly once */
+        while (!fault_event_post(FAULT_EVENT_VDD_ISR, (uint16_t)i)) {
+            g_stress_rejected++;
+            (void)sched_yield();  /* Single-core hosts: let the consumer run */
+        }
+    }
+    atomic_store(&g_stress_producer_done, true);
+    return NULL;
+}
+
+static void test_spsc_stress(void)
+{
+    fault_event_t events[FAULT_EVENT_QUEUE_DEPTH];
+    pthread_t producer;
+    uint32_t received = 0;
+    uint32_t out_of_order = 0;
+    bool done = false;
+
+    fault_event_queue_init();
+    g_stress_rejected = 0;
+    atomic_store(&g_stress_producer_done, false);
+    CHECK_EQ(pthread_create(&producer, NULL, stress_producer, NULL), 0);
+
+    while (!done) {
+        /* Snapshot completion before draining so the last events are seen */
+        done = atomic_load(&g_stress_producer_done);
+        uint32_t n = fault_event_drain(events, FAULT_EVENT_QUEUE_DEPTH);
+
+        for (uint32_t i = 0; i < n; i++) {
+            if (events[i].info != (uint16_t)(received + i) ||
+                events[i].source != FAULT_TYPE_VDD) {
+                out_of_order++;
+            }
+        }
+        received += n;
+        if (n == 0U) {
+            (void)sched_yield();
+        }
+    }
+
+    (void)pthread_join(producer, NULL);
+
+    CHECK_EQ(out_of_order, 0U);
+    CHECK_EQ(received, STRESS_EVENTS);
+    CHECK_EQ(fault_event_get_overflow_count(FAULT_TYPE_VDD), g_stress_rejected);
+    CHECK_EQ(fault_event_pending(), 0U);
+}
+
+/* ============================================================================
+ * TC06: vdd_isr_handler() and pwr_event_handler_vdd_fault() preempting each
+ * other (one thread each); bit 15 of info names the producer
+ * ============================================================================ */
+
+#define SHARED_EVENTS 100000U
+
+static atomic_uint g_shared_done;
+static atomic_uint g_shared_rejected;
+
+static void *shared_producer(void *arg)
+{
+    fault_event_producer_t producer = *(const fault_event_producer_t *)arg;
+    uint16_t tag = (producer == FAULT_EVENT_PWR_HANDLER) ? 0x8000U : 0U;
+
+    for (uint32_t i = 0; i < SHARED_EVENTS; i++) {
+        while (!fault_event_post(producer, (uint16_t)(tag | (i & 0x7FFFU)))) {
+            atomic_fetch_add(&g_shared_rejected, 1U);
+            (void)sched_yield();
+        }
+    }
+    atomic_fetch_add(&g_shared_done, 1U);
+    return NULL;
+}
+
+static void test_shared_source_producers(void)
+{
+    static const fault_event_producer_t kProducers[2] = {
+        FAULT_EVENT_VDD_ISR, FAULT_EVENT_PWR_HANDLER
+    };
+    fault_event_t events[FAULT_EVENT_QUEUE_DEPTH];
+    pthread_t threads[2];
+    uint32_t received[2] = {0U, 0U};
+    uint32_t out_of_order = 0;
+    bool done = false;
+
+    fault_event_queue_init();
+    atomic_store(&g_shared_done, 0U);
+    atomic_store(&g_shared_rejected, 0U);
+    for (uint32_t p = 0; p < 2U; p++) {
+        CHECK_EQ(pthread_create(&threads[p], NULL, shared_producer,
+                                (void *)&kProducers[p]), 0);
+    }
+
+    while (!done) {
+        done = (atomic_load(&g_shared_done) == 2U);
+        uint32_t n = fault_event_drain(events, FAULT_EVENT_QUEUE_DEPTH);
+
+        for (uint32_t i = 0; i < n; i++) {
+            uint32_t p = events[i].info >> 15;
+            if ((events[i].info & 0x7FFFU) != (received[p] & 0x7FFFU) ||
+                events[i].source != FAULT_TYPE_VDD) {
+                out_of_order++;
+            }
+            received[p]++;
+        }
+        if (n == 0U) {
+            (void)sched_yield();
+        }
+    }
+
+    for (uint32_t p = 0; p < 2U; p++) {
+        (void)pthread_join(threads[p], NULL);
+    }
+
+    CHECK_EQ(out_of_order, 0U);
+    CHECK_EQ(received[0], SHARED_EVENTS);
+    CHECK_EQ(received[1], SHARED_EVENTS);
+    CHECK_EQ(fault_event_get_overflow_count(FAULT_TYPE_VDD),
+             atomic_load(&g_shared_rejected));
+    CHECK_EQ(fault_event_pending(), 0U);
+}
+
+int main(void)
+{
+    RUN_TEST(test_fifo_order_single_source);
+    RUN_TEST(test_overflow_accounting);
+    RUN_TEST(test_merge_by_timestamp);
+    RUN_TEST(test_fsm_drains_queue);
+    RUN_TEST(test_spsc_stress);
+    RUN_TEST(test_shared_source_producers);
+
+    return HOST_TEST_RESULT();
+}
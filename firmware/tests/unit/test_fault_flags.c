@@ -0,0 +1,157 @@
+/**
+ * @file test_fault_flags.c
+ * @brief Host-build tests for the packed fault flag word
+ *
+ * Test cases:
+ *  - TC01: VERIFY_FAULT_FLAGS accepts only consistent flag/complement words
+ *  - TC02: Set/clear keep the complement byte in step
+ *  - TC03: fsm_aggregate_faults maps the flag byte to active_faults
+ *  - TC04: fsm_aggregate reports active mask, highest fault and priority
+ *  - TC05: Concurrent updates of different sources never lose a flag or
+ *          expose an inconsistent word
+ */
+
+#include "host_test.h"
+#include "safety/safety_fsm.h"
+#include "safety/fault_aggregator.h"
+#include <pthread.h>
+#include <stdatomic.h>
+
+static void test_verify_macro(void)
+{
+    CHECK(VERIFY_FAULT_FLAGS(FAULT_FLAGS_CLEAR));
+    CHECK(VERIFY_FAULT_FLAGS(0x0000FE01UL));   /* VDD */
+    CHECK(VERIFY_FAULT_FLAGS(0x0000F807UL));   /* VDD | CLK | MEM */
+
+    CHECK(!VERIFY_FAULT_FLAGS(0x00000000UL));  /* Complement lost */
+    CHECK(!VERIFY_FAULT_FLAGS(0x0000FF01UL));  /* Flag without complement */
+    CHECK(!VERIFY_FAULT_FLAGS(0x0000FE00UL));  /* Complement without flag */
+    CHECK(!VERIFY_FAULT_FLAGS(0x0001FF00UL));  /* Reserved bit set */
+    CHECK(!VERIFY_FAULT_FLAGS(0x8000FF00UL));
+}
+
+static void test_set_clear_keeps_complement(void)
+{
+    safety_status_t status;
+
+    CHECK(fsm_init());
+    CHECK(fsm_get_status(&status));
+    CHECK_EQ(status.fault_flags.word, FAULT_FLAGS_CLEAR);
+
+    fsm_set_fault_flag(FAULT_TYPE_CLK);
+    CHECK(fsm_get_status(&status));
+    CHECK_EQ(status.fault_flags.word, 0x0000FD02UL);
+
+    fsm_set_fault_flag(FAULT_TYPE_MEM_ECC);
+    fsm_set_fault_flag(FAULT_TYPE_CLK);
+    CHECK(fsm_get_status(&status));
+    CHECK_EQ(status.fault_flags.word, 0x0000F906UL);
+
+    /* Not a source bit: ignored */
+    fsm_set_fault_flag(FAULT_TYPE_INVALID);
+    CHECK(fsm_get_status(&status));
+    CHECK_EQ(status.fault_flags.word, 0x0000F906UL);
+    CHECK(fsm_fault_flags_valid());
+}
+
+static void test_aggregate_from_word(void)
+{
+    safety_status_t status;
+
+    CHECK(fsm_transition(SAFETY_STATE_NORMAL));
+    CHECK(fsm_aggregate_faults());
+    CHECK_EQ(fsm_get_state(), SAFETY_STATE_FAULT);
+    CHECK(fsm_get_status(&status));
+    CHECK_EQ(status.active_faults, FAULT_TYPE_CLK | FAULT_TYPE_MEM_ECC);
+
+    CHECK(fsm_clear_faults(FAULT_TYPE_CLK));
+    CHECK(fsm_get_status(&status));
+    CHECK_EQ(status.active_faults, FAULT_TYPE_MEM_ECC);
+    CHECK_EQ(status.fault_flags.word, 0x0000FB04UL);
+
+    CHECK(fsm_clear_faults(FAULT_TYPE_MULTIPLE));
+    CHECK(fsm_get_status(&status));
+    CHECK_EQ(status.active_faults, FAULT_TYPE_NONE);
+    CHECK_EQ(status.fault_flags.word, FAULT_FLAGS_CLEAR);
+}
+
+static void test_aggregate_result(void)
+{
+    fsm_aggregation_t result;
+    fault_type_t highest;
+
+    CHECK(fsm_aggregate(&result));
+    CHECK_EQ(result.active, FAULT_TYPE_NONE);
+    CHECK_EQ(result.highest, FAULT_TYPE_NONE);
+    CHECK_EQ(result.priority, 0U);
+
+    fsm_set_fault_flag(FAULT_TYPE_MEM_ECC);
+    fsm_set_fault_flag(FAULT_TYPE_CLK);
+    CHECK(fsm_aggregate(&result));
+    CHECK_EQ(result.active, FAULT_TYPE_CLK | FAULT_TYPE_MEM_ECC);
+    CHECK_EQ(result.highest, FAULT_TYPE_CLK);
+    CHECK_EQ(result.priority, 2U);
+
+    /* Wrapper returns the same highest-priority fault */
+    fsm_set_fault_flag(FAULT_TYPE_VDD);
+    CHECK(fault_aggregate(&highest));
+    CHECK_EQ(highest, FAULT_TYPE_VDD);
+    CHECK(!fault_aggregate(NULL));
+
+    CHECK(fsm_clear_faults(FAULT_TYPE_MULTIPLE));
+}
+
+/* ============================================================================
+ * TC05: Concurrent RMW (thread stands in for a preempting ISR)
+ * ============================================================================ */
+
+#define CONCURRENT_ROUNDS 200000U
+
+static atomic_uint g_invalid_seen;
+
+static void *vdd_toggler(void *arg)
+{
+    (void)arg;
+    for (uint32_t i = 0; i < CONCURRENT_ROUNDS; i++) {
+        fsm_set_fault_flag(FAULT_TYPE_VDD);
+        (void)fsm_clear_faults(FAULT_TYPE_VDD);
+        if (!fsm_fault_flags_valid()) {
+            atomic_fetch_add(&g_invalid_seen, 1U);
+        }
+    }
+    return NULL;
+}
+
+static void test_concurrent_updates(void)
+{
+    safety_status_t status;
+    pthread_t thread;
+
+    atomic_store(&g_invalid_seen, 0U);
+    CHECK_EQ(pthread_create(&thread, NULL, vdd_toggler, NULL), 0);
+
+    /* Set CLK and MEM repeatedly while VDD toggles on the other thread */
+    for (uint32_t i = 0; i < CONCURRENT_ROUNDS; i++) {
+        fsm_set_fault_flag((i & 1U) ? FAULT_TYPE_CLK : FAULT_TYPE_MEM_ECC);
+        if (!fsm_fault_flags_valid()) {
+            atomic_fetch_add(&g_invalid_seen, 1U);
+        }
+    }
+
+    (void)pthread_join(thread, NULL);
+
+    CHECK_EQ(atomic_load(&g_invalid_seen), 0U);
+    CHECK(fsm_get_status(&status));
+    CHECK_EQ(status.fault_flags.word, 0x0000F906UL);
+}
+
+int main(void)
+{
+    RUN_TEST(test_verify_macro);
+    RUN_TEST(test_set_clear_keeps_complement);
+    RUN_TEST(test_aggregate_from_word);
+    RUN_TEST(test_aggregate_result);
+    RUN_TEST(test_concurrent_updates);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,134 @@
+/**
+ * @file test_fault_priority.c
+ * @brief Host-build tests for the branch-free fault priority resolver
+ *
+ * Test cases:
+ *  - TC01: Default table matches the P1 VDD > P2 CLK > P3 MEM if-chain
+ *  - TC02: Every configuration and mask matches a reference resolver
+ *  - TC03: Out-of-range levels are rejected and leave the table unchanged
+ *  - TC04: fault_set_priorities changes fault_aggregate and
+ *          fault_get_highest_priority
+ */
+
+#include "host_test.h"
+#include "safety/fault_priority.h"
+#include "safety/fault_aggregator.h"
+#include "safety/safety_fsm.h"
+
+/** @brief Reference: lowest level wins, ties go to the lower source bit */
+static fault_type_t reference_resolve(uint32_t active, const uint8_t levels[3],
+                                      uint8_t *level)
+{
+    fault_type_t winner = FAULT_TYPE_NONE;
+
+    *level = 0U;
+    for (uint32_t bit = 0; bit < 3U; bit++) {
+        if ((active & (1U << bit)) != 0U &&
+            (*level == 0U || levels[bit] < *level)) {
+            winner = (fault_type_t)(1U << bit);
+            *level = levels[bit];
+        }
+    }
+    return winner;
+}
+
+static void test_default_table(void)
+{
+    uint8_t level;
+
+    CHECK_EQ(g_fault_priority_lut, FAULT_PRIORITY_DEFAULT_LUT);
+    CHECK_EQ(fault_priority_compute(1U, 2U, 3U), FAULT_PRIORITY_DEFAULT_LUT);
+
+    CHECK_EQ(fault_priority_resolve(FAULT_TYPE_NONE, &level), FAULT_TYPE_NONE);
+    CHECK_EQ(level, 0U);
+    CHECK_EQ(fault_priority_resolve(FAULT_TYPE_MULTIPLE, &level), FAULT_TYPE_VDD);
+    CHECK_EQ(level, 1U);
+    CHECK_EQ(fault_priority_resolve(FAULT_TYPE_CLK | FAULT_TYPE_MEM_ECC, &level),
+             FAULT_TYPE_CLK);
+    CHECK_EQ(level, 2U);
+    CHECK_EQ(fault_priority_resolve(FAULT_TYPE_MEM_ECC, &level), FAULT_TYPE_MEM_ECC);
+    CHECK_EQ(level, 3U);
+
+    /* Bits outside the source mask are ignored */
+    CHECK_EQ(fault_priority_resolve(0xF8U | FAULT_TYPE_CLK, &level), FAULT_TYPE_CLK);
+}
+
+static void test_all_configurations(void)
+{
+    uint8_t levels[3];
+    uint8_t level, ref_level;
+    uint32_t mismatches = 0;
+
+    for (levels[0] = 1U; levels[0] <= 3U; levels[0]++) {
+        for (levels[1] = 1U; levels[1] <= 3U; levels[1]++) {
+            for (levels[2] = 1U; levels[2] <= 3U; levels[2]++) {
+                CHECK(fault_priority_build(levels[0], levels[1], levels[2]));
+                for (uint32_t mask = 0; mask <= FAULT_TYPE_MULTIPLE; mask++) {
+                    fault_type_t got = fault_priority_resolve(mask, &level);
+                    fault_type_t ref = reference_resolve(mask, levels, &ref_level);
+
+                    if (got != ref || level != ref_level) {
+                        mismatches++;
+                    }
+                }
+            }
+        }
+    }
+    CHECK_EQ(mismatches, 0U);
+
+    CHECK(fault_priority_build(1U, 2U, 3U));
+    CHECK_EQ(g_fault_priority_lut, FAULT_PRIORITY_DEFAULT_LUT);
+}
+
+static void test_invalid_levels(void)
+{
+    uint32_t before = g_fault_priority_lut;
+
+    CHECK_EQ(fault_priority_compute(0U, 2U, 3U), 0U);
+    CHECK(!fault_priority_build(1U, 4U, 3U));
+    CHECK(!fault_priority_build(1U, 2U, 0U));
+    CHECK_EQ(g_fault_priority_lut, before);
+
+    CHECK(!fault_set_priorities(1U, 2U, 4U));
+    CHECK_EQ(g_fault_priority_lut, before);
+}
+
+static void test_runtime_priorities(void)
+{
+    fault_type_t fault = FAULT_TYPE_NONE;
+    uint8_t priority = 0;
+
+    CHECK(fsm_init());
+    CHECK(fsm_transition(SAFETY_STATE_NORMAL));
+    fsm_set_fault_flag(FAULT_TYPE_VDD);
+    fsm_set_fault_flag(FAULT_TYPE_MEM_ECC);
+
+    CHECK(fault_aggregate(&fault));
+    CHECK_EQ(fault, FAULT_TYPE_VDD);
+
+    /* Memory promoted to P1, VDD demoted to P3 */
+    CHECK(fault_set_priorities(3U, 2U, 1U));
+    CHECK(fault_aggregate(&fault));
+    CHECK_EQ(fault, FAULT_TYPE_MEM_ECC);
+    CHECK_EQ(fault_get_highest_priority(&priority), FAULT_TYPE_MEM_ECC);
+    CHECK_EQ(priority, 1U);
+
+    /* Equal levels: source order decides */
+    CHECK(fault_set_priorities(2U, 2U, 2U));
+    CHECK_EQ(fault_get_highest_priority(&priority), FAULT_TYPE_VDD);
+    CHECK_EQ(priority, 2U);
+
+    CHECK(fault_set_priorities(1U, 2U, 3U));
+    CHECK_EQ(fault_get_highest_priority(&priority), FAULT_TYPE_VDD);
+    CHECK_EQ(priority, 1U);
+}
+
+int main(void)
+{
+    RUN_TEST(test_default_table);
+    RUN_TEST(test_all_configurations);
+    RUN_TEST(test_invalid_levels);
+    RUN_TEST(test_runtime_priorities);
+
+    return HOST_TEST_RESULT();
+}
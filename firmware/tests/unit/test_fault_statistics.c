@@ -0,0 +1,270 @@
+/**
+ * @file test_fault_statistics.c
+ * @brief Host-build tests for the windowed fault rate engine
+ *
+ * Time is driven through fault_stats_update_uptime(), so windows are
+ * deterministic.
+ *
+ * Test cases:
+ *  - TC01: Faults land in the 1 min / 1 h / 24 h windows of their type
+ *  - TC02: The oldest bucket is weighted by its part inside the window
+ *  - TC03: Hour and day windows drop faults once they are out of range
+ *  - TC04: The EWMA follows the per-minute rate and flags acceleration
+ *  - TC05: Faults per hour come from the last hour, not the lifetime
+ *  - TC06: A long silence clears every window
+ *  - TC07: Reaction times land in their type's histogram, once per detection
+ *  - TC08: fsm_aggregate records ISR-to-FAULT latency for each source
+ */
+
+#include "host_test.h"
+#include "safety/fault_statistics.h"
+#include "safety/fault_event_queue.h"
+#include "safety/safety_fsm.h"
+#include "hal/timebase.h"
+
+#define MINUTE_MS 60000ULL
+#define HOUR_MS   3600000ULL
+
+/** @brief Record n detected faults of one type at the given uptime */
+static void faults_at(uint64_t uptime_ms, fault_type_t type, uint32_t n)
+{
+    CHECK(fault_stats_update_uptime(uptime_ms));
+    for (uint32_t i = 0; i < n; i++) {
+        CHECK(fault_stats_record_detected(type));
+    }
+}
+
+/** @brief Busy-wait on the timebase (host ticks are real time) */
+static void wait_us(uint32_t us)
+{
+    uint64_t end = timebase_ticks64() + (uint64_t)us * TIMEBASE_TICKS_PER_US;
+
+    while (timebase_ticks64() < end) {
+    }
+}
+
+static latency_hist_t g_snapshot;
+
+static fault_rate_t rate_at(uint64_t uptime_ms, fault_type_t type)
+{
+    fault_rate_t rate = { 0U, 0U, 0U, 0U, false };
+
+    CHECK(fault_stats_update_uptime(uptime_ms));
+    CHECK(fault_stats_get_fault_rate(type, &rate));
+    return rate;
+}
+
+static void test_windows_per_type(void)
+{
+    fault_rate_t rate;
+
+    CHECK(fault_stats_reset());
+    faults_at(1000U, FAULT_TYPE_VDD, 3U);
+    faults_at(2000U, FAULT_TYPE_MEM_ECC, 5U);
+
+    rate = rate_at(30000U, FAULT_TYPE_VDD);
+    CHECK_EQ(rate.last_1min, 3U);
+    CHECK_EQ(rate.last_1h, 3U);
+    CHECK_EQ(rate.last_24h, 3U);
+
+    rate = rate_at(30000U, FAULT_TYPE_MEM_ECC);
+    CHECK_EQ(rate.last_1min, 5U);
+    rate = rate_at(30000U, FAULT_TYPE_CLK);
+    CHECK_EQ(rate.last_1h, 0U);
+
+    CHECK(!fault_stats_get_fault_rate(FAULT_TYPE_MULTIPLE, &rate));
+    CHECK(!fault_stats_get_fault_rate(FAULT_TYPE_VDD, NULL));
+}
+
+static void test_sliding_tail(void)
+{
+    fault_rate_t rate;
+
+    CHECK(fault_stats_reset());
+    faults_at(10U * MINUTE_MS, FAULT_TYPE_CLK, 100U);  /* Minute 10 */
+
+    /* 15s into minute 11: 3/4 of minute 10 is still inside */
+    rate = rate_at(11U * MINUTE_MS + 15000U, FAULT_TYPE_CLK);
+    CHECK_EQ(rate.last_1min, 75U);
+    CHECK_EQ(rate.last_1h, 100U);
+
+    rate = rate_at(12U * MINUTE_MS, FAULT_TYPE_CLK);
+    CHECK_EQ(rate.last_1min, 0U);
+
+    /* 30s into minute 70: minute 10 is the oldest bucket of the hour */
+    rate = rate_at(70U * MINUTE_MS + 30000U, FAULT_TYPE_CLK);
+    CHECK_EQ(rate.last_1h, 50U);
+    rate = rate_at(71U * MINUTE_MS, FAULT_TYPE_CLK);
+    CHECK_EQ(rate.last_1h, 0U);
+    CHECK_EQ(rate.last_24h, 100U);
+}
+
+static void test_day_window(void)
+{
+    fault_rate_t rate;
+
+    CHECK(fault_stats_reset());
+    faults_at(1U * HOUR_MS, FAULT_TYPE_MEM_ECC, 40U);   /* Hour 1 */
+    faults_at(5U * HOUR_MS, FAULT_TYPE_MEM_ECC, 8U);    /* Hour 5 */
+
+    rate = rate_at(20U * HOUR_MS, FAULT_TYPE_MEM_ECC);
+    CHECK_EQ(rate.last_1h, 0U);
+    CHECK_EQ(rate.last_24h, 48U);
+
+    /* Hour 25 opened: hour 1 is the oldest bucket, fully inside */
+    rate = rate_at(25U * HOUR_MS, FAULT_TYPE_MEM_ECC);
+    CHECK_EQ(rate.last_24h, 48U);
+    rate = rate_at(25U * HOUR_MS + HOUR_MS / 2U, FAULT_TYPE_MEM_ECC);
+    CHECK_EQ(rate.last_24h, 28U);
+    rate = rate_at(26U * HOUR_MS, FAULT_TYPE_MEM_ECC);
+    CHECK_EQ(rate.last_24h, 8U);
+}
+
+static void test_ewma_trend(void)
+{
+    fault_rate_t rate;
+    uint64_t t;
+
+    CHECK(fault_stats_reset());
+
+    /* One SBE every 10 minutes for 23 hours: steady background */
+    for (t = 0; t < 23U * 60U; t += 10U) {
+        faults_at(t * MINUTE_MS, FAULT_TYPE_MEM_ECC, 1U);
+    }
+    rate = rate_at(23U * HOUR_MS, FAULT_TYPE_MEM_ECC);
+    CHECK(rate.ewma_per_min_x100 < 50U);
+    CHECK(!rate.accelerating);
+
+    /* Then 4 SBEs per minute: the EWMA climbs within minutes */
+    for (t = 23U * 60U; t < 23U * 60U + 10U; t++) {
+        faults_at(t * MINUTE_MS, FAULT_TYPE_MEM_ECC, 4U);
+    }
+    rate = rate_at((23U * 60U + 10U) * MINUTE_MS, FAULT_TYPE_MEM_ECC);
+    CHECK(rate.ewma_per_min_x100 > 250U);
+    CHECK(rate.ewma_per_min_x100 <= 400U);
+    CHECK_EQ(rate.last_1h, 40U + 5U);
+    CHECK(rate.accelerating);
+
+    /* Back to silence: the EWMA decays and the trend clears */
+    rate = rate_at((23U * 60U + 60U) * MINUTE_MS, FAULT_TYPE_MEM_ECC);
+    CHECK(rate.ewma_per_min_x100 < 10U);
+    CHECK(!rate.accelerating);
+}
+
+static void test_rate_per_hour(void)
+{
+    uint16_t fph = 0xABCDU;
+
+    CHECK(fault_stats_reset());
+    CHECK(!fault_stats_get_fault_rate_per_hour(NULL));
+
+    /* Old faults no longer count; no overflow at long uptimes */
+    faults_at(1000U * HOUR_MS, FAULT_TYPE_VDD, 500U);
+    faults_at(1002U * HOUR_MS, FAULT_TYPE_VDD, 2U);
+    faults_at(1002U * HOUR_MS + 1000U, FAULT_TYPE_CLK, 3U);
+    CHECK(fault_stats_get_fault_rate_per_hour(&fph));
+    CHECK_EQ(fph, 5U);
+    CHECK_EQ(fault_stats_get_total_faults(), 505U);
+}
+
+static void test_idle_reset(void)
+{
+    fault_rate_t rate;
+
+    CHECK(fault_stats_reset());
+    faults_at(MINUTE_MS, FAULT_TYPE_CLK, 50U);
+
+    rate = rate_at(30U * 24U * HOUR_MS, FAULT_TYPE_CLK);
+    CHECK_EQ(rate.last_1min, 0U);
+    CHECK_EQ(rate.last_1h, 0U);
+    CHECK_EQ(rate.last_24h, 0U);
+    CHECK_EQ(rate.ewma_per_min_x100, 0U);
+
+    faults_at(30U * 24U * HOUR_MS + 1000U, FAULT_TYPE_CLK, 2U);
+    rate = rate_at(30U * 24U * HOUR_MS + 2000U, FAULT_TYPE_CLK);
+    CHECK_EQ(rate.last_1min, 2U);
+    CHECK_EQ(rate.last_24h, 2U);
+}
+
+static void test_reaction_latency(void)
+{
+    fault_statistics_t stats;
+    uint32_t detect;
+
+    CHECK(fault_stats_reset());
+
+    detect = timebase_ticks32();
+    wait_us(2000U);
+    CHECK(fault_stats_record_latency(FAULT_TYPE_MEM_ECC, detect));
+
+    /* The second reaction path to the same detection is not counted */
+    CHECK(!fault_stats_record_latency(FAULT_TYPE_MEM_ECC, detect));
+    CHECK(!fault_stats_record_latency(FAULT_TYPE_MULTIPLE, detect));
+
+    /* A new detection is */
+    detect = timebase_ticks32();
+    CHECK(fault_stats_record_latency(FAULT_TYPE_MEM_ECC, detect));
+
+    CHECK(fault_stats_get_statistics(&stats));
+    CHECK_EQ(stats.mem_latency.samples, 2U);
+    CHECK_EQ(stats.vdd_latency.samples, 0U);
+    CHECK_EQ(stats.clk_latency.p999_us, 0U);
+    CHECK(stats.mem_latency.max_us >= 2000U);
+    CHECK(stats.mem_latency.p999_us == stats.mem_latency.max_us);
+    CHECK(stats.mem_latency.p50_us < 2000U);
+
+    CHECK(fault_stats_get_latency_histogram(FAULT_TYPE_MEM_ECC, &g_snapshot));
+    CHECK_EQ(g_snapshot.total, 2U);
+    CHECK(!fault_stats_get_latency_histogram(FAULT_TYPE_NONE, &g_snapshot));
+    CHECK(!fault_stats_get_latency_histogram(FAULT_TYPE_VDD, NULL));
+
+    CHECK(fault_stats_reset());
+    CHECK(fault_stats_get_statistics(&stats));
+    CHECK_EQ(stats.mem_latency.samples, 0U);
+}
+
+static void test_fsm_reaction_latency(void)
+{
+    fault_statistics_t stats;
+
+    CHECK(fault_stats_reset());
+    CHECK(fsm_init());
+    CHECK(fsm_transition(SAFETY_STATE_NORMAL));
+    fault_event_queue_init();
+
+    CHECK(fault_event_post(FAULT_EVENT_VDD_ISR, 0U));
+    wait_us(500U);
+    CHECK(fault_event_post(FAULT_EVENT_CLK_ISR, 0U));
+    CHECK(fault_event_post(FAULT_EVENT_VDD_ISR, 0U));
+
+    CHECK(fsm_aggregate_faults());
+    CHECK_EQ(fsm_get_state(), SAFETY_STATE_FAULT);
+
+    /* One sample per source, from its oldest event */
+    CHECK(fault_stats_get_statistics(&stats));
+    CHECK_EQ(stats.vdd_latency.samples, 1U);
+    CHECK_EQ(stats.clk_latency.samples, 1U);
+    CHECK_EQ(stats.mem_latency.samples, 0U);
+    CHECK(stats.vdd_latency.max_us >= 500U);
+    CHECK(stats.vdd_latency.max_us > stats.clk_latency.max_us);
+
+    /* Already in FAULT: further events are no new reaction */
+    CHECK(fault_event_post(FAULT_EVENT_MEM_ISR, 0U));
+    CHECK(fsm_aggregate_faults());
+    CHECK(fault_stats_get_statistics(&stats));
+    CHECK_EQ(stats.mem_latency.samples, 0U);
+}
+
+int main(void)
+{
+    RUN_TEST(test_windows_per_type);
+    RUN_TEST(test_sliding_tail);
+    RUN_TEST(test_day_window);
+    RUN_TEST(test_ewma_trend);
+    RUN_TEST(test_rate_per_hour);
+    RUN_TEST(test_idle_reset);
+    RUN_TEST(test_reaction_latency);
+    RUN_TEST(test_fsm_reaction_latency);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,182 @@
+/**
+ * @file test_flight_recorder.c
+ * @brief Host-build tests for the reset-surviving flight recorder
+ *
+ * The host region is zero at process start (power-on); calling
+ * flight_recorder_init() again models a warm reset. The test cases run
+ * in order on the same region.
+ *
+ * Test cases:
+ *  - TC01: Layout and CRC match the shared definition; nothing is
+ *          recorded before init; a zeroed region is formatted
+ *  - TC02: fsm_init, transitions and fault events append records
+ *  - TC03: A warm reset preserves the ring and appends a BOOT marker
+ *  - TC04: A corrupted header or head complement reformats the ring
+ *  - TC05: The ring wraps; preserved records age out oldest first
+ */
+
+#include "host_test.h"
+#include "safety/flight_recorder.h"
+#include "safety/fault_event_queue.h"
+#include "safety/safety_fsm.h"
+#include "hal/timebase.h"
+
+static flight_recorder_t *region(void)
+{
+    /* Tests stand in for bit flips, so they write the const region */
+    return (flight_recorder_t *)flight_recorder_region();
+}
+
+static flight_record_t last_record(void)
+{
+    flight_record_t rec = { 0U, 0U, 0U, 0U, 0U, 0U, 0U };
+
+    CHECK(flight_recorder_read(flight_recorder_count() - 1U, &rec));
+    return rec;
+}
+
+static void test_format(void)
+{
+    CHECK_EQ(sizeof(flight_record_t), 12U);
+    CHECK_EQ(sizeof(flight_recorder_header_t), 24U);
+    CHECK_EQ(offsetof(flight_recorder_t, records), 48U);
+    CHECK_EQ(flight_recorder_crc32("123456789", 9U), 0xCBF43926UL);
+
+    /* Region not checked yet: writes are dropped */
+    flight_recorder_fault(FAULT_TYPE_VDD, 1U);
+    CHECK_EQ(flight_recorder_count(), 0U);
+    CHECK_EQ(region()->head, 0U);
+
+    CHECK(!flight_recorder_init());
+    CHECK(flight_recorder_header_valid(&region()->header));
+    CHECK_EQ(region()->header.tick_hz, (uint32_t)TIMEBASE_TICK_HZ);
+    CHECK_EQ(region()->header.boot_count, 0U);
+    CHECK_EQ(region()->head_cmp, 0xFFFFFFFFUL);
+    CHECK_EQ(flight_recorder_count(), 0U);
+}
+
+static void test_fsm_records(void)
+{
+    flight_record_t rec;
+    uint64_t end;
+
+    /* The formatted ring is valid, so fsm_init keeps it (marker only) */
+    CHECK(fsm_init());
+    CHECK_EQ(flight_recorder_count(), 1U);
+    CHECK_EQ(region()->header.boot_count, 1U);
+
+    CHECK(fsm_transition(SAFETY_STATE_NORMAL));
+    rec = last_record();
+    CHECK_EQ(rec.kind, FLIGHT_RECORD_TRANSITION);
+    CHECK_EQ(rec.state_before, SAFETY_STATE_INIT);
+    CHECK_EQ(rec.state_after, SAFETY_STATE_NORMAL);
+    CHECK_EQ(rec.seq, 1U);
+
+    end = timebase_ticks64() + 200U * TIMEBASE_TICKS_PER_US;
+    while (timebase_ticks64() < end) {
+    }
+
+    CHECK(fault_event_post(FAULT_EVENT_CLK_ISR, 0x0123U));
+    rec = last_record();
+    CHECK_EQ(rec.kind, FLIGHT_RECORD_FAULT);
+    CHECK_EQ(rec.source, FAULT_TYPE_CLK);
+    CHECK_EQ(rec.syndrome, 0x0123U);
+    CHECK_EQ(rec.state_before, SAFETY_STATE_NORMAL);
+    CHECK_EQ(rec.state_after, SAFETY_STATE_NORMAL);
+    CHECK(rec.delta_ticks >= 200U * TIMEBASE_TICKS_PER_US);
+
+    CHECK(fsm_aggregate_faults());
+    rec = last_record();
+    CHECK_EQ(rec.kind, FLIGHT_RECORD_TRANSITION);
+    CHECK_EQ(rec.source, FAULT_TYPE_CLK);
+    CHECK_EQ(rec.state_before, SAFETY_STATE_NORMAL);
+    CHECK_EQ(rec.state_after, SAFETY_STATE_FAULT);
+    CHECK_EQ(flight_recorder_count(), 4U);
+}
+
+static void test_warm_reset(void)
+{
+    flight_record_t rec;
+
+    CHECK(flight_recorder_init());
+    CHECK_EQ(flight_recorder_preserved_count(), 4U);
+    CHECK_EQ(flight_recorder_count(), 5U);
+    CHECK_EQ(region()->header.boot_count, 2U);
+    CHECK(flight_recorder_header_valid(&region()->header));
+
+    rec = last_record();
+    CHECK_EQ(rec.kind, FLIGHT_RECORD_BOOT);
+    CHECK_EQ(rec.delta_ticks, 0U);
+    CHECK_EQ(rec.syndrome, 2U);
+    CHECK_EQ(rec.state_before, SAFETY_STATE_FAULT);   /* State at the reset */
+    CHECK_EQ(rec.state_after, SAFETY_STATE_INIT);
+
+    /* Records from before the reset are unchanged */
+    CHECK(flight_recorder_read(2U, &rec));
+    CHECK_EQ(rec.kind, FLIGHT_RECORD_FAULT);
+    CHECK_EQ(rec.syndrome, 0x0123U);
+    CHECK(!flight_recorder_read(5U, &rec));
+    CHECK(!flight_recorder_read(0U, NULL));
+}
+
+static void test_corruption(void)
+{
+    region()->header.capacity ^= 0x10U;
+    CHECK(!flight_recorder_init());
+    CHECK_EQ(flight_recorder_count(), 0U);
+    CHECK_EQ(region()->header.boot_count, 0U);
+
+    flight_recorder_fault(FAULT_TYPE_MEM_ECC, 7U);
+    CHECK(flight_recorder_init());
+    CHECK_EQ(flight_recorder_preserved_count(), 1U);
+
+    region()->head_cmp ^= 1U;
+    CHECK(!flight_recorder_init());
+    CHECK_EQ(flight_recorder_count(), 0U);
+}
+
+static void test_wrap(void)
+{
+    flight_record_t rec;
+    uint32_t i;
+
+    flight_recorder_clear();
+    for (i = 0; i < 10U; i++) {
+        flight_recorder_fault(FAULT_TYPE_VDD, (uint16_t)i);
+    }
+    CHECK(flight_recorder_init());
+    CHECK_EQ(flight_recorder_preserved_count(), 10U);
+
+    /* 11 records so far; 250 more push the 5 oldest out */
+    for (i = 0; i < 250U; i++) {
+        flight_recorder_fault(FAULT_TYPE_CLK, (uint16_t)(100U + i));
+    }
+    CHECK_EQ(flight_recorder_count(), FLIGHT_RECORDER_CAPACITY);
+    CHECK_EQ(flight_recorder_preserved_count(), 5U);
+
+    CHECK(flight_recorder_read(0U, &rec));
+    CHECK_EQ(rec.seq, 5U);
+    CHECK_EQ(rec.syndrome, 5U);
+    CHECK(flight_recorder_read(FLIGHT_RECORDER_CAPACITY - 1U, &rec));
+    CHECK_EQ(rec.syndrome, 349U);
+
+    for (i = 0; i < 10U; i++) {
+        flight_recorder_fault(FAULT_TYPE_CLK, 0U);
+    }
+    CHECK_EQ(flight_recorder_preserved_count(), 0U);
+
+    flight_recorder_clear();
+    CHECK_EQ(flight_recorder_count(), 0U);
+    CHECK(flight_recorder_header_valid(&region()->header));
+}
+
+int main(void)
+{
+    RUN_TEST(test_format);
+    RUN_TEST(test_fsm_records);
+    RUN_TEST(test_warm_reset);
+    RUN_TEST(test_corruption);
+    RUN_TEST(test_wrap);
+
+    return HOST_TEST_RESULT();
+}
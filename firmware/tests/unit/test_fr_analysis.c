@@ -0,0 +1,214 @@
+/**
+ * @file test_fr_analysis.c
+ * @brief Host-build tests for the flight recorder dump analyzer
+ *
+ * The dumps are written from the real firmware region after a fault
+ * sequence driven through the FSM, so the analyzer is checked against
+ * what the firmware actually records.
+ *
+ * Test cases:
+ *  - TC01: A region decodes into fault, transition, latency and cascade
+ *          aggregates
+ *  - TC02: Torn slots are counted and end the session they belong to
+ *  - TC03: Regions are found at any aligned offset of a file; a corrupted
+ *          header is skipped
+ *  - TC04: Chunking and thread count do not change the result
+ */
+
+#define _GNU_SOURCE
+
+#include "host_test.h"
+#include "fr_analysis.h"
+#include "safety/fault_event_queue.h"
+#include "safety/safety_fsm.h"
+#include "hal/timebase.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/** @brief Source and state indices used by the checks */
+#define SRC_VDD 0U
+#define SRC_CLK 1U
+#define ST_INIT   0U
+#define ST_NORMAL 1U
+#define ST_FAULT  2U
+
+/** @brief Cascade key of VDD then CLK */
+#define CASCADE_VDD_CLK ((1U << 2) | 2U)
+
+static fr_summary_t g_summary;
+static fr_summary_t g_reference;
+static flight_recorder_t g_copy;
+static char g_dir[] = "/tmp/fr_analysis_XXXXXX";
+
+static void wait_us(uint32_t us)
+{
+    uint64_t end = timebase_ticks64() + (uint64_t)us * TIMEBASE_TICKS_PER_US;
+
+    while (timebase_ticks64() < end) {
+    }
+}
+
+static void write_file(const char *name, const flight_recorder_t *const *regions,
+                       size_t count, size_t padding)
+{
+    static uint8_t noise[4096];
+    char path[64];
+    FILE *f;
+    size_t i;
+
+    memset(noise, 0xA5, sizeof(noise));
+    (void)snprintf(path, sizeof(path), "%s/%s", g_dir, name);
+    f = fopen(path, "wb");
+    CHECK(f != NULL);
+    if (f == NULL) {
+        return;
+    }
+    for (i = 0; i < count; i++) {
+        CHECK_EQ(fwrite(noise, 1, padding, f), padding);
+        CHECK_EQ(fwrite(regions[i], 1, sizeof(flight_recorder_t), f),
+                 sizeof(flight_recorder_t));
+    }
+    CHECK_EQ(fwrite(noise, 1, padding, f), padding);
+    (void)fclose(f);
+}
+
+static void check_aggregates(const fr_summary_t *s, uint64_t regions)
+{
+    CHECK_EQ(s->recorders, regions);
+    CHECK_EQ(s->records, 5U * regions);
+    CHECK_EQ(s->torn_records, 0U);
+    CHECK_EQ(s->boots, regions);
+    CHECK_EQ(s->resets_in[ST_FAULT], regions);
+    CHECK_EQ(s->faults[SRC_VDD], regions);
+    CHECK_EQ(s->faults[SRC_CLK], regions);
+    CHECK_EQ(s->transitions[ST_INIT][ST_NORMAL], regions);
+    CHECK_EQ(s->transitions[ST_NORMAL][ST_FAULT], regions);
+    CHECK_EQ(s->cascades[CASCADE_VDD_CLK], regions);
+    CHECK_EQ(s->latency[SRC_VDD].total, regions);
+    CHECK_EQ(s->latency[SRC_CLK].total, regions);
+    CHECK(s->latency[SRC_VDD].min_us >= 300U);
+    CHECK(s->latency[SRC_CLK].max_us < s->latency[SRC_VDD].min_us);
+}
+
+static void test_decode(void)
+{
+    fr_options_t opt;
+
+    /* Fresh region: fsm_init formats it */
+    CHECK(fsm_init());
+    CHECK(fsm_transition(SAFETY_STATE_NORMAL));
+    CHECK(fault_event_post(FAULT_EVENT_VDD_ISR, 0U));
+    wait_us(300U);
+    CHECK(fault_event_post(FAULT_EVENT_CLK_ISR, 0U));
+    CHECK(fsm_aggregate_faults());
+    CHECK_EQ(fsm_get_state(), SAFETY_STATE_FAULT);
+
+    /* Warm reset in FAULT: BOOT marker */
+    CHECK(flight_recorder_init());
+    CHECK_EQ(flight_recorder_count(), 5U);
+    g_copy = *flight_recorder_region();
+
+    fr_options_init(&opt);
+    fr_summary_init(&g_summary);
+    fr_analyze_recorder(&g_copy, &opt, &g_summary);
+    check_aggregates(&g_summary, 1U);
+
+    /* A window shorter than the gap splits the cascade */
+    opt.cascade_window_us = 100U;
+    fr_summary_init(&g_summary);
+    fr_analyze_recorder(&g_copy, &opt, &g_summary);
+    CHECK_EQ(g_summary.cascades[CASCADE_VDD_CLK], 0U);
+}
+
+static void test_torn(void)
+{
+    fr_options_t opt;
+    flight_recorder_t torn = g_copy;
+
+    /* The CLK fault slot was not written: its fault and latency are lost */
+    torn.records[2].seq ^= 0x8000U;
+
+    fr_options_init(&opt);
+    fr_summary_init(&g_summary);
+    fr_analyze_recorder(&torn, &opt, &g_summary);
+    CHECK_EQ(g_summary.torn_records, 1U);
+    CHECK_EQ(g_summary.records, 4U);
+    CHECK_EQ(g_summary.faults[SRC_CLK], 0U);
+    CHECK_EQ(g_summary.latency[SRC_VDD].total, 0U);
+    CHECK_EQ(g_summary.transitions[ST_NORMAL][ST_FAULT], 1U);
+}
+
+static void test_scan_files(void)
+{
+    static flight_recorder_t corrupt;
+    const flight_recorder_t *one[1] = { &g_copy };
+    const flight_recorder_t *three[3] = { &g_copy, &corrupt, &g_copy };
+    char *paths[1] = { g_dir };
+    fr_options_t opt;
+
+    corrupt = g_copy;
+    corrupt.header.crc ^= 1U;
+
+    CHECK(mkdtemp(g_dir) != NULL);
+    write_file("a.bin", one, 1U, 1000U);
+    write_file("b.bin", three, 3U, 8U);
+    write_file("empty.bin", one, 0U, 0U);
+
+    fr_options_init(&opt);
+    fr_summary_init(&g_reference);
+    CHECK_EQ(fr_analyze_paths(paths, 1U, &opt, &g_reference), 0);
+    CHECK_EQ(g_reference.files, 2U);
+    CHECK_EQ(g_reference.bytes, 4U * sizeof(flight_recorder_t) + 2000U + 32U);
+    check_aggregates(&g_reference, 3U);
+
+    /* A missing path is reported; the rest is still analyzed */
+    fr_summary_init(&g_summary);
+    paths[0] = "/nonexistent/fr_analysis";
+    CHECK_EQ(fr_analyze_paths(paths, 1U, &opt, &g_summary), -1);
+    CHECK_EQ(g_summary.recorders, 0U);
+}
+
+static void test_chunking(void)
+{
+    char *paths[1] = { g_dir };
+    fr_options_t opt;
+
+    /* Chunks smaller than a region: regions straddle chunk boundaries */
+    fr_options_init(&opt);
+    opt.chunk_bytes = 1000U;
+    opt.threads = 4U;
+    fr_summary_init(&g_summary);
+    CHECK_EQ(fr_analyze_paths(paths, 1U, &opt, &g_summary), 0);
+    CHECK_EQ(memcmp(&g_summary, &g_reference, sizeof(g_summary)), 0);
+
+    opt.chunk_bytes = 64U;
+    opt.threads = 1U;
+    fr_summary_init(&g_summary);
+    CHECK_EQ(fr_analyze_paths(paths, 1U, &opt, &g_summary), 0);
+    CHECK_EQ(memcmp(&g_summary, &g_reference, sizeof(g_summary)), 0);
+}
+
+static void cleanup(void)
+{
+    char path[64];
+
+    (void)snprintf(path, sizeof(path), "%s/a.bin", g_dir);
+    (void)unlink(path);
+    (void)snprintf(path, sizeof(path), "%s/b.bin", g_dir);
+    (void)unlink(path);
+    (void)snprintf(path, sizeof(path), "%s/empty.bin", g_dir);
+    (void)unlink(path);
+    (void)rmdir(g_dir);
+}
+
+int main(void)
+{
+    RUN_TEST(test_decode);
+    RUN_TEST(test_torn);
+    RUN_TEST(test_scan_files);
+    RUN_TEST(test_chunking);
+    cleanup();
+
+    return HOST_TEST_RESULT();
+}
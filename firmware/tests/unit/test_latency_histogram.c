@@ -0,0 +1,147 @@
+/**
+ * @file test_latency_histogram.c
+ * @brief Host-build tests for the log-linear latency histogram
+ *
+ * Test cases:
+ *  - TC01: Small values get one bucket each, larger ones 16 per octave
+ *  - TC02: Every value lies in its bucket and the bucket is within 6.25%
+ *  - TC03: Quantiles are upper bounds within one bucket of the exact value
+ *  - TC04: Merged histograms equal one histogram of all samples
+ *  - TC05: Out-of-range values saturate in the last bucket
+ */
+
+#include "host_test.h"
+#include "safety/latency_histogram.h"
+#include <string.h>
+
+static latency_hist_t g_hist;
+static latency_hist_t g_other;
+static latency_hist_t g_all;
+
+static void test_bucket_layout(void)
+{
+    CHECK_EQ(LATENCY_HIST_BUCKETS, 336U);
+
+    for (uint32_t v = 0; v < 32U; v++) {
+        CHECK_EQ(latency_hist_bucket(v), v);
+    }
+    CHECK_EQ(latency_hist_bucket(32U), 32U);
+    CHECK_EQ(latency_hist_bucket(33U), 32U);
+    CHECK_EQ(latency_hist_bucket(34U), 33U);
+    CHECK_EQ(latency_hist_bucket(63U), 47U);
+    CHECK_EQ(latency_hist_bucket(64U), 48U);
+
+    CHECK_EQ(latency_hist_bucket_upper(32U), 33U);
+    CHECK_EQ(latency_hist_bucket_upper(47U), 63U);
+    CHECK_EQ(latency_hist_bucket_upper(LATENCY_HIST_BUCKETS - 1U),
+             LATENCY_HIST_MAX_US);
+}
+
+static void test_bucket_bounds(void)
+{
+    uint32_t v, b, lower;
+
+    /* Dense below 64k, then a stride that still visits every octave */
+    for (v = 1U; v < LATENCY_HIST_MAX_US; v += (v < 65536U) ? 1U : (v / 97U)) {
+        b = latency_hist_bucket(v);
+        lower = (b == 0U) ? 0U : latency_hist_bucket_upper(b - 1U) + 1U;
+
+        CHECK(b < LATENCY_HIST_BUCKETS);
+        CHECK(v >= lower);
+        CHECK(v <= latency_hist_bucket_upper(b));
+        CHECK((uint64_t)(latency_hist_bucket_upper(b) - lower) * 16U <= v);
+    }
+}
+
+static void test_quantiles(void)
+{
+    uint32_t v, p999;
+
+    latency_hist_reset(&g_hist);
+    CHECK_EQ(latency_hist_value_at(&g_hist, LATENCY_HIST_P50), 0U);
+
+    /* 1..10000 us: exact p50 = 5000, p99 = 9900, p99.9 = 9990 */
+    for (v = 1U; v <= 10000U; v++) {
+        latency_hist_record(&g_hist, v);
+    }
+
+    CHECK_EQ(g_hist.total, 10000U);
+    CHECK_EQ(g_hist.min_us, 1U);
+    CHECK_EQ(g_hist.max_us, 10000U);
+    CHECK_EQ(g_hist.sum_us, 50005000ULL);
+
+    v = latency_hist_value_at(&g_hist, LATENCY_HIST_P50);
+    CHECK(v >= 5000U && v <= 5000U + 5000U / 16U);
+    v = latency_hist_value_at(&g_hist, LATENCY_HIST_P99);
+    CHECK(v >= 9900U && v <= 9900U + 9900U / 16U);
+    p999 = latency_hist_value_at(&g_hist, LATENCY_HIST_P999);
+    CHECK(p999 >= 9990U && p999 <= 10000U);   /* Capped at the maximum */
+    CHECK_EQ(latency_hist_value_at(&g_hist, 1000000UL), 10000U);
+    CHECK_EQ(latency_hist_value_at(&g_hist, 0U), 1U);
+
+    /* One outlier in 1000 moves p99.9 but not p99 */
+    latency_hist_reset(&g_hist);
+    for (v = 0; v < 999U; v++) {
+        latency_hist_record(&g_hist, 200U);
+    }
+    latency_hist_record(&g_hist, 7000U);
+    CHECK(latency_hist_value_at(&g_hist, LATENCY_HIST_P99) < 220U);
+    CHECK(latency_hist_value_at(&g_hist, LATENCY_HIST_P999) < 220U);
+    latency_hist_record(&g_hist, 7000U);
+    CHECK_EQ(latency_hist_value_at(&g_hist, LATENCY_HIST_P999), 7000U);
+}
+
+static void test_merge(void)
+{
+    uint32_t v;
+
+    latency_hist_reset(&g_hist);
+    latency_hist_reset(&g_other);
+    latency_hist_reset(&g_all);
+
+    for (v = 0; v < 5000U; v++) {
+        uint32_t a = (v * 7919U) % 4000U + 50U;
+        uint32_t b = (v * 104729U) % 90000U + 3U;
+
+        latency_hist_record(&g_hist, a);
+        latency_hist_record(&g_other, b);
+        latency_hist_record(&g_all, a);
+        latency_hist_record(&g_all, b);
+    }
+
+    CHECK(latency_hist_merge(&g_hist, &g_other));
+    CHECK(memcmp(&g_hist, &g_all, sizeof(g_all)) == 0);
+
+    /* Empty source leaves the destination alone; empty destination copies */
+    latency_hist_reset(&g_other);
+    CHECK(latency_hist_merge(&g_hist, &g_other));
+    CHECK(memcmp(&g_hist, &g_all, sizeof(g_all)) == 0);
+    CHECK(latency_hist_merge(&g_other, &g_all));
+    CHECK(memcmp(&g_other, &g_all, sizeof(g_all)) == 0);
+
+    CHECK(!latency_hist_merge(NULL, &g_all));
+    CHECK(!latency_hist_merge(&g_all, NULL));
+}
+
+static void test_saturation(void)
+{
+    latency_hist_reset(&g_hist);
+    latency_hist_record(&g_hist, UINT32_MAX);
+    latency_hist_record(&g_hist, LATENCY_HIST_MAX_US + 1U);
+
+    CHECK_EQ(g_hist.counts[LATENCY_HIST_BUCKETS - 1U], 2U);
+    CHECK_EQ(g_hist.max_us, LATENCY_HIST_MAX_US);
+    CHECK_EQ(latency_hist_bucket(UINT32_MAX), LATENCY_HIST_BUCKETS - 1U);
+    CHECK_EQ(latency_hist_value_at(&g_hist, LATENCY_HIST_P50), LATENCY_HIST_MAX_US);
+}
+
+int main(void)
+{
+    RUN_TEST(test_bucket_layout);
+    RUN_TEST(test_bucket_bounds);
+    RUN_TEST(test_quantiles);
+    RUN_TEST(test_merge);
+    RUN_TEST(test_saturation);
+
+    return HOST_TEST_RESULT();
+}
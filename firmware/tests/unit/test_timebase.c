@@ -0,0 +1,112 @@
+/**
+ * @file test_timebase.c
+ * @brief Host-build tests for the monotonic timebase
+ *
+ * Test cases:
+ *  - TC01: 64-bit and 32-bit ticks are monotonic and agree
+ *  - TC02: Half-wrap epoch extension of a 32-bit counter (target path)
+ *  - TC03: Fault ISRs record real timestamps instead of placeholders
+ *  - TC04: Unit conversions (ms, us)
+ */
+
+#include "host_test.h"
+#include "hal/timebase.h"
+#include "hal/interrupt_handler.h"
+#include "clock/clk_event_handler.h"
+#include "power/pwr_event_handler.h"
+#include "safety/fault_event_queue.h"
+
+static void test_ticks_monotonic(void)
+{
+    uint64_t prev = timebase_ticks64();
+
+    for (uint32_t i = 0; i < 100000U; i++) {
+        uint64_t now = timebase_ticks64();
+        CHECK(now >= prev);
+        prev = now;
+    }
+
+    uint64_t t64 = timebase_ticks64();
+    uint32_t t32 = timebase_ticks32();
+    CHECK((int32_t)(t32 - (uint32_t)t64) >= 0);
+    CHECK((uint32_t)(t32 - (uint32_t)t64) < (uint32_t)TIMEBASE_TICKS_PER_MS);
+}
+
+static void test_epoch_extension(void)
+{
+    /* Epoch current */
+    CHECK_EQ(timebase_extend(0U, 0x00000010U), 0x0000000000000010ULL);
+    CHECK_EQ(timebase_extend(1U, 0x80000010U), 0x0000000080000010ULL);
+    CHECK_EQ(timebase_extend(2U, 0x00000010U), 0x0000000100000010ULL);
+    CHECK_EQ(timebase_extend(7U, 0xFFFFFFFFU), 0x00000003FFFFFFFFULL);
+
+    /* Epoch one half period behind (SysTick not yet run) */
+    CHECK_EQ(timebase_extend(0U, 0x80000000U), 0x0000000080000000ULL);
+    CHECK_EQ(timebase_extend(1U, 0x00000005U), 0x0000000100000005ULL);
+    CHECK_EQ(timebase_extend(7U, 0x00000000U), 0x0000000400000000ULL);
+
+    /* Sweep across several wraps with a lagging epoch: never goes back */
+    uint64_t prev = 0;
+    uint32_t epoch = 0;
+    for (uint64_t t = 0; t < (6ULL << 32); t += 0x01000000ULL) {
+        uint64_t ext = timebase_extend(epoch, (uint32_t)t);
+        CHECK_EQ(ext, t);
+        CHECK(ext >= prev);
+        prev = ext;
+        /* Update the epoch only every 16 steps, as a slow SysTick would */
+        if (((t >> 24) & 0xFU) == 0xFU) {
+            epoch = (uint32_t)(t >> 31);
+        }
+    }
+}
+
+static void test_isr_timestamps(void)
+{
+    fault_event_t event;
+    clk_event_statistics_t clk_stats;
+
+    (void)interrupt_handler_init();
+    (void)clk_event_handler_init();
+    pwr_event_handler_init();
+    fault_event_queue_init();
+
+    uint64_t before = timebase_ticks64();
+    clk_event_handler_clk_loss_isr();
+    pwr_event_handler_vdd_fault();
+    uint64_t after = timebase_ticks64();
+
+    CHECK_EQ(clk_event_handler_get_statistics(&clk_stats), SAFETY_OK);
+    CHECK((int32_t)(clk_stats.clk_loss_timestamp - (uint32_t)before) >= 0);
+    CHECK((int32_t)((uint32_t)after - clk_stats.clk_loss_timestamp) >= 0);
+
+    uint64_t pwr_us = pwr_event_handler_get_last_fault_time();
+    CHECK(pwr_us >= timebase_ticks_to_us(before));
+    CHECK(pwr_us <= timebase_ticks_to_us(after));
+
+    CHECK_EQ(fault_event_drain(&event, 1U), 1U);
+    CHECK_EQ(event.source, FAULT_TYPE_CLK);
+    CHECK((int32_t)(event.timestamp - (uint32_t)before) >= 0);
+    CHECK((int32_t)((uint32_t)after - event.timestamp) >= 0);
+}
+
+static void test_conversions(void)
+{
+    CHECK_EQ(timebase_ticks_to_us(TIMEBASE_TICKS_PER_MS), 1000U);
+    CHECK_EQ(timebase_ticks_to_us(TIMEBASE_TICKS_PER_US * 5U), 5U);
+
+    uint64_t before = timebase_ticks64();
+    uint64_t ms = timebase_ms();
+    uint64_t after = timebase_ticks64();
+    CHECK(ms >= before / TIMEBASE_TICKS_PER_MS);
+    CHECK(ms <= after / TIMEBASE_TICKS_PER_MS);
+}
+
+int main(void)
+{
+    RUN_TEST(test_ticks_monotonic);
+    RUN_TEST(test_epoch_extension);
+    RUN_TEST(test_isr_timestamps);
+    RUN_TEST(test_conversions);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,611 @@
+/**
+ * @file fr_analysis.c
+ * @brief Flight Recorder Dump Analysis (host tool library)
+ *
+ * See fr_analysis.h. Regions are 8-byte aligned in RAM (flight_recorder_t
+ * holds a uint64_t) and dumps start at an aligned address, so candidate
+ * offsets advance in steps of 8 and the region is read through a pointer
+ * into the mapping.
+ */
+
+#define _GNU_SOURCE
+
+#include "fr_analysis.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <ftw.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* ============================================================================
+ * Names
+ * ============================================================================ */
+
+static const char *const g_state_names[FR_STATES] = {
+    "INIT", "NORMAL", "FAULT", "SAFE_STATE", "RECOVERY", "INVALID"
+};
+
+static const char *const g_source_names[FR_SOURCES] = { "VDD", "CLK", "MEM" };
+
+unsigned fr_state_index(uint8_t state)
+{
+    switch (state) {
+        case SAFETY_STATE_INIT:       return 0U;
+        case SAFETY_STATE_NORMAL:     return 1U;
+        case SAFETY_STATE_FAULT:      return 2U;
+        case SAFETY_STATE_SAFE_STATE: return 3U;
+        case SAFETY_STATE_RECOVERY:   return 4U;
+        default:                      return FR_STATES - 1U;
+    }
+}
+
+const char *fr_state_name(unsigned index)
+{
+    return (index < FR_STATES) ? g_state_names[index] : "?";
+}
+
+const char *fr_source_name(unsigned index)
+{
+    return (index < FR_SOURCES) ? g_source_names[index] : "?";
+}
+
+/** @brief Source index of a fault source bit (FR_SOURCES if not one) */
+static unsigned fr_source_index(uint8_t source)
+{
+    switch (source) {
+        case FAULT_TYPE_VDD:     return 0U;
+        case FAULT_TYPE_CLK:     return 1U;
+        case FAULT_TYPE_MEM_ECC: return 2U;
+        default:                 return FR_SOURCES;
+    }
+}
+
+/* ============================================================================
+ * Summaries
+ * ============================================================================ */
+
+void fr_options_init(fr_options_t *opt)
+{
+    opt->cascade_window_us = FR_DEFAULT_CASCADE_WINDOW_US;
+    opt->chunk_bytes = FR_DEFAULT_CHUNK_BYTES;
+    opt->threads = 0U;
+}
+
+void fr_summary_init(fr_summary_t *summary)
+{
+    memset(summary, 0, sizeof(*summary));
+}
+
+void fr_summary_merge(fr_summary_t *dst, const fr_summary_t *src)
+{
+    unsigned i, j;
+
+    dst->files += src->files;
+    dst->bytes += src->bytes;
+    dst->recorders += src->recorders;
+    dst->records += src->records;
+    dst->torn_records += src->torn_records;
+    dst->boots += src->boots;
+
+    for (i = 0; i < FR_SOURCES; i++) {
+        dst->faults[i] += src->faults[i];
+        (void)latency_hist_merge(&dst->latency[i], &src->latency[i]);
+    }
+    for (i = 0; i < FR_CASCADE_KEYS; i++) {
+        dst->cascades[i] += src->cascades[i];
+    }
+    for (i = 0; i < FR_STATES; i++) {
+        for (j = 0; j < FR_STATES; j++) {
+            dst->transitions[i][j] += src->transitions[i][j];
+        }
+        dst->resets_in[i] += src->resets_in[i];
+    }
+}
+
+/* ============================================================================
+ * Record Decoding
+ * ============================================================================ */
+
+/**
+ * @struct fr_timeline_t
+ * @brief Decoder state of one boot session
+ */
+typedef struct {
+    uint64_t now;                       /*!< Ticks since the session start */
+    uint64_t first_fault[FR_SOURCES];   /*!< First unanswered fault (ticks) */
+    bool pending[FR_SOURCES];           /*!< Fault seen while NORMAL */
+    uint32_t cascade_key;               /*!< Sources so far, 2 bits each */
+    uint32_t cascade_len;
+    unsigned cascade_last;              /*!< Last source in the cascade */
+    uint64_t cascade_time;              /*!< Time of the last fault */
+} fr_timeline_t;
+
+static void fr_cascade_flush(fr_timeline_t *tl, fr_summary_t *summary)
+{
+    if (tl->cascade_len >= 2U) {
+        summary->cascades[tl->cascade_key]++;
+    }
+    tl->cascade_key = 0U;
+    tl->cascade_len = 0U;
+}
+
+/** @brief Start a new session (boot, torn record) */
+static void fr_timeline_reset(fr_timeline_t *tl, fr_summary_t *summary)
+{
+    fr_cascade_flush(tl, summary);
+    memset(tl, 0, sizeof(*tl));
+}
+
+static void fr_decode_fault(fr_timeline_t *tl, const flight_record_t *rec,
+                            unsigned src, uint64_t window_ticks,
+                            fr_summary_t *summary)
+{
+    summary->faults[src]++;
+
+    if (rec->state_before == SAFETY_STATE_NORMAL && !tl->pending[src]) {
+        tl->pending[src] = true;
+        tl->first_fault[src] = tl->now;
+    }
+
+    if (tl->cascade_len != 0U && tl->now - tl->cascade_time > window_ticks) {
+        fr_cascade_flush(tl, summary);
+    }
+    if (tl->cascade_len == 0U || tl->cascade_last != src) {
+        if (tl->cascade_len < FR_CASCADE_MAX_LEN) {
+            tl->cascade_key = (tl->cascade_key << 2) | (src + 1U);
+            tl->cascade_len++;
+        }
+        tl->cascade_last = src;
+    }
+    tl->cascade_time = tl->now;
+}
+
+static void fr_decode_transition(fr_timeline_t *tl, const flight_record_t *rec,
+                                 uint64_t ticks_per_us, fr_summary_t *summary)
+{
+    unsigned from = fr_state_index(rec->state_before);
+    unsigned to = fr_state_index(rec->state_after);
+    unsigned i;
+
+    summary->transitions[from][to]++;
+
+    if (rec->state_after == SAFETY_STATE_FAULT) {
+        for (i = 0; i < FR_SOURCES; i++) {
+            if (tl->pending[i]) {
+                uint64_t us = (tl->now - tl->first_fault[i]) / ticks_per_us;
+
+                latency_hist_record(&summary->latency[i],
+                                    (us > UINT32_MAX) ? UINT32_MAX : (uint32_t)us);
+                tl->pending[i] = false;
+            }
+        }
+    } else if (rec->state_after == SAFETY_STATE_NORMAL) {
+        /* Faults seen outside NORMAL never get a NORMAL -> FAULT reaction */
+        memset(tl->pending, 0, sizeof(tl->pending));
+    }
+}
+
+void fr_analyze_recorder(const flight_recorder_t *fr, const fr_options_t *opt,
+                         fr_summary_t *summary)
+{
+    uint32_t head = fr->head;
+    uint32_t n = (head > FLIGHT_RECORDER_CAPACITY) ? (head - FLIGHT_RECORDER_CAPACITY) : 0U;
+    uint64_t ticks_per_us = fr->header.tick_hz / 1000000U;
+    uint64_t window_ticks;
+    fr_timeline_t tl;
+
+    if (ticks_per_us == 0U) {
+        ticks_per_us = 1U;
+    }
+    window_ticks = (uint64_t)opt->cascade_window_us * ticks_per_us;
+
+    memset(&tl, 0, sizeof(tl));
+    summary->recorders++;
+
+    for (; n != head; n++) {
+        const flight_record_t *rec = &fr->records[n & FLIGHT_RECORDER_MASK];
+        unsigned src;
+
+        if (rec->seq != (uint16_t)n) {
+            /* Slot not rewritten since a clear, or torn by the reset */
+            summary->torn_records++;
+            fr_timeline_reset(&tl, summary);
+            continue;
+        }
+
+        switch (rec->kind) {
+            case FLIGHT_RECORD_BOOT:
+                summary->boots++;
+                summary->resets_in[fr_state_index(rec->state_before)]++;
+                fr_timeline_reset(&tl, summary);
+                break;
+
+            case FLIGHT_RECORD_FAULT:
+                src = fr_source_index(rec->source);
+                if (src >= FR_SOURCES) {
+                    summary->torn_records++;
+                    continue;
+                }
+                tl.now += rec->delta_ticks;
+                fr_decode_fault(&tl, rec, src, window_ticks, summary);
+                break;
+
+            case FLIGHT_RECORD_TRANSITION:
+                tl.now += rec->delta_ticks;
+                fr_decode_transition(&tl, rec, ticks_per_us, summary);
+                break;
+
+            default:
+                summary->torn_records++;
+                continue;
+        }
+        summary->records++;
+    }
+
+    fr_cascade_flush(&tl, summary);
+}
+
+/* ============================================================================
+ * Buffer Scan
+ * ============================================================================ */
+
+uint64_t fr_scan_buffer(const uint8_t *base, size_t len, size_t begin,
+                        size_t end, const fr_options_t *opt,
+                        fr_summary_t *summary)
+{
+    const size_t region = sizeof(flight_recorder_t);
+    uint64_t found = 0;
+    size_t off;
+
+    if (len < region) {
+        return 0;
+    }
+    if (end > len - region + 1U) {
+        end = len - region + 1U;
+    }
+
+    for (off = (begin + 7U) & ~(size_t)7U; off < end; off += 8U) {
+        const flight_recorder_t *fr;
+        uint32_t word;
+
+        memcpy(&word, base + off, sizeof(word));
+        if (word != FLIGHT_RECORDER_MAGIC) {
+            continue;
+        }
+
+        fr = (const flight_recorder_t *)(const void *)(base + off);
+        if (!flight_recorder_header_valid(&fr->header) ||
+            (fr->head ^ fr->head_cmp) != 0xFFFFFFFFUL) {
+            continue;
+        }
+
+        fr_analyze_recorder(fr, opt, summary);
+        found++;
+        off += region - 8U;
+    }
+
+    return found;
+}
+
+/* ============================================================================
+ * Parallel File Analysis
+ * ============================================================================ */
+
+/**
+ * @struct fr_file_t
+ * @brief One mapped dump
+ */
+typedef struct {
+    const uint8_t *data;
+    size_t len;
+} fr_file_t;
+
+/**
+ * @struct fr_work_t
+ * @brief Shared work list: chunk n of the files, in order
+ */
+typedef struct {
+    fr_file_t *files;
+    size_t file_count;
+    size_t *first_chunk;        /*!< Chunk index of each file's offset 0 */
+    size_t chunk_count;
+    atomic_size_t next;         /*!< Next chunk to take */
+    const fr_options_t *opt;
+} fr_work_t;
+
+/** @brief Paths collected by the nftw() callback (one walk at a time) */
+static char **g_walk_paths;
+static size_t g_walk_count;
+static size_t g_walk_capacity;
+
+static int fr_walk_add(const char *path, const struct stat *st, int type,
+                       struct FTW *ftw)
+{
+    (void)st;
+    (void)ftw;
+
+    if (type != FTW_F) {
+        return 0;
+    }
+    if (g_walk_count == g_walk_capacity) {
+        size_t capacity = g_walk_capacity ? (g_walk_capacity * 2U) : 256U;
+        char **grown = realloc(g_walk_paths, capacity * sizeof(*grown));
+
+        if (grown == NULL) {
+            return -1;
+        }
+        g_walk_paths = grown;
+        g_walk_capacity = capacity;
+    }
+    g_walk_paths[g_walk_count] = strdup(path);
+    if (g_walk_paths[g_walk_count] == NULL) {
+        return -1;
+    }
+    g_walk_count++;
+
+    return 0;
+}
+
+static void *fr_worker(void *arg)
+{
+    fr_work_t *work = (fr_work_t *)arg;
+    fr_summary_t *summary = calloc(1, sizeof(*summary));
+    size_t chunk, file = 0;
+
+    if (summary == NULL) {
+        return NULL;
+    }
+
+    while ((chunk = atomic_fetch_add(&work->next, 1U)) < work->chunk_count) {
+        size_t begin;
+
+        /* Chunks are taken in increasing order: advance the file cursor */
+        while (file + 1U < work->file_count && chunk >= work->first_chunk[file + 1U]) {
+            file++;
+        }
+
+        begin = (chunk - work->first_chunk[file]) * work->opt->chunk_bytes;
+        (void)fr_scan_buffer(work->files[file].data, work->files[file].len,
+                             begin, begin + work->opt->chunk_bytes,
+                             work->opt, summary);
+    }
+
+    return summary;
+}
+
+/** @brief Map one file read-only (empty files are skipped) */
+static int fr_map_file(const char *path, fr_file_t *file)
+{
+    struct stat st;
+    void *data;
+    int fd = open(path, O_RDONLY);
+
+    file->data = NULL;
+    file->len = 0;
+
+    if (fd < 0) {
+        fprintf(stderr, "fr_analyze: %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+    if (fstat(fd, &st) != 0) {
+        fprintf(stderr, "fr_analyze: %s: %s\n", path, strerror(errno));
+        (void)close(fd);
+        return -1;
+    }
+    if (st.st_size == 0) {
+        (void)close(fd);
+        return 0;
+    }
+
+    data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    (void)close(fd);
+    if (data == MAP_FAILED) {
+        fprintf(stderr, "fr_analyze: %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+    (void)madvise(data, (size_t)st.st_size, MADV_SEQUENTIAL);
+
+    file->data = (const uint8_t *)data;
+    file->len = (size_t)st.st_size;
+
+    return 0;
+}
+
+int fr_analyze_paths(char *const *paths, size_t count, const fr_options_t *opt,
+                     fr_summary_t *summary)
+{
+    fr_options_t local = *opt;
+    fr_work_t work;
+    pthread_t *threads = NULL;
+    unsigned nthreads, started = 0, t;
+    size_t i;
+    int status = 0;
+
+    if (local.chunk_bytes < 8U) {
+        local.chunk_bytes = FR_DEFAULT_CHUNK_BYTES;
+    }
+    local.chunk_bytes &= ~(size_t)7U;
+
+    /* Collect regular files (directories recursively) */
+    g_walk_paths = NULL;
+    g_walk_count = 0;
+    g_walk_capacity = 0;
+    for (i = 0; i < count; i++) {
+        if (nftw(paths[i], fr_walk_add, 64, FTW_PHYS) != 0) {
+            fprintf(stderr, "fr_analyze: %s: cannot read\n", paths[i]);
+            status = -1;
+        }
+    }
+
+    memset(&work, 0, sizeof(work));
+    work.opt = &local;
+    work.file_count = g_walk_count;
+    work.files = calloc(g_walk_count + 1U, sizeof(*work.files));
+    work.first_chunk = calloc(g_walk_count + 1U, sizeof(*work.first_chunk));
+    if (work.files == NULL || work.first_chunk == NULL) {
+        status = -1;
+        goto out;
+    }
+
+    for (i = 0; i < g_walk_count; i++) {
+        if (fr_map_file(g_walk_paths[i], &work.files[i]) != 0) {
+            status = -1;
+        }
+        work.first_chunk[i] = work.chunk_count;
+        work.chunk_count += (work.files[i].len + local.chunk_bytes - 1U) / local.chunk_bytes;
+        if (work.files[i].data != NULL) {
+            summary->files++;
+            summary->bytes += work.files[i].len;
+        }
+    }
+    atomic_init(&work.next, 0U);
+
+    nthreads = local.threads;
+    if (nthreads == 0U) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        nthreads = (cpus > 0) ? (unsigned)cpus : 1U;
+    }
+    if (nthreads > work.chunk_count) {
+        nthreads = (work.chunk_count != 0U) ? (unsigned)work.chunk_count : 1U;
+    }
+
+    threads = calloc(nthreads, sizeof(*threads));
+    if (threads == NULL) {
+        status = -1;
+        goto out;
+    }
+    for (t = 0; t < nthreads; t++) {
+        if (pthread_create(&threads[t], NULL, fr_worker, &work) != 0) {
+            break;
+        }
+        started++;
+    }
+    if (started == 0U) {
+        status = -1;
+    }
+
+    for (t = 0; t < started; t++) {
+        void *result = NULL;
+
+        (void)pthread_join(threads[t], &result);
+        if (result == NULL) {
+            status = -1;
+            continue;
+        }
+        fr_summary_merge(summary, (const fr_summary_t *)result);
+        free(result);
+    }
+
+out:
+    for (i = 0; i < g_walk_count; i++) {
+        if (work.files != NULL && work.files[i].data != NULL) {
+            (void)munmap((void *)work.files[i].data, work.files[i].len);
+        }
+        free(g_walk_paths[i]);
+    }
+    free(g_walk_paths);
+    g_walk_paths = NULL;
+    g_walk_count = 0;
+    g_walk_capacity = 0;
+    free(work.files);
+    free(work.first_chunk);
+    free(threads);
+
+    return status;
+}
+
+/* ============================================================================
+ * Report
+ * ============================================================================ */
+
+/** @brief Print a cascade key as "VDD>CLK>..." */
+static void fr_print_cascade(FILE *out, uint32_t key)
+{
+    int shift;
+    bool first = true;
+
+    for (shift = 2 * (int)(FR_CASCADE_MAX_LEN - 1U); shift >= 0; shift -= 2) {
+        uint32_t code = (key >> shift) & 3U;
+
+        if (code != 0U) {
+            fprintf(out, "%s%s", first ? "" : ">", fr_source_name(code - 1U));
+            first = false;
+        }
+    }
+}
+
+void fr_summary_print_json(FILE *out, const fr_summary_t *s)
+{
+    unsigned i, j;
+    const char *sep;
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"files\": %llu,\n", (unsigned long long)s->files);
+    fprintf(out, "  \"bytes\": %llu,\n", (unsigned long long)s->bytes);
+    fprintf(out, "  \"recorders\": %llu,\n", (unsigned long long)s->recorders);
+    fprintf(out, "  \"records\": %llu,\n", (unsigned long long)s->records);
+    fprintf(out, "  \"torn_records\": %llu,\n", (unsigned long long)s->torn_records);
+    fprintf(out, "  \"boots\": %llu,\n", (unsigned long long)s->boots);
+
+    fprintf(out, "  \"faults\": {");
+    for (i = 0; i < FR_SOURCES; i++) {
+        fprintf(out, "%s\"%s\": %llu", i ? ", " : "", fr_source_name(i),
+                (unsigned long long)s->faults[i]);
+    }
+    fprintf(out, "},\n");
+
+    fprintf(out, "  \"latency_us\": {\n");
+    for (i = 0; i < FR_SOURCES; i++) {
+        const latency_hist_t *h = &s->latency[i];
+
+        fprintf(out, "    \"%s\": {\"samples\": %u, \"p50\": %u, \"p99\": %u, "
+                "\"p999\": %u, \"max\": %u}%s\n", fr_source_name(i), h->total,
+                latency_hist_value_at(h, LATENCY_HIST_P50),
+                latency_hist_value_at(h, LATENCY_HIST_P99),
+                latency_hist_value_at(h, LATENCY_HIST_P999),
+                h->max_us, (i + 1U < FR_SOURCES) ? "," : "");
+    }
+    fprintf(out, "  },\n");
+
+    fprintf(out, "  \"cascades\": {");
+    sep = "";
+    for (i = 0; i < FR_CASCADE_KEYS; i++) {
+        if (s->cascades[i] != 0U) {
+            fprintf(out, "%s\"", sep);
+            fr_print_cascade(out, i);
+            fprintf(out, "\": %llu", (unsigned long long)s->cascades[i]);
+            sep = ", ";
+        }
+    }
+    fprintf(out, "},\n");
+
+    fprintf(out, "  \"transitions\": {");
+    sep = "";
+    for (i = 0; i < FR_STATES; i++) {
+        for (j = 0; j < FR_STATES; j++) {
+            if (s->transitions[i][j] != 0U) {
+                fprintf(out, "%s\"%s>%s\": %llu", sep, fr_state_name(i),
+                        fr_state_name(j), (unsigned long long)s->transitions[i][j]);
+                sep = ", ";
+            }
+        }
+    }
+    fprintf(out, "},\n");
+
+    fprintf(out, "  \"resets_in\": {");
+    sep = "";
+    for (i = 0; i < FR_STATES; i++) {
+        if (s->resets_in[i] != 0U) {
+            fprintf(out, "%s\"%s\": %llu", sep, fr_state_name(i),
+                    (unsigned long long)s->resets_in[i]);
+            sep = ", ";
+        }
+    }
+    fprintf(out, "}\n");
+    fprintf(out, "}\n");
+}
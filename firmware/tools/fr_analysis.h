@@ -0,0 +1,135 @@
+/**
+ * @file fr_analysis.h
+ * @brief Flight Recorder Dump Analysis (host tool library)
+ *
+ * Finds flight recorder regions (safety/flight_recorder.h) in raw RAM
+ * dumps and aggregates their records. The record and header layouts, the
+ * header check and the latency histogram come from the firmware headers,
+ * so the tool cannot drift from the firmware.
+ *
+ * Processing:
+ *  - Files are mmapped read-only; records are read in place (zero-copy)
+ *  - Each file is cut into chunks that worker threads take from a shared
+ *    counter; a region may start anywhere in a chunk and extend past it
+ *  - A region is recognised by its magic at an 8-byte aligned offset, a
+ *    valid header CRC and a valid head complement
+ *  - Each worker fills its own fr_summary_t; summaries merge at the end
+ *    (latency histograms with latency_hist_merge)
+ *
+ * Aggregates:
+ *  - Fault events per source
+ *  - Fault reaction latency per source: first fault record of a source
+ *    while NORMAL to the next transition into FAULT (as fault_statistics)
+ *  - Cascades: ordered sequences of different sources with at most the
+ *    cascade window between consecutive faults (up to 4 sources)
+ *  - FSM transition counts (from -> to) and the FSM state at each reset
+ */
+
+#ifndef FR_ANALYSIS_H
+#define FR_ANALYSIS_H
+
+#include "safety/flight_recorder.h"
+#include "safety/latency_histogram.h"
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * Configuration
+ * ============================================================================ */
+
+/** @brief Fault sources (VDD, CLK, MEM) */
+#define FR_SOURCES 3U
+
+/** @brief FSM states tracked (INIT, NORMAL, FAULT, SAFE_STATE, RECOVERY, other) */
+#define FR_STATES 6U
+
+/** @brief Longest cascade kept; key = 2 bits per source (index + 1) */
+#define FR_CASCADE_MAX_LEN 4U
+#define FR_CASCADE_KEYS    (1U << (2U * FR_CASCADE_MAX_LEN))
+
+/** @brief Defaults */
+#define FR_DEFAULT_CASCADE_WINDOW_US 10000U
+#define FR_DEFAULT_CHUNK_BYTES       (64UL << 20)
+
+/**
+ * @struct fr_options_t
+ * @brief Analysis options
+ */
+typedef struct {
+    uint32_t cascade_window_us;  /*!< Max gap between faults of one cascade */
+    size_t chunk_bytes;          /*!< Work unit (multiple of 8) */
+    unsigned threads;            /*!< Worker threads (0 = online CPUs) */
+} fr_options_t;
+
+/**
+ * @struct fr_summary_t
+ * @brief Aggregated results (one per worker, merged)
+ */
+typedef struct {
+    uint64_t files;                               /*!< Files mapped */
+    uint64_t bytes;                               /*!< Bytes scanned */
+    uint64_t recorders;                           /*!< Valid regions found */
+    uint64_t records;                             /*!< Records decoded */
+    uint64_t torn_records;                        /*!< Slots with a wrong seq or kind */
+    uint64_t boots;                               /*!< BOOT markers */
+    uint64_t faults[FR_SOURCES];                  /*!< Fault events per source */
+    latency_hist_t latency[FR_SOURCES];           /*!< Fault -> FAULT state (us) */
+    uint64_t cascades[FR_CASCADE_KEYS];           /*!< Count per source sequence */
+    uint64_t transitions[FR_STATES][FR_STATES];   /*!< [from][to] */
+    uint64_t resets_in[FR_STATES];                /*!< FSM state at reset */
+} fr_summary_t;
+
+/* ============================================================================
+ * Interface
+ * ============================================================================ */
+
+void fr_options_init(fr_options_t *opt);
+void fr_summary_init(fr_summary_t *summary);
+void fr_summary_merge(fr_summary_t *dst, const fr_summary_t *src);
+
+/**
+ * @brief Index of an FSM state (FR_STATES - 1 for anything invalid)
+ */
+unsigned fr_state_index(uint8_t state);
+const char *fr_state_name(unsigned index);
+const char *fr_source_name(unsigned index);
+
+/**
+ * @brief Aggregate the records of one validated region
+ */
+void fr_analyze_recorder(const flight_recorder_t *fr, const fr_options_t *opt,
+                         fr_summary_t *summary);
+
+/**
+ * @brief Find and aggregate regions starting in [begin, end) of a buffer
+ *
+ * Regions may extend past @p end (up to @p len).
+ *
+ * @return Regions found
+ */
+uint64_t fr_scan_buffer(const uint8_t *base, size_t len, size_t begin,
+                        size_t end, const fr_options_t *opt,
+                        fr_summary_t *summary);
+
+/**
+ * @brief Analyze files and directories (recursively) in parallel
+ *
+ * @return 0 on success, -1 if a path could not be read (the others are
+ *         still analyzed)
+ */
+int fr_analyze_paths(char *const *paths, size_t count, const fr_options_t *opt,
+                     fr_summary_t *summary);
+
+/**
+ * @brief Print a summary as JSON
+ */
+void fr_summary_print_json(FILE *out, const fr_summary_t *summary);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FR_ANALYSIS_H */
@@ -10,6 +10,7 @@ module clock_watchdog (
     // Clock inputs
     input  wire clk,              // 400MHz main clock
     input  wire rst_n,            // Async reset (active-low)
+    input  wire clk_mon,          // Monitored clock (sampled on clk, < clk/2)
     
     // Configuration
     input  wire [19:0] timeout_cycles,  // Watchdog timeout (default 400 cycles = 1μs @ 400MHz)
@@ -24,6 +25,9 @@ module clock_watchdog (
     reg [2:0] clk_edge_buffer;     // Delay line for clock edge detection
     reg clk_edge_detected;         // Clock edge detected in this cycle
     reg watchdog_active;           // Watchdog timer active
+    reg [1:0] recovery_edges;      // Clock edges seen since the fault
+
+    localparam [1:0] RECOVERY_EDGES = 2'd2;  // Edges that clear fault_clk
 
     // Formal properties (SystemVerilog assertions)
     // Property 1: Fault must be asserted within 100ns of clock loss detection
@@ -42,13 +46,14 @@ module clock_watchdog (
     // Edge Detection: Capture rising edges on main clock
     // =========================================================================
     // Delay line to detect clock transitions (prevents metastability issues)
+    // The monitored clock is sampled on clk; clk cannot watch itself
     always @(posedge clk or negedge rst_n) begin
         if (!rst_n) begin
             clk_edge_buffer <= 3'b0;
             clk_edge_detected <= 1'b0;
         end else begin
-            // Shift delay line (captures clock edges)
-            clk_edge_buffer <= {clk_edge_buffer[1:0], 1'b1};
+            // Shift delay line (captures monitored clock edges)
+            clk_edge_buffer <= {clk_edge_buffer[1:0], clk_mon};
             // Edge detected if buffer changes from 0→1
             clk_edge_detected <= ~clk_edge_buffer[2] & clk_edge_buffer[1];
         end
@@ -94,17 +99,25 @@ module clock_watchdog (
     always @(posedge clk or negedge rst_n) begin
         if (!rst_n) begin
             fault_clk <= 1'b0;
+            recovery_edges <= 2'd0;
         end else begin
-            if (watchdog_active && enable) begin
-                // Watchdog timeout: assert fault
-                fault_clk <= 1'b1;
-            end else if (clk_edge_detected && fault_clk) begin
-                // Clock edge detected while fault asserted: begin recovery
-                // Hold fault for hysteresis (see comments below)
-                fault_clk <= 1'b1;
-            end else if (!enable) begin
+            if (!enable) begin
                 // Watchdog disabled: clear fault
                 fault_clk <= 1'b0;
+                recovery_edges <= 2'd0;
+            end else if (watchdog_active) begin
+                // Watchdog timeout: assert fault, restart recovery
+                fault_clk <= 1'b1;
+                recovery_edges <= 2'd0;
+            end else if (clk_edge_detected && fault_clk) begin
+                // Clock edge detected while fault asserted: count towards
+                // recovery, clear on the RECOVERY_EDGES-th edge
+                if (recovery_edges >= RECOVERY_EDGES - 2'd1) begin
+                    fault_clk <= 1'b0;
+                    recovery_edges <= 2'd0;
+                end else begin
+                    recovery_edges <= recovery_edges + 2'd1;
+                end
             end
         end
     end
@@ -113,13 +126,15 @@ module clock_watchdog (
     // Hysteresis Logic: Prevent spurious faults during marginal clock conditions
     // =========================================================================
     // Recovery requires 2+ consecutive clock edges (hysteresis window)
-    // Implementation: fault_clk stays asserted for minimum 2 cycles after
-    // first clock edge is detected post-fault (prevents chattering)
+    // Implementation: recovery_edges counts clock edges detected while the
+    // fault is asserted; fault_clk clears on the RECOVERY_EDGES-th one
     
     // The fault_clk signal includes implicit hysteresis because:
     // 1. Watchdog timeout is 400 cycles (conservative estimate of clock loss)
     // 2. Once fault is asserted, requires actual clock edge to start recovery
-    // 3. Single edge doesn't immediately clear fault (one-cycle hold minimum)
+    // 3. Single edge doesn't clear fault; a timeout between two edges
+    //    restarts the count (watchdog_active), so an intermittent clock
+    //    keeps the fault asserted
     
     // Formal verification should verify no more than 100ns propagation delay
     // from last clock edge until fault_clk assertion
@@ -171,6 +186,7 @@ endmodule
 // Design Notes
 // ============================================================================
 // 1. Clock Edge Detection:
+//    - Samples the monitored clock (clk_mon) on the 400MHz main clock
 //    - Uses delay line (clk_edge_buffer) to avoid metastability
 //    - Edge detected when buffer transitions from 0→1
 //    - Robust against single-cycle glitches
@@ -184,7 +200,9 @@ endmodule
 // 3. Fault Output:
 //    - Synchronous assertion (aligned with clock domain)
 //    - Hysteresis prevents chattering during marginal clock conditions
-//    - Recovery requires actual clock edges (not just timeout reset)
+//    - Recovery requires actual clock edges (not just timeout reset):
+//      fault_clk clears on the 2nd edge without a timeout in between
+//      (~3 periods of clk_mon after it resumes)
 //
 // 4. Watchdog Enable:
 //    - Can be disabled dynamically (e.g., during safe state)
@@ -202,7 +220,7 @@ endmodule
 //
 // 7. Resource Usage (FPGA):
 //    - Logic: ~100 LUT (20-bit counter + comparator + FSM logic)
-//    - Registers: 20-bit counter + 3-bit delay line = 23 bits
+//    - Registers: 20-bit counter + 3-bit delay line + 2-bit recovery = 25 bits
 //    - Timing: Can run at 400MHz+
 
 // ============================================================================
@@ -212,6 +230,7 @@ endmodule
     clock_watchdog u_clk_watchdog (
         .clk(clk_400mhz),
         .rst_n(sys_reset_n),
+        .clk_mon(clk_periph),           // Monitored clock
         .timeout_cycles(20'd400),       // 1μs @ 400MHz
         .enable(watchdog_en),
         .fault_clk(fault_clk_detected)
@@ -7,7 +7,9 @@
 
 `timescale 1ns / 1ps
 
-module pll_monitor (
+module pll_monitor #(
+    parameter integer REF_CLK_MHZ = 400  // clk_ref frequency: window = 1μs
+) (
     // Clock inputs
     input  wire clk_pll,           // PLL output clock to monitor
     input  wire clk_ref,           // 400MHz reference clock for timing
@@ -19,8 +21,8 @@ module pll_monitor (
     
     // Configuration
     input  wire enable,            // Enable PLL monitoring
-    input  wire [7:0] freq_low,    // Frequency low threshold (MHz, default 396)
-    input  wire [7:0] freq_high,   // Frequency high threshold (MHz, default 404)
+    input  wire [9:0] freq_low,    // Frequency low threshold (MHz, default 396)
+    input  wire [9:0] freq_high,   // Frequency high threshold (MHz, default 404)
     
     // Fault outputs
     output reg fault_pll_osr,      // PLL out-of-spec range (frequency error)
@@ -28,14 +30,22 @@ module pll_monitor (
 );
 
     // Internal signals
-    reg [7:0] clk_pll_freq_measured;    // Measured frequency (MHz)
-    reg [19:0] edge_counter;            // Counter for frequency measurement
+    reg [9:0] clk_pll_freq_measured;    // Measured frequency (MHz)
+    reg measurement_valid;              // At least one full window measured
+    reg [11:0] edge_counter;            // PLL edges (clk_pll domain, binary)
+    reg [11:0] edge_counter_gray;       // Gray copy for the clock crossing
+    reg [11:0] edge_gray_sync1;         // clk_ref domain synchronizer
+    reg [11:0] edge_gray_sync2;
+    reg [11:0] edge_count_window_start; // Edge count at the window start
+    reg [11:0] edge_count_ref;          // Synchronized edge count (binary)
+    reg [11:0] edges_in_window;
     reg [19:0] ref_divider;             // Reference divider for measurement window
     reg frequency_in_range;             // Frequency within specified range
     reg pll_lock_stable;                // PLL lock signal stable (debounced)
-    reg pll_lock_prev;                  // Previous PLL lock state
+    reg pll_lock_prev;                  // pll_lock_stable one cycle earlier
     reg [1:0] lock_edge_buffer;         // Debounce buffer for lock signal
     reg lock_fault_pending;             // Loss-of-lock fault pending
+    integer i;
 
     // =========================================================================
     // Configuration Register Validation
@@ -48,41 +58,71 @@ module pll_monitor (
     // =========================================================================
     // Clock Edge Counter: Measure PLL frequency indirectly
     // =========================================================================
-    // Count rising edges on pll_clk within a fixed reference window
-    // Window = 1 million reference clock cycles = 2.5ms @ 400MHz (sufficient resolution)
+    // Free-running count of rising edges on clk_pll. It crosses into the
+    // clk_ref domain Gray-coded (one bit changes per edge), so a sample
+    // taken mid-transition is off by at most one edge.
     
     always @(posedge clk_pll or negedge rst_n) begin
         if (!rst_n) begin
-            edge_counter <= 20'h0;
+            edge_counter <= 12'h0;
+            edge_counter_gray <= 12'h0;
         end else begin
-            if (enable && ref_divider == 20'h0) begin
-                // Reference window boundary: latch current count (frequency estimate)
-                clk_pll_freq_measured <= edge_counter[27:20];  // Simplified: use top 8 bits
-                edge_counter <= 20'h1;                          // Reset counter
-            end else begin
-                if (edge_counter < 20'hFFFFF) begin
-                    edge_counter <= edge_counter + 20'h1;      // Keep counting
-                end
-            end
+            edge_counter <= edge_counter + 12'h1;
+            edge_counter_gray <= (edge_counter + 12'h1) ^ ((edge_counter + 12'h1) >> 1);
         end
     end
 
+    always @(posedge clk_ref or negedge rst_n) begin
+        if (!rst_n) begin
+            edge_gray_sync1 <= 12'h0;
+            edge_gray_sync2 <= 12'h0;
+        end else begin
+            edge_gray_sync1 <= edge_counter_gray;
+            edge_gray_sync2 <= edge_gray_sync1;
+        end
+    end
+
+    // Gray to binary
+    always @(*) begin
+        edge_count_ref[11] = edge_gray_sync2[11];
+        for (i = 10; i >= 0; i = i - 1) begin
+            edge_count_ref[i] = edge_count_ref[i + 1] ^ edge_gray_sync2[i];
+        end
+    end
+
+    // Edges since the window start (modulo 4096, > 4GHz never wraps)
+    always @(*) begin
+        edges_in_window = edge_count_ref - edge_count_window_start;
+    end
+
     // =========================================================================
     // Reference Divider: Create measurement window
     // =========================================================================
-    // Divide reference clock by 1M cycles (400MHz / 1M = 400Hz)
+    // Window = REF_CLK_MHZ reference cycles = 1μs, so the PLL edges counted
+    // in one window are its frequency in MHz (1MHz resolution, adequate for
+    // the ±1% check)
     always @(posedge clk_ref or negedge rst_n) begin
         if (!rst_n) begin
             ref_divider <= 20'h0;
+            edge_count_window_start <= 12'h0;
+            clk_pll_freq_measured <= 10'h0;
+            measurement_valid <= 1'b0;
         end else begin
             if (enable) begin
-                if (ref_divider >= 20'hF4240) begin  // 1M cycles
+                if (ref_divider >= REF_CLK_MHZ - 1) begin
+                    // Window boundary: latch the edges seen in this window
                     ref_divider <= 20'h0;
+                    edge_count_window_start <= edge_count_ref;
+                    clk_pll_freq_measured <= (edges_in_window > 12'd1023) ?
+                                             10'd1023 : edges_in_window[9:0];
+                    measurement_valid <= 1'b1;
                 end else begin
                     ref_divider <= ref_divider + 20'h1;
                 end
             end else begin
                 ref_divider <= 20'h0;
+                edge_count_window_start <= edge_count_ref;
+                measurement_valid <= 1'b0;
             end
         end
     end
@@ -95,7 +135,7 @@ module pll_monitor (
         if (!rst_n) begin
             frequency_in_range <= 1'b0;
         end else begin
-            if (enable) begin
+            if (enable && measurement_valid) begin
                 // Check if measured frequency is within [freq_low, freq_high]
                 if ((clk_pll_freq_measured >= freq_low) && (clk_pll_freq_measured <= freq_high)) begin
                     frequency_in_range <= 1'b1;
@@ -103,7 +143,7 @@ module pll_monitor (
                     frequency_in_range <= 1'b0;
                 end
             end else begin
-                frequency_in_range <= 1'b1;  // No fault when disabled
+                frequency_in_range <= 1'b1;  // No fault when disabled or before the first window
             end
         end
     end
@@ -122,7 +162,7 @@ module pll_monitor (
             if (enable) begin
                 // Shift debounce buffer
                 lock_edge_buffer <= {lock_edge_buffer[0], pll_lock};
-                pll_lock_prev <= pll_lock;
+                pll_lock_prev <= pll_lock_stable;
                 
                 // Stable lock when all buffer elements agree with current
                 if ((lock_edge_buffer == 2'b11) && pll_lock) begin
@@ -133,6 +173,7 @@ module pll_monitor (
                 // else: maintain previous state during transition
             end else begin
                 lock_edge_buffer <= 2'b0;
+                pll_lock_prev <= 1'b0;
                 pll_lock_stable <= 1'b0;
             end
         end
@@ -164,7 +205,8 @@ module pll_monitor (
             fault_pll_lol <= 1'b0;
         end else begin
             if (enable) begin
-                // Detect falling edge on pll_lock signal
+                // Detect falling edge on the debounced lock (a rising edge,
+                // e.g. the first lock after enable, is not a fault)
                 if (pll_lock_prev && !pll_lock_stable) begin
                     // Loss-of-lock detected
                     lock_fault_pending <= 1'b1;
@@ -254,7 +296,9 @@ endmodule
 // 1. Frequency Measurement:
 //    - Indirect measurement via edge counting
 //    - Resolution depends on measurement window length
-//    - 1M reference cycles provides ~1MHz resolution (adequate for ±1% check)
+//    - 1μs window (REF_CLK_MHZ reference cycles) gives the frequency in MHz
+//      directly at 1MHz resolution (adequate for ±1% check)
+//    - Edge count crosses clock domains Gray-coded (2-flop synchronizer)
 //
 // 2. Lock Debounce:
 //    - 2-cycle hysteresis prevents single-cycle glitch faults
@@ -286,8 +330,8 @@ endmodule
         .pll_lock(pll_lock_status),
         .pll_fdco(pll_fine_dco),
         .enable(monitor_enable),
-        .freq_low(8'd396),      // 396MHz (99% of 400MHz)
-        .freq_high(8'd404),     // 404MHz (101% of 400MHz)
+        .freq_low(10'd396),     // 396MHz (99% of 400MHz)
+        .freq_high(10'd404),    // 404MHz (101% of 400MHz)
         .fault_pll_osr(fault_pll_freq),
         .fault_pll_lol(fault_pll_lol)
     );
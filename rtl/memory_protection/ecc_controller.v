@@ -22,16 +22,44 @@
  * - Cyclomatic Complexity (CC): ≤ 8
  *
  * Registers:
- * - ECC_CTRL (0x00): Control register (enable, threshold)
+ * - ECC_CTRL (0x00): Control register (enable, threshold, counter mode,
+ *                    [10] = SBE_FAULT_MASK: SBEs do not raise mem_fault_irq)
  * - SBE_COUNT (0x04): Single-Bit Error counter
  * - MBE_COUNT (0x08): Multiple-Bit Error counter
  * - ERR_STATUS (0x0C): Last error status and position
+ * - FIFO_STATUS (0x10): Error FIFO fill level [7:0], overflow [31] (W1C)
+ * - FIFO_POP (0x14): Pops the oldest error entry (read side effect):
+ *                    [31] = valid, [9] = MBE, [8] = SBE, [6:0] = syndrome
+ * - FIFO_ADDR (0x18): Address of the entry returned by the last FIFO_POP
+ * - IRQ_COAL (0x1C): mem_fault_irq coalescing: [7:0] = event count N,
+ *                    [31:8] = timeout T in cycles
+ *
+ * Interrupt coalescing: with N >= 2, mem_fault_irq pulses once per N
+ * errors, or T cycles after the first error still pending, whichever
+ * comes first (T = 0: count only). An MBE fires immediately and flushes
+ * the pending SBEs. N <= 1 keeps one pulse per error (reset default).
+ *
+ * Error FIFO: every error counted while ECC is enabled pushes
+ * {address, SBE/MBE, syndrome}. When all FIFO_DEPTH entries are full new
+ * errors are dropped (counters still count them) and the sticky overflow
+ * flag is set, so firmware can drain a burst from one interrupt.
+ *
+ * Counter modes (ECC_CTRL[9:8], writable when COUNTER_MODE_EN = 1):
+ * - 0: SATURATE      - stop at 2^COUNTER_WIDTH-1 (reset default)
+ * - 1: WRAP          - count modulo 2^COUNTER_WIDTH; firmware accumulates
+ *                      deltas and must read once per 2^COUNTER_WIDTH events
+ * - 2: CLEAR_ON_READ - an APB read returns the count and restarts it at 0
+ *                      (or 1 if an error is counted in the same cycle)
+ * - 3: reserved, behaves as SATURATE
  */
 
 module ecc_controller #(
     parameter DATA_WIDTH = 64,
     parameter ECC_WIDTH  = 8,
-    parameter COUNTER_WIDTH = 16  // 16-bit error counters (0-65535)
+    parameter COUNTER_WIDTH = 16, // 16-bit error counters (0-65535)
+    parameter COUNTER_MODE_EN = 1,// 1 = ECC_CTRL[9:8] counter mode writable
+    parameter ADDR_WIDTH = 32,    // Error address width (bus address)
+    parameter FIFO_DEPTH = 8      // Error FIFO entries (power of 2, 2-128)
 ) (
     // System signals
     input  logic clk,
@@ -43,11 +71,12 @@ module ecc_controller #(
     input  logic                  ecc_sbe,          // Single-Bit Error
     input  logic                  ecc_mbe,          // Multiple-Bit Error
     input  logic [6:0]            ecc_error_pos,    // Error position
+    input  logic [ADDR_WIDTH-1:0] ecc_error_addr,   // Address of the access
     
     // APB Slave Interface (register access)
     input  logic                  psel,             // Peripheral Select
     input  logic                  penable,          // Enable
-    input  logic [3:0]            paddr,            // Address (4 registers)
+    input  logic [4:0]            paddr,            // Address (8 registers)
     input  logic                  pwrite,           // Write Enable
     input  logic [31:0]           pwdata,           // Write Data
     output logic [31:0]           prdata,           // Read Data
@@ -55,7 +84,7 @@ module ecc_controller #(
     output logic                  pslverr,          // Slave Error
     
     // Interrupt signals
-    output logic                  mem_fault_irq,    // Fault interrupt (SBE | MBE)
+    output logic                  mem_fault_irq,    // Fault interrupt (SBE | MBE, coalesced)
     output logic                  sbe_irq,          // SBE interrupt (if enabled)
     output logic                  mbe_irq,          // MBE interrupt (if enabled)
     
@@ -72,6 +101,8 @@ module ecc_controller #(
     // Bits [1] = SBE_IRQ_EN (enable SBE interrupts)
     // Bits [2] = MBE_IRQ_EN (enable MBE interrupts)
     // Bits [7:3] = SBE_THRESHOLD (interrupt on Nth SBE, 0=disable)
+    // Bits [9:8] = COUNTER_MODE (held in counter_mode below)
+    // Bits [10] = SBE_FAULT_MASK (held in sbe_fault_mask below)
     logic [7:0] ecc_ctrl;
     logic ecc_enable, sbe_irq_en, mbe_irq_en;
     logic [4:0] sbe_threshold;
@@ -81,6 +112,22 @@ module ecc_controller #(
     assign mbe_irq_en = ecc_ctrl[2];
     assign sbe_threshold = ecc_ctrl[7:3];
     
+    // Counter Mode: ECC_CTRL[9:8] (stays SATURATE if COUNTER_MODE_EN = 0)
+    localparam logic [1:0] CNT_SATURATE      = 2'd0;
+    localparam logic [1:0] CNT_WRAP          = 2'd1;
+    localparam logic [1:0] CNT_CLEAR_ON_READ = 2'd2;
+    logic [1:0] counter_mode;
+    
+    // SBE Fault Mask: ECC_CTRL[10]. SBEs are still counted and captured in
+    // the FIFO but do not raise mem_fault_irq (firmware polls them under
+    // high error rates); MBEs always interrupt
+    logic sbe_fault_mask;
+    
+    // Counter register reads (APB access phase, one cycle per read)
+    logic sbe_count_rd, mbe_count_rd;
+    assign sbe_count_rd = psel & penable & ~pwrite & (paddr == 5'h04);
+    assign mbe_count_rd = psel & penable & ~pwrite & (paddr == 5'h08);
+    
     // Error Counters
     logic [COUNTER_WIDTH-1:0] sbe_count;    // 16-bit SBE counter
     logic [COUNTER_WIDTH-1:0] mbe_count;    // 16-bit MBE counter
@@ -97,9 +144,12 @@ module ecc_controller #(
     always_ff @(posedge clk or negedge reset_n) begin
         if (~reset_n) begin
             sbe_count <= '0;
+        end else if ((counter_mode == CNT_CLEAR_ON_READ) & sbe_count_rd) begin
+            // Read returns the old count; an error in this cycle starts the next
+            sbe_count <= {{(COUNTER_WIDTH-1){1'b0}}, ecc_enable & ecc_sbe};
         end else if (ecc_enable & ecc_sbe) begin
-            if (sbe_count < {COUNTER_WIDTH{1'b1}}) begin
-                sbe_count <= sbe_count + 1'b1;  // Saturate at max
+            if ((counter_mode == CNT_WRAP) | (sbe_count < {COUNTER_WIDTH{1'b1}})) begin
+                sbe_count <= sbe_count + 1'b1;  // Saturate at max unless WRAP
             end
         end
     end
@@ -108,9 +158,11 @@ module ecc_controller #(
     always_ff @(posedge clk or negedge reset_n) begin
         if (~reset_n) begin
             mbe_count <= '0;
+        end else if ((counter_mode == CNT_CLEAR_ON_READ) & mbe_count_rd) begin
+            mbe_count <= {{(COUNTER_WIDTH-1){1'b0}}, ecc_enable & ecc_mbe};
         end else if (ecc_enable & ecc_mbe) begin
-            if (mbe_count < {COUNTER_WIDTH{1'b1}}) begin
-                mbe_count <= mbe_count + 1'b1;  // Saturate at max
+            if ((counter_mode == CNT_WRAP) | (mbe_count < {COUNTER_WIDTH{1'b1}})) begin
+                mbe_count <= mbe_count + 1'b1;  // Saturate at max unless WRAP
             end
         end
     end
@@ -127,12 +179,95 @@ module ecc_controller #(
         end
     end
     
+    // ========================================================================
+    // Error Capture FIFO
+    // ========================================================================
+    
+    localparam int FIFO_PTR_W = $clog2(FIFO_DEPTH);
+    localparam int FIFO_ENTRY_W = ADDR_WIDTH + 9;   // {addr, mbe, sbe, pos}
+    
+    logic [FIFO_ENTRY_W-1:0] fifo_mem [FIFO_DEPTH];
+    logic [FIFO_PTR_W:0]     fifo_wr_ptr, fifo_rd_ptr;  // Extra wrap bit
+    logic [FIFO_PTR_W:0]     fifo_level;
+    logic                    fifo_empty, fifo_full;
+    logic                    fifo_overflow;              // Sticky, W1C
+    logic [ADDR_WIDTH-1:0]   fifo_pop_addr;              // FIFO_ADDR register
+    logic [FIFO_ENTRY_W-1:0] fifo_head;
+    logic                    fifo_push, fifo_pop;
+    
+    assign fifo_level = fifo_wr_ptr - fifo_rd_ptr;
+    assign fifo_empty = (fifo_level == '0);
+    assign fifo_full  = (fifo_level == FIFO_DEPTH[FIFO_PTR_W:0]);
+    assign fifo_head  = fifo_mem[fifo_rd_ptr[FIFO_PTR_W-1:0]];
+    
+    // Pop on a FIFO_POP read; a push into a full FIFO succeeds only if an
+    // entry is popped in the same cycle
+    assign fifo_pop  = psel & penable & ~pwrite & (paddr == 5'h14) & ~fifo_empty;
+    assign fifo_push = ecc_enable & ecc_error & (~fifo_full | fifo_pop);
+    
+    always_ff @(posedge clk or negedge reset_n) begin
+        if (~reset_n) begin
+            fifo_wr_ptr <= '0;
+            fifo_rd_ptr <= '0;
+            fifo_overflow <= 1'b0;
+            fifo_pop_addr <= '0;
+        end else begin
+            if (fifo_push) begin
+                fifo_mem[fifo_wr_ptr[FIFO_PTR_W-1:0]] <=
+                    {ecc_error_addr, ecc_mbe, ecc_sbe, ecc_error_pos};
+                fifo_wr_ptr <= fifo_wr_ptr + 1'b1;
+            end
+            
+            if (fifo_pop) begin
+                fifo_pop_addr <= fifo_head[FIFO_ENTRY_W-1:9];
+                fifo_rd_ptr <= fifo_rd_ptr + 1'b1;
+            end
+            
+            if (ecc_enable & ecc_error & ~fifo_push) begin
+                fifo_overflow <= 1'b1;  // Entry dropped
+            end else if (psel & penable & pwrite & (paddr == 5'h10) & pwdata[31]) begin
+                fifo_overflow <= 1'b0;  // Write 1 to clear
+            end
+        end
+    end
+    
     // ========================================================================
     // Interrupt Generation Logic
     // ========================================================================
     
-    // Main fault interrupt: triggered by any error if ECC enabled
-    assign mem_fault_irq = ecc_enable & ecc_error;
+    // Main fault interrupt: triggered by any error if ECC enabled (SBEs
+    // unless SBE_FAULT_MASK), coalesced per IRQ_COAL
+    logic [7:0]  coal_count_thr;   // IRQ_COAL[7:0]: events per interrupt
+    logic [23:0] coal_timeout;     // IRQ_COAL[31:8]: cycles, 0 = no timeout
+    logic [7:0]  coal_pending;     // Errors since the last pulse
+    logic [23:0] coal_timer;       // Cycles since the first pending error
+    logic        coal_enable, coal_event, coal_fire;
+    
+    assign coal_enable = (coal_count_thr > 8'd1);
+    assign coal_event  = ecc_enable & (ecc_mbe | (ecc_sbe & ~sbe_fault_mask));
+    assign coal_fire   = (ecc_enable & ecc_mbe) |                       // MBE bypass
+                         (coal_event & ({1'b0, coal_pending} + 9'd1 >= {1'b0, coal_count_thr})) |
+                         ((coal_pending != 8'd0) & (coal_timeout != 24'd0) &
+                          (coal_timer >= coal_timeout));
+    
+    always_ff @(posedge clk or negedge reset_n) begin
+        if (~reset_n) begin
+            coal_pending <= 8'd0;
+            coal_timer <= 24'd0;
+        end else if (~coal_enable | coal_fire) begin
+            coal_pending <= 8'd0;
+            coal_timer <= 24'd0;
+        end else begin
+            if (coal_event & (coal_pending != 8'hFF)) begin
+                coal_pending <= coal_pending + 1'b1;
+            end
+            if ((coal_pending != 8'd0) | coal_event) begin
+                coal_timer <= coal_timer + 1'b1;
+            end
+        end
+    end
+    
+    assign mem_fault_irq = coal_enable ? coal_fire : coal_event;
     
     // SBE-specific interrupt: enabled if SBE_IRQ_EN and threshold reached
     logic sbe_threshold_reached;
@@ -160,12 +295,27 @@ module ecc_controller #(
     always_ff @(posedge clk or negedge reset_n) begin
         if (~reset_n) begin
             ecc_ctrl <= 8'h00;
+            counter_mode <= CNT_SATURATE;
+            sbe_fault_mask <= 1'b0;
+            coal_count_thr <= 8'd0;
+            coal_timeout <= 24'd0;
         end else if (psel & penable & pwrite) begin
             case (paddr)
-                4'h0: ecc_ctrl <= pwdata[7:0];  // ECC_CTRL register
-                4'h4: begin end                  // SBE_COUNT (read-only)
-                4'h8: begin end                  // MBE_COUNT (read-only)
-                4'hC: begin end                  // ERR_STATUS (read-only)
+                5'h00: begin                     // ECC_CTRL register
+                    ecc_ctrl <= pwdata[7:0];
+                    if (COUNTER_MODE_EN != 0) begin
+                        counter_mode <= pwdata[9:8];
+                    end
+                    sbe_fault_mask <= pwdata[10];
+                end
+                5'h04: begin end                 // SBE_COUNT (read-only)
+                5'h08: begin end                 // MBE_COUNT (read-only)
+                5'h0C: begin end                 // ERR_STATUS (read-only)
+                5'h10: begin end                 // FIFO_STATUS (W1C in FIFO block)
+                5'h1C: begin                     // IRQ_COAL register
+                    coal_count_thr <= pwdata[7:0];
+                    coal_timeout <= pwdata[31:8];
+                end
                 default: begin end
             endcase
         end
@@ -177,10 +327,16 @@ module ecc_controller #(
         
         if (psel & penable & ~pwrite) begin
             case (paddr)
-                4'h0: prdata = {24'h0000_00, ecc_ctrl};        // ECC_CTRL
-                4'h4: prdata = {{(32-COUNTER_WIDTH){1'b0}}, sbe_count};  // SBE_COUNT
-                4'h8: prdata = {{(32-COUNTER_WIDTH){1'b0}}, mbe_count};  // MBE_COUNT
-                4'hC: prdata = {24'h0000_00, last_error_pos, error_status};  // ERR_STATUS
+                5'h00: prdata = {21'h0, sbe_fault_mask, counter_mode, ecc_ctrl};  // ECC_CTRL
+                5'h04: prdata = {{(32-COUNTER_WIDTH){1'b0}}, sbe_count};  // SBE_COUNT
+                5'h08: prdata = {{(32-COUNTER_WIDTH){1'b0}}, mbe_count};  // MBE_COUNT
+                5'h0C: prdata = {24'h0000_00, last_error_pos, error_status};  // ERR_STATUS
+                5'h10: prdata = {fifo_overflow, 23'h0,                   // FIFO_STATUS
+                                 {(8-FIFO_PTR_W-1){1'b0}}, fifo_level};
+                5'h14: prdata = fifo_empty ? 32'h0000_0000 :              // FIFO_POP
+                                {1'b1, 21'h0, fifo_head[8:7], 1'b0, fifo_head[6:0]};
+                5'h18: prdata = {{(32-ADDR_WIDTH){1'b0}}, fifo_pop_addr}; // FIFO_ADDR
+                5'h1C: prdata = {coal_timeout, coal_count_thr};           // IRQ_COAL
                 default: prdata = 32'h0000_0000;
             endcase
         end
@@ -193,9 +349,10 @@ endmodule
 // ============================================================================
 
 /*
-// Property 1: Error counter does not decrement
+// Property 1: Error counter does not decrement (SATURATE mode)
 property sbe_counter_monotonic;
-  @(posedge clk) (sbe_count_next >= sbe_count_current);
+  @(posedge clk) (counter_mode == CNT_SATURATE) |->
+    (sbe_count_next >= sbe_count_current);
 endproperty
 assert property (sbe_counter_monotonic);
 
@@ -219,6 +376,19 @@ property error_status_capture;
     error_status == {mbe, sbe, 6'h00};
 endproperty
 assert property (error_status_capture);
+
+// Property 5: FIFO level never exceeds its depth
+property fifo_level_bounded;
+  @(posedge clk) (fifo_level <= FIFO_DEPTH);
+endproperty
+assert property (fifo_level_bounded);
+
+// Property 6: An MBE always raises mem_fault_irq (SBE mask, coalescing)
+property mbe_fault_irq_unmasked;
+  @(posedge clk) if (ecc_enable && ecc_mbe)
+    mem_fault_irq == 1'b1;
+endproperty
+assert property (mbe_fault_irq_unmasked);
 */
 
 // ============================================================================
@@ -46,24 +46,26 @@ module comparator (
 parameter real VREF_NOMINAL = 1.35;
 parameter real HYSTERESIS_WINDOW = 0.05;  // ±50mV
 
-wire comparator_output;
+reg comparator_output;
 
 // ============================================================================
 // Comparator Stage
 // ============================================================================
 
-// Behavioral comparator with hysteresis
-always @(*) begin
-    if (vdd_in > (vref + HYSTERESIS_WINDOW/2)) begin
+// Behavioral comparator with hysteresis, sampled at 400MHz (2.5ns, inside
+// the 50ns propagation budget). Holding the state inside the window needs
+// storage; a combinational hold is a latch loop.
+always @(posedge clk or negedge reset_n) begin
+    if (!reset_n) begin
+        comparator_output <= 1'b0;
+    end else if (vdd_in > (vref + HYSTERESIS_WINDOW/2)) begin
         // VDD is above upper threshold: NOT in fault condition
         comparator_output <= 1'b0;
     end else if (vdd_in < (vref - HYSTERESIS_WINDOW/2)) begin
         // VDD is below lower threshold: IN fault condition
         comparator_output <= 1'b1;
-    end else begin
-        // Inside hysteresis window: maintain current state
-        comparator_output <= comparator_output;
     end
+    // else: inside hysteresis window, maintain current state
 end
 
 // ============================================================================
@@ -75,10 +77,6 @@ end
 //  τ = R × C = 10k × 1n = 10μs
 //  fc = 1/(2πτ) ≈ 15.9kHz ≈ 16kHz
 
-// Filter state (discretized): captures integrator output
-reg [7:0] filter_state_r;
-wire [7:0] filter_state_w;
-
 // Exponential moving average (EMA) filter
 // Filter_out[n] = (1 - α) × Filter_out[n-1] + α × Input[n]
 // where α = Δt/(τ + Δt)
@@ -88,17 +86,27 @@ wire [7:0] filter_state_w;
 parameter integer FILTER_SHIFT = 12;  // Equivalent to division by 4096
 parameter integer FILTER_INPUT_MAX = 256;
 
+// Filter state (discretized): captures integrator output. The accumulator
+// keeps FILTER_SHIFT fraction bits below the 8-bit state; without them
+// alpha = 1/4096 rounds every step to zero.
+reg [FILTER_SHIFT+8:0] filter_acc;
+wire [7:0] filter_state_w;
+
 always @(posedge clk or negedge reset_n) begin
     if (!reset_n) begin
-        filter_state_r <= 8'd0;
+        filter_acc <= {(FILTER_SHIFT+9){1'b0}};
     end else begin
-        // Shift-based exponential filter (efficient integer arithmetic)
-        filter_state_r <= (filter_state_r - (filter_state_r >> FILTER_SHIFT)) +
-                         (comparator_output ? (FILTER_INPUT_MAX >> FILTER_SHIFT) : 8'd0);
+        // Shift-based exponential filter (efficient integer arithmetic):
+        // acc += (input << FILTER_SHIFT - acc) >> FILTER_SHIFT
+        filter_acc <= (filter_acc - (filter_acc >> FILTER_SHIFT)) +
+                      (comparator_output ? FILTER_INPUT_MAX[FILTER_SHIFT+8:0] :
+                                           {(FILTER_SHIFT+9){1'b0}});
     end
 end
 
-assign filter_state_w = filter_state_r;
+// Integer part, saturated (settles at FILTER_INPUT_MAX = 256)
+assign filter_state_w = filter_acc[FILTER_SHIFT+8] ? 8'hFF :
+                        filter_acc[FILTER_SHIFT+7:FILTER_SHIFT];
 assign filter_state = filter_state_w;
 
 // ============================================================================
@@ -77,8 +77,8 @@ always @(*) begin
             supply_enable = 1'b0;
             power_stage = 2'b00;
             
-            if (!sys_shutdown_req && !reset_n) begin
-                // Start power-on sequence
+            if (!sys_shutdown_req) begin
+                // Start power-on sequence (out of reset)
                 next_state = STATE_STAGE1_RAMP;
                 supply_enable = 1'b1;
             end
@@ -227,21 +227,6 @@ always @(posedge clk or negedge reset_n) begin
     end
 end
 
-// ============================================================================
-// Output Registers
-// ============================================================================
-
-always @(posedge clk or negedge reset_n) begin
-    if (!reset_n) begin
-        safe_state_en <= 1'b0;
-        supply_enable <= 1'b0;
-        power_stage <= 2'b00;
-    end else begin
-        // Combinational logic already computed above
-        // Just register the outputs from next_state logic
-    end
-end
-
 // ============================================================================
 // Output Assignment
 // ============================================================================
@@ -323,9 +308,9 @@ always @(posedge clk) begin
         STATE_SAFE_STATE, STATE_SHUTDOWN
     }) else $error("Invalid supply sequencer state");
     
-    // Verify safe state entry completes within timing budget
-    if (current_state == STATE_SAFE_STATE_ENTRY) begin
-        assert (##1 (current_state == STATE_SAFE_STATE))
+    // Verify safe state entry completes within timing budget (next cycle)
+    if (reset_n && current_state == STATE_SAFE_STATE_ENTRY) begin
+        assert (next_state == STATE_SAFE_STATE)
             else $error("Safe state entry not completed in time");
     end
 end
@@ -191,6 +191,31 @@ assign fault_counter = fault_counter_r;
 //  - Total: 4 + 2 = 6 ≤ 10 ✓
 // Complexity is well within the CC ≤ 10 requirement
 
+// ============================================================================
+// Coverage Point: Test Cases Required
+// ============================================================================
+
+// TC01: Normal operation (VDD good)
+//   - Verify MONITOR, fault_vdd = 0 for 1000 cycles
+// TC02: Sustained undervoltage
+//   - comparator_out held high, verify FAULT_DETECTED and fault_vdd held
+// TC03: Fault output delay
+//   - Measure comparator_out to fault_vdd (Property 1: 1-4 cycles)
+// TC04: False alarm
+//   - comparator_out clears without recovery, verify return to MONITOR
+// TC05: External recovery
+//   - external_recovery in FAULT_DETECTED: recovery_ready, RECOVERY
+// TC06: Recovery exit
+//   - RECOVERY -> MONITOR with VDD good, -> FAULT_DETECTED with VDD low
+// TC07: Recovery without a fault
+//   - external_recovery in MONITOR is ignored
+// TC08: Fault counting
+//   - Counts MONITOR -> FAULT_DETECTED only, not re-entries from RECOVERY
+// TC09: Edge case: fault counter saturation
+//   - 65536+ faults, verify fault_counter holds at 0xFFFF
+// TC10: Reset during fault
+//   - Async reset clears state, fault_vdd and fault_counter
+
 // ============================================================================
 // Formal Verification Properties
 // ============================================================================
@@ -0,0 +1,51 @@
+# Fault regression speed under the fast and signoff Verilator profiles
+#
+# cmake -DFAST=<rtl_fault_regression_fast> -DSIGNOFF=<rtl_fault_regression_signoff>
+#       [-DROUNDS=<n>] -P profile_bench.cmake
+#
+# Runs both executables on the same number of rounds, prints their JSON
+# and the speedup of fast over signoff in simulated cycles per second.
+# Fails if either regression fails.
+
+if(NOT FAST OR NOT SIGNOFF)
+    message(FATAL_ERROR "FAST and SIGNOFF must name the two regression executables")
+endif()
+if(NOT ROUNDS)
+    set(ROUNDS 100)
+endif()
+
+# Run one profile, set <profile>_CPS to its simulated cycles per second
+function(run_profile profile exe)
+    execute_process(
+        COMMAND ${exe} ${ROUNDS}
+        OUTPUT_VARIABLE out
+        RESULT_VARIABLE rc
+    )
+    message("${profile}:\n${out}")
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "${profile} fault regression failed (${rc})")
+    endif()
+    if(NOT out MATCHES "\"cycles_per_second\": ([0-9]+)")
+        message(FATAL_ERROR "${profile}: no cycles_per_second in the output")
+    endif()
+    set(${profile}_CPS ${CMAKE_MATCH_1} PARENT_SCOPE)
+endfunction()
+
+run_profile(fast ${FAST})
+run_profile(signoff ${SIGNOFF})
+
+if(signoff_CPS EQUAL 0)
+    message(FATAL_ERROR "signoff: zero cycles per second")
+endif()
+
+# Speedup with two decimals, integer arithmetic only
+math(EXPR speedup_x100 "${fast_CPS} * 100 / ${signoff_CPS}")
+math(EXPR speedup_int "${speedup_x100} / 100")
+math(EXPR speedup_frac "${speedup_x100} % 100")
+if(speedup_frac LESS 10)
+    set(speedup_frac "0${speedup_frac}")
+endif()
+
+message("fast:    ${fast_CPS} cycles/s")
+message("signoff: ${signoff_CPS} cycles/s")
+message("speedup: ${speedup_int}.${speedup_frac}x (fast over signoff, ${ROUNDS} rounds)")
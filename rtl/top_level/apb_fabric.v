@@ -0,0 +1,88 @@
+/**
+ * @file apb_fabric.v
+ * @brief APB3 Interconnect for the Power Management Safety Peripherals
+ *
+ * Single APB master, NUM_SLAVES slaves on consecutive 4 KB pages of the
+ * peripheral window (PERIPH_BASE = 0x4000_0000, 1 MB). Slave i owns
+ * PERIPH_BASE + (BASE_PAGE + i) * 4 KB; the fabric forwards the 12-bit
+ * page offset.
+ *
+ * Design Specifications:
+ *  - Address decode on paddr[19:12], combinational (no wait states added)
+ *  - psel fan-out, prdata/pready/pslverr mux by the decoded slave
+ *  - Unmapped pages complete in one access cycle with pslverr = 1 and
+ *    prdata = 0 (no bus hang on a stray firmware access)
+ *
+ * Address Map (matches firmware hal/power_api.c and memory/ecc_service.h):
+ *  - 0x4001_0000: Power control (page 0x10)
+ *  - 0x4001_1000: ECC controller (page 0x11)
+ *  - 0x4001_2000: Clock monitor control (page 0x12)
+ */
+
+`timescale 1ns / 1ps
+
+module apb_fabric #(
+    parameter NUM_SLAVES = 3,
+    parameter [7:0] BASE_PAGE = 8'h10   // First slave page in the window
+) (
+    // APB master side (firmware / bus functional model)
+    input  logic                    psel,
+    input  logic                    penable,
+    input  logic [19:0]             paddr,      // Offset in the peripheral window
+    input  logic                    pwrite,
+    input  logic [31:0]             pwdata,
+    output logic [31:0]             prdata,
+    output logic                    pready,
+    output logic                    pslverr,
+
+    // APB slave side (shared penable/paddr/pwrite/pwdata)
+    output logic [NUM_SLAVES-1:0]   s_psel,
+    output logic                    s_penable,
+    output logic [11:0]             s_paddr,
+    output logic                    s_pwrite,
+    output logic [31:0]             s_pwdata,
+    input  logic [NUM_SLAVES*32-1:0] s_prdata,
+    input  logic [NUM_SLAVES-1:0]   s_pready,
+    input  logic [NUM_SLAVES-1:0]   s_pslverr
+);
+
+    // ========================================================================
+    // Address Decode
+    // ========================================================================
+
+    logic [7:0] page;
+    logic       hit;
+    logic [7:0] slave;
+
+    assign page  = paddr[19:12];
+    assign hit   = (page >= BASE_PAGE) && (page < BASE_PAGE + NUM_SLAVES);
+    assign slave = page - BASE_PAGE;
+
+    always_comb begin
+        s_psel = '0;
+        if (psel & hit) begin
+            s_psel[slave] = 1'b1;
+        end
+    end
+
+    assign s_penable = penable;
+    assign s_paddr   = paddr[11:0];
+    assign s_pwrite  = pwrite;
+    assign s_pwdata  = pwdata;
+
+    // ========================================================================
+    // Response Mux
+    // ========================================================================
+
+    always_comb begin
+        prdata  = 32'h0000_0000;
+        pready  = psel & penable;      // Unmapped: complete at once ...
+        pslverr = psel & penable;      // ... with an error
+        if (hit) begin
+            prdata  = s_prdata[slave*32 +: 32];
+            pready  = s_pready[slave];
+            pslverr = s_pslverr[slave];
+        end
+    end
+
+endmodule
@@ -0,0 +1,95 @@
+/**
+ * @file clk_ctrl_regs.v
+ * @brief Clock Monitor APB Register Block (0x4001_2000)
+ *
+ * Configuration and status of the clock watchdog and PLL monitor.
+ *
+ * Registers:
+ *  - 0x00 CLK_CTRL
+ *      [0] WDG_EN (reset 1)   [1] PLL_MON_EN (reset 1)
+ *  - 0x04 CLK_WDG_TIMEOUT [19:0] (reset 400 = 1μs @ 400MHz)
+ *  - 0x08 CLK_PLL_LIMITS  [9:0] freq_low, [25:16] freq_high (MHz,
+ *      reset 396 / 404)
+ *  - 0x0C CLK_STATUS (RO)
+ *      [0] fault_clk   [1] fault_pll_lol   [2] fault_pll_osr
+ *
+ * The monitors run from reset so a clock fault before firmware start-up
+ * is not missed. Zero wait states; pslverr on offsets outside the block.
+ */
+
+`timescale 1ns / 1ps
+
+module clk_ctrl_regs (
+    input  logic        clk,
+    input  logic        reset_n,
+
+    // APB slave
+    input  logic        psel,
+    input  logic        penable,
+    input  logic [11:0] paddr,
+    input  logic        pwrite,
+    input  logic [31:0] pwdata,
+    output logic [31:0] prdata,
+    output logic        pready,
+    output logic        pslverr,
+
+    // Monitor status
+    input  logic        fault_clk,
+    input  logic        fault_pll_lol,
+    input  logic        fault_pll_osr,
+
+    // Monitor configuration
+    output logic        wdg_enable,
+    output logic [19:0] wdg_timeout,
+    output logic        pll_enable,
+    output logic [9:0]  pll_freq_low,
+    output logic [9:0]  pll_freq_high
+);
+
+    logic wr, rd, known;
+
+    assign wr = psel & penable & pwrite;
+    assign rd = psel & penable & ~pwrite;
+
+    always_ff @(posedge clk or negedge reset_n) begin
+        if (~reset_n) begin
+            wdg_enable <= 1'b1;
+            pll_enable <= 1'b1;
+            wdg_timeout <= 20'd400;
+            pll_freq_low <= 10'd396;
+            pll_freq_high <= 10'd404;
+        end else if (wr) begin
+            case (paddr)
+                12'h000: begin
+                    wdg_enable <= pwdata[0];
+                    pll_enable <= pwdata[1];
+                end
+                12'h004: wdg_timeout <= pwdata[19:0];
+                12'h008: begin
+                    pll_freq_low <= pwdata[9:0];
+                    pll_freq_high <= pwdata[25:16];
+                end
+                default: begin end
+            endcase
+        end
+    end
+
+    always_comb begin
+        prdata = 32'h0000_0000;
+        known = 1'b1;
+        case (paddr)
+            12'h000: prdata = {30'h0, pll_enable, wdg_enable};
+            12'h004: prdata = {12'h0, wdg_timeout};
+            12'h008: prdata = {6'h0, pll_freq_high, 6'h0, pll_freq_low};
+            12'h00C: prdata = {29'h0, fault_pll_osr, fault_pll_lol, fault_clk};
+            default: known = 1'b0;
+        endcase
+        if (~rd) begin
+            prdata = 32'h0000_0000;
+        end
+    end
+
+    assign pready = psel & penable;
+    assign pslverr = psel & penable & ~known;
+
+endmodule
@@ -0,0 +1,97 @@
+/**
+ * @file ecc_memory.v
+ * @brief ECC-Protected SRAM Model (ecc_encoder -> array -> ecc_decoder)
+ *
+ * Behavioral single-port SRAM storing 64-bit data plus the 8-bit code from
+ * ecc_encoder. Reads take one cycle; the stored word goes through
+ * ecc_decoder in the following cycle, when rd_valid is high.
+ *
+ * Fault injection: inject[71:0] is XORed onto {ecc, data} as the word is
+ * read (inject[63:0] data bits, inject[71:64] code bits), so a testbench
+ * or co-simulation can produce SBEs and MBEs at any address without
+ * modifying the array.
+ *
+ * Design Specifications:
+ *  - WORDS x 72 bits, word address, bus address = MEM_BASE + 8 * word
+ *  - Decoder flags are only valid with rd_valid (gated here)
+ */
+
+`timescale 1ns / 1ps
+
+module ecc_memory #(
+    parameter WORDS = 1024,
+    parameter [31:0] MEM_BASE = 32'h2000_0000   // SRAM bus address
+) (
+    input  logic                     clk,
+    input  logic                     reset_n,
+
+    // Memory port
+    input  logic                     req,
+    input  logic                     we,
+    input  logic [$clog2(WORDS)-1:0] addr,
+    input  logic [63:0]              wdata,
+    input  logic [71:0]              inject,     // Bit flips on read
+
+    // Read result (decoder outputs, one cycle after req & ~we)
+    output logic                     rd_valid,
+    output logic [63:0]              rd_data,     // Corrected data
+    output logic                     rd_error,
+    output logic                     rd_sbe,
+    output logic                     rd_mbe,
+    output logic [6:0]               rd_error_pos,
+    output logic [31:0]              rd_addr      // Bus address of the read
+);
+
+    logic [71:0] mem [WORDS];
+    logic [71:0] rd_word;
+    logic [7:0]  wr_ecc;
+    logic        error, sbe, mbe;
+
+    // ========================================================================
+    // Write Path: encode and store
+    // ========================================================================
+
+    ecc_encoder u_encoder (
+        .data_in (wdata),
+        .ecc_out (wr_ecc)
+    );
+
+    always_ff @(posedge clk) begin
+        if (req & we) begin
+            mem[addr] <= {wr_ecc, wdata};
+        end
+    end
+
+    // ========================================================================
+    // Read Path: registered read, decode next cycle
+    // ========================================================================
+
+    always_ff @(posedge clk or negedge reset_n) begin
+        if (~reset_n) begin
+            rd_valid <= 1'b0;
+            rd_word <= '0;
+            rd_addr <= '0;
+        end else begin
+            rd_valid <= req & ~we;
+            if (req & ~we) begin
+                rd_word <= mem[addr] ^ inject;
+                rd_addr <= MEM_BASE + {{(32-$clog2(WORDS)-3){1'b0}}, addr, 3'b000};
+            end
+        end
+    end
+
+    ecc_decoder u_decoder (
+        .data_in    (rd_word[63:0]),
+        .ecc_in     (rd_word[71:64]),
+        .data_out   (rd_data),
+        .error_flag (error),
+        .sbe_flag   (sbe),
+        .mbe_flag   (mbe),
+        .error_pos  (rd_error_pos)
+    );
+
+    assign rd_error = rd_valid & error;
+    assign rd_sbe   = rd_valid & sbe;
+    assign rd_mbe   = rd_valid & mbe;
+
+endmodule
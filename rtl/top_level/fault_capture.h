@@ -0,0 +1,324 @@
+/**
+ * @file fault_capture.h
+ * @brief Fault-triggered FST capture of the top-level ports
+ *
+ * A full waveform of a 400MHz soak run is mostly idle cycles, and dumping
+ * it costs more than the simulation. FaultCapture leaves the model
+ * untraced and keeps the top-level ports of the last pre_cycles cycles in
+ * a ring buffer. When a trigger output rises (fault_vdd, fault_clk,
+ * fault_pll_lol, fault_pll_osr, mem_fault_irq) it writes that window and
+ * the next post_cycles cycles to <prefix>_capture<n>.fst:
+ *
+ *   |<---- pre_cycles ---->|T|<---- post_cycles ---->|
+ *                           trigger (rising fault output)
+ *
+ *  - Ports are sampled once per cycle after the rising clk edge; clk is
+ *    redrawn in the file (high at the edge, low half a period later) on
+ *    the same time base as the full trace of TopBench.
+ *  - A trigger during a capture is part of that capture. After
+ *    max_captures files no more are written.
+ *  - The writer is GTKWave's fstapi as shipped with Verilator
+ *    (rtl_fst_writer, or the model's own with --trace-fst).
+ *
+ * Feature: 001-Power-Management-Safety
+ */
+
+#ifndef FAULT_CAPTURE_H
+#define FAULT_CAPTURE_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Vtop_power_management_safety.h"
+#include "gtkwave/fstapi.h"
+
+namespace rtl {
+
+using Top = Vtop_power_management_safety;
+
+constexpr uint64_t kHalfPeriodPs = 1250;        // 400MHz, timescale 1ns / 1ps
+
+/** Top-level ports after one rising clk edge */
+struct Sample {
+    uint64_t cycle;
+    uint64_t mem_wdata, mem_rdata;
+    uint64_t mem_inject_lo;                     // mem_inject[63:0]
+    uint32_t paddr, pwdata, prdata;
+    uint16_t mem_addr;
+    uint8_t mem_inject_hi;                      // mem_inject[71:64]
+    uint8_t rst_n, clk_mon, clk_pll, vdd_in, vref, pll_lock, pll_fdco;
+    uint8_t psel, penable, pwrite, pready, pslverr;
+    uint8_t mem_req, mem_we, mem_rvalid;
+    uint8_t fault_vdd, vdd_irq, fault_clk, fault_pll_lol, fault_pll_osr;
+    uint8_t mem_fault_irq, sbe_irq, mbe_irq;
+    uint8_t safe_state_en, safe_state_sw, supply_enable, power_stage;
+};
+
+class FaultCapture {
+public:
+    // Trigger outputs, one bit each
+    static constexpr uint8_t kTrigVdd    = 1U << 0;
+    static constexpr uint8_t kTrigClk    = 1U << 1;
+    static constexpr uint8_t kTrigPllLol = 1U << 2;
+    static constexpr uint8_t kTrigPllOsr = 1U << 3;
+    static constexpr uint8_t kTrigMem    = 1U << 4;
+    static constexpr uint8_t kTrigAll    = 0x1F;
+
+    FaultCapture(const std::string &prefix, uint32_t pre_cycles, uint32_t post_cycles,
+                 uint32_t max_captures, uint8_t triggers)
+        : prefix_(prefix), ring_(pre_cycles + 1U), post_cycles_(post_cycles),
+          max_captures_(max_captures), triggers_(triggers)
+    {
+    }
+
+    ~FaultCapture() { close(); }
+
+    FaultCapture(const FaultCapture &) = delete;
+    FaultCapture &operator=(const FaultCapture &) = delete;
+
+    /** Record the ports after cycle @p cycle (1 = first rising edge) */
+    void sample(const Top &dut, uint64_t cycle)
+    {
+        Sample &s = ring_[head_];
+        read(dut, cycle, s);
+        head_ = (head_ + 1U) % ring_.size();
+        if (count_ < ring_.size()) {
+            count_++;
+        }
+
+        uint8_t lines = trigger_lines(s);
+        uint8_t rises = static_cast<uint8_t>(lines & ~lines_ & triggers_);
+        lines_ = lines;
+
+        if (fst_ != nullptr) {
+            emit(s);
+            if (++post_ >= post_cycles_) {
+                close();
+            }
+        } else if (rises != 0U && s.rst_n && captures_ < max_captures_) {
+            open(s, rises);
+        }
+    }
+
+    uint32_t captures() const { return captures_; }
+
+private:
+    struct Port {
+        const char *name;
+        uint32_t width;
+        enum fstVarDir dir;
+        uint64_t (*get)(const Sample &);
+    };
+
+    static constexpr unsigned kPortCount = 35;
+
+    /** Ports written to the file, in file order */
+    static const Port *ports()
+    {
+        static const Port table[] = {
+            {"rst_n",             1, FST_VD_INPUT,  [](const Sample &s) -> uint64_t { return s.rst_n; }},
+            {"clk_mon",           1, FST_VD_INPUT,  [](const Sample &s) -> uint64_t { return s.clk_mon; }},
+            {"clk_pll",           1, FST_VD_INPUT,  [](const Sample &s) -> uint64_t { return s.clk_pll; }},
+            {"vdd_in",            1, FST_VD_INPUT,  [](const Sample &s) -> uint64_t { return s.vdd_in; }},
+            {"vref",              1, FST_VD_INPUT,  [](const Sample &s) -> uint64_t { return s.vref; }},
+            {"pll_lock",          1, FST_VD_INPUT,  [](const Sample &s) -> uint64_t { return s.pll_lock; }},
+            {"pll_fdco",          1, FST_VD_INPUT,  [](const Sample &s) -> uint64_t { return s.pll_fdco; }},
+            {"psel",              1, FST_VD_INPUT,  [](const Sample &s) -> uint64_t { return s.psel; }},
+            {"penable",           1, FST_VD_INPUT,  [](const Sample &s) -> uint64_t { return s.penable; }},
+            {"paddr",            20, FST_VD_INPUT,  [](const Sample &s) -> uint64_t { return s.paddr; }},
+            {"pwrite",            1, FST_VD_INPUT,  [](const Sample &s) -> uint64_t { return s.pwrite; }},
+            {"pwdata",           32, FST_VD_INPUT,  [](const Sample &s) -> uint64_t { return s.pwdata; }},
+            {"prdata",           32, FST_VD_OUTPUT, [](const Sample &s) -> uint64_t { return s.prdata; }},
+            {"pready",            1, FST_VD_OUTPUT, [](const Sample &s) -> uint64_t { return s.pready; }},
+            {"pslverr",           1, FST_VD_OUTPUT, [](const Sample &s) -> uint64_t { return s.pslverr; }},
+            {"mem_req",           1, FST_VD_INPUT,  [](const Sample &s) -> uint64_t { return s.mem_req; }},
+            {"mem_we",            1, FST_VD_INPUT,  [](const Sample &s) -> uint64_t { return s.mem_we; }},
+            {"mem_addr",         10, FST_VD_INPUT,  [](const Sample &s) -> uint64_t { return s.mem_addr; }},
+            {"mem_wdata",        64, FST_VD_INPUT,  [](const Sample &s) -> uint64_t { return s.mem_wdata; }},
+            {"mem_inject[71:64]", 8, FST_VD_INPUT,  [](const Sample &s) -> uint64_t { return s.mem_inject_hi; }},
+            {"mem_inject[63:0]", 64, FST_VD_INPUT,  [](const Sample &s) -> uint64_t { return s.mem_inject_lo; }},
+            {"mem_rvalid",        1, FST_VD_OUTPUT, [](const Sample &s) -> uint64_t { return s.mem_rvalid; }},
+            {"mem_rdata",        64, FST_VD_OUTPUT, [](const Sample &s) -> uint64_t { return s.mem_rdata; }},
+            {"fault_vdd",         1, FST_VD_OUTPUT, [](const Sample &s) -> uint64_t { return s.fault_vdd; }},
+            {"vdd_irq",           1, FST_VD_OUTPUT, [](const Sample &s) -> uint64_t { return s.vdd_irq; }},
+            {"fault_clk",         1, FST_VD_OUTPUT, [](const Sample &s) -> uint64_t { return s.fault_clk; }},
+            {"fault_pll_lol",     1, FST_VD_OUTPUT, [](const Sample &s) -> uint64_t { return s.fault_pll_lol; }},
+            {"fault_pll_osr",     1, FST_VD_OUTPUT, [](const Sample &s) -> uint64_t { return s.fault_pll_osr; }},
+            {"mem_fault_irq",     1, FST_VD_OUTPUT, [](const Sample &s) -> uint64_t { return s.mem_fault_irq; }},
+            {"sbe_irq",           1, FST_VD_OUTPUT, [](const Sample &s) -> uint64_t { return s.sbe_irq; }},
+            {"mbe_irq",           1, FST_VD_OUTPUT, [](const Sample &s) -> uint64_t { return s.mbe_irq; }},
+            {"safe_state_en",     1, FST_VD_OUTPUT, [](const Sample &s) -> uint64_t { return s.safe_state_en; }},
+            {"safe_state_sw",     1, FST_VD_OUTPUT, [](const Sample &s) -> uint64_t { return s.safe_state_sw; }},
+            {"supply_enable",     1, FST_VD_OUTPUT, [](const Sample &s) -> uint64_t { return s.supply_enable; }},
+            {"power_stage",       2, FST_VD_OUTPUT, [](const Sample &s) -> uint64_t { return s.power_stage; }},
+        };
+        static_assert(sizeof(table) / sizeof(table[0]) == kPortCount, "port table size");
+        return table;
+    }
+
+    static void read(const Top &dut, uint64_t cycle, Sample &s)
+    {
+        s.cycle = cycle;
+        s.mem_wdata = dut.mem_wdata;
+        s.mem_rdata = dut.mem_rdata;
+        s.mem_inject_lo = dut.mem_inject[0] | (static_cast<uint64_t>(dut.mem_inject[1]) << 32);
+        s.mem_inject_hi = static_cast<uint8_t>(dut.mem_inject[2]);
+        s.paddr = dut.paddr;
+        s.pwdata = dut.pwdata;
+        s.prdata = dut.prdata;
+        s.mem_addr = dut.mem_addr;
+        s.rst_n = dut.rst_n;
+        s.clk_mon = dut.clk_mon;
+        s.clk_pll = dut.clk_pll;
+        s.vdd_in = dut.vdd_in;
+        s.vref = dut.vref;
+        s.pll_lock = dut.pll_lock;
+        s.pll_fdco = dut.pll_fdco;
+        s.psel = dut.psel;
+        s.penable = dut.penable;
+        s.pwrite = dut.pwrite;
+        s.pready = dut.pready;
+        s.pslverr = dut.pslverr;
+        s.mem_req = dut.mem_req;
+        s.mem_we = dut.mem_we;
+        s.mem_rvalid = dut.mem_rvalid;
+        s.fault_vdd = dut.fault_vdd;
+        s.vdd_irq = dut.vdd_irq;
+        s.fault_clk = dut.fault_clk;
+        s.fault_pll_lol = dut.fault_pll_lol;
+        s.fault_pll_osr = dut.fault_pll_osr;
+        s.mem_fault_irq = dut.mem_fault_irq;
+        s.sbe_irq = dut.sbe_irq;
+        s.mbe_irq = dut.mbe_irq;
+        s.safe_state_en = dut.safe_state_en;
+        s.safe_state_sw = dut.safe_state_sw;
+        s.supply_enable = dut.supply_enable;
+        s.power_stage = dut.power_stage;
+    }
+
+    static uint8_t trigger_lines(const Sample &s)
+    {
+        return static_cast<uint8_t>((s.fault_vdd ? kTrigVdd : 0U) |
+                                    (s.fault_clk ? kTrigClk : 0U) |
+                                    (s.fault_pll_lol ? kTrigPllLol : 0U) |
+                                    (s.fault_pll_osr ? kTrigPllOsr : 0U) |
+                                    (s.mem_fault_irq ? kTrigMem : 0U));
+    }
+
+    static std::string trigger_names(uint8_t rises)
+    {
+        static const char *const names[] = {
+            "fault_vdd", "fault_clk", "fault_pll_lol", "fault_pll_osr", "mem_fault_irq",
+        };
+        std::string out;
+
+        for (unsigned i = 0; i < 5U; i++) {
+            if ((rises & (1U << i)) != 0U) {
+                out += out.empty() ? "" : ",";
+                out += names[i];
+            }
+        }
+        return out;
+    }
+
+    /** Start a file at the trigger and write the window leading up to it */
+    void open(const Sample &trigger, uint8_t rises)
+    {
+        std::string path = prefix_ + "_capture" + std::to_string(captures_) + ".fst";
+        std::string what = trigger_names(rises);
+
+        fst_ = fstWriterCreate(path.c_str(), 1);
+        if (fst_ == nullptr) {
+            std::fprintf(stderr, "fault capture: cannot create %s\n", path.c_str());
+            max_captures_ = captures_;
+            return;
+        }
+        fstWriterSetPackType(fst_, FST_WR_PT_LZ4);
+        fstWriterSetTimescale(fst_, -12);
+        fstWriterSetComment(fst_, (what + " rising at cycle " +
+                                   std::to_string(trigger.cycle)).c_str());
+
+        fstWriterSetScope(fst_, FST_ST_VCD_MODULE, "top_power_management_safety", nullptr);
+        clk_ = fstWriterCreateVar(fst_, FST_VT_VCD_WIRE, FST_VD_INPUT, 1, "clk", 0);
+        const Port *port = ports();
+        for (unsigned i = 0; i < kPortCount; i++) {
+            handles_[i] = fstWriterCreateVar(fst_, FST_VT_VCD_WIRE, port[i].dir,
+                                             port[i].width, port[i].name, 0);
+        }
+        fstWriterSetUpscope(fst_);
+
+        // Oldest sample first; the newest is the trigger cycle itself
+        first_ = true;
+        size_t oldest = (head_ + ring_.size() - count_) % ring_.size();
+        for (size_t n = 0; n < count_; n++) {
+            emit(ring_[(oldest + n) % ring_.size()]);
+        }
+
+        std::fprintf(stderr, "fault capture %u: %s at cycle %llu -> %s\n", captures_,
+                     what.c_str(), static_cast<unsigned long long>(trigger.cycle),
+                     path.c_str());
+        captures_++;
+        post_ = 0;
+        if (post_cycles_ == 0U) {
+            close();
+        }
+    }
+
+    void close()
+    {
+        if (fst_ != nullptr) {
+            fstWriterClose(fst_);
+            fst_ = nullptr;
+        }
+    }
+
+    /** One cycle: clk high with the changed ports, clk low half a period later */
+    void emit(const Sample &s)
+    {
+        const Port *port = ports();
+        uint64_t rise = (2U * s.cycle - 1U) * kHalfPeriodPs;
+        char bits[65];
+
+        fstWriterEmitTimeChange(fst_, rise);
+        fstWriterEmitValueChange(fst_, clk_, "1");
+        for (unsigned i = 0; i < kPortCount; i++) {
+            uint64_t v = port[i].get(s);
+            if (!first_ && v == last_[i]) {
+                continue;
+            }
+            for (uint32_t b = 0; b < port[i].width; b++) {
+                bits[b] = ((v >> (port[i].width - 1U - b)) & 1U) != 0U ? '1' : '0';
+            }
+            bits[port[i].width] = '\0';
+            fstWriterEmitValueChange(fst_, handles_[i], bits);
+            last_[i] = v;
+        }
+        first_ = false;
+        fstWriterEmitTimeChange(fst_, rise + kHalfPeriodPs);
+        fstWriterEmitValueChange(fst_, clk_, "0");
+    }
+
+    std::string prefix_;
+    std::vector<Sample> ring_;
+    size_t head_ = 0;
+    size_t count_ = 0;
+    uint8_t lines_ = 0;
+
+    uint32_t post_cycles_;
+    uint32_t max_captures_;
+    uint8_t triggers_;
+    uint32_t captures_ = 0;
+    uint32_t post_ = 0;
+
+    void *fst_ = nullptr;
+    fstHandle clk_ = 0;
+    fstHandle handles_[kPortCount] = {};
+    uint64_t last_[kPortCount] = {};
+    bool first_ = true;
+};
+
+}  // namespace rtl
+
+#endif /* FAULT_CAPTURE_H */
@@ -0,0 +1,259 @@
+/**
+ * @file fault_regression.cpp
+ * @brief Fault regression of top_power_management_safety
+ *
+ * Injects every recoverable fault of the top level in turn, rounds times,
+ * and checks that each one is detected on its own fault output, raises no
+ * other fault and clears once the stimulus is removed:
+ *
+ *  - vdd:     VDD below the reference until fault_vdd, then restored
+ *             (comparator filter: ~4.5k cycles to set, ~3k to clear)
+ *  - clk:     clk_mon stopped until fault_clk, then restarted (fault_clk
+ *             clears on the second clk_mon edge)
+ *  - pll_lol: pll_lock dropped until fault_pll_lol, then restored
+ *  - pll_osr: clk_pll stopped until fault_pll_osr (1μs window), then
+ *             restarted
+ *  - ecc_sbe: one word read back with one data bit flipped -> mem_fault_irq
+ *  - ecc_mbe: the same with two data bits flipped
+ *
+ * Every fault is followed by kQuietCycles with all fault outputs low. The
+ * run time is dominated by the model itself, which makes the regression
+ * the reference workload for comparing Verilator build profiles
+ * (rtl_profile_bench).
+ *
+ * Usage: rtl_fault_regression [rounds] [+capture...]   (default 20)
+ * Output: JSON on stdout, exit code 0 if every fault passed. With +capture
+ * (see top_bench.h) the first faults are captured to
+ * rtl_fault_regression_capture<n>.fst.
+ *
+ * Feature: 001-Power-Management-Safety
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+#include "top_bench.h"
+
+namespace {
+
+using rtl::Top;
+using rtl::TopBench;
+
+constexpr uint32_t kDefaultRounds = 20;
+constexpr uint64_t kWarmupCycles  = 4000;      // Sequencer ramp, first PLL windows
+constexpr uint64_t kQuietCycles   = 500;       // All outputs low between faults
+
+constexpr uint32_t kEccCtrl       = rtl::kEccBase + 0x00;
+constexpr uint32_t kEccCtrlEnable = 0x07;      // ECC, SBE IRQ, MBE IRQ enable
+
+constexpr uint32_t kEccWord       = 5;
+
+// Fault outputs, one bit each
+constexpr uint8_t kLineVdd    = 1U << 0;
+constexpr uint8_t kLineClk    = 1U << 1;
+constexpr uint8_t kLinePllLol = 1U << 2;
+constexpr uint8_t kLinePllOsr = 1U << 3;
+constexpr uint8_t kLineMem    = 1U << 4;
+
+class Regression;
+
+struct Fault {
+    const char *name;
+    uint8_t line;              // Output that must rise
+    uint64_t detect_cycles;    // Inject -> line rises
+    uint64_t clear_cycles;     // Release -> all lines low
+    void (*inject)(Regression &);
+    void (*release)(Regression &);
+};
+
+class Regression {
+public:
+    explicit Regression(TopBench &tb) : tb_(tb), dut_(tb.dut()) {}
+
+    TopBench &tb() { return tb_; }
+    Top *dut() { return dut_; }
+
+    uint8_t lines() const
+    {
+        return static_cast<uint8_t>((dut_->fault_vdd ? kLineVdd : 0U) |
+                                    (dut_->fault_clk ? kLineClk : 0U) |
+                                    (dut_->fault_pll_lol ? kLinePllLol : 0U) |
+                                    (dut_->fault_pll_osr ? kLinePllOsr : 0U) |
+                                    (dut_->mem_fault_irq ? kLineMem : 0U));
+    }
+
+    /** One cycle, recording rising fault outputs */
+    void step()
+    {
+        tb_.tick();
+        uint8_t now = lines();
+        rises_ |= static_cast<uint8_t>(now & ~prev_);
+        prev_ = now;
+    }
+
+    /** Write over APB, counting failed transfers */
+    void apb_write(uint32_t addr, uint32_t value)
+    {
+        apb_errors_ += tb_.apb_write(addr, value) ? 0U : 1U;
+        uint8_t now = lines();
+        rises_ |= static_cast<uint8_t>(now & ~prev_);
+        prev_ = now;
+    }
+
+    /** One memory access; @p flips are applied to the word read */
+    void mem_access(bool write, uint64_t wdata, uint32_t flips)
+    {
+        dut_->mem_req = 1;
+        dut_->mem_we = write ? 1 : 0;
+        dut_->mem_addr = kEccWord;
+        dut_->mem_wdata = wdata;
+        dut_->mem_inject[0] = flips;
+        step();
+        dut_->mem_req = 0;
+        dut_->mem_we = 0;
+        dut_->mem_inject[0] = 0;
+    }
+
+    /** Inject, release and settle one fault; true if it behaved */
+    bool run(const Fault &f)
+    {
+        uint64_t start;
+
+        rises_ = 0;
+        f.inject(*this);
+        start = tb_.cycle();
+        while ((rises_ & f.line) == 0U && tb_.cycle() - start < f.detect_cycles) {
+            step();
+        }
+
+        f.release(*this);
+        start = tb_.cycle();
+        while (lines() != 0U && tb_.cycle() - start < f.clear_cycles) {
+            step();
+        }
+        bool cleared = lines() == 0U;
+
+        for (uint64_t n = 0; n < kQuietCycles; n++) {
+            step();
+        }
+
+        bool detected = (rises_ & f.line) != 0U;
+        bool spurious = (rises_ & ~f.line) != 0U;
+        spurious_ += spurious ? 1U : 0U;
+        return detected && cleared && !spurious && lines() == 0U;
+    }
+
+    uint32_t spurious() const { return spurious_; }
+    uint32_t apb_errors() const { return apb_errors_; }
+
+private:
+    TopBench &tb_;
+    Top *dut_;
+    uint8_t prev_ = 0;
+    uint8_t rises_ = 0;
+    uint32_t spurious_ = 0;
+    uint32_t apb_errors_ = 0;
+};
+
+const Fault kFaults[] = {
+    {"vdd", kLineVdd, 20000, 20000,
+     [](Regression &r) { r.dut()->vdd_in = 0; r.dut()->vref = 1; },
+     [](Regression &r) { r.dut()->vdd_in = 1; r.dut()->vref = 0; }},
+    {"clk", kLineClk, 2000, 100,
+     [](Regression &r) { r.tb().set_clk_mon(false); },
+     [](Regression &r) { r.tb().set_clk_mon(true); }},
+    {"pll_lol", kLinePllLol, 16, 16,
+     [](Regression &r) { r.dut()->pll_lock = 0; },
+     [](Regression &r) { r.dut()->pll_lock = 1; }},
+    {"pll_osr", kLinePllOsr, 1000, 1000,
+     [](Regression &r) { r.tb().set_clk_pll(false); },
+     [](Regression &r) { r.tb().set_clk_pll(true); }},
+    {"ecc_sbe", kLineMem, 16, 16,
+     [](Regression &r) {
+         r.mem_access(true, 0x0123456789ABCDEFULL, 0U);
+         r.mem_access(false, 0U, 1U << 17);                 // Data bit 17
+     },
+     [](Regression &) {}},
+    {"ecc_mbe", kLineMem, 16, 16,
+     [](Regression &r) {
+         r.mem_access(true, 0x0123456789ABCDEFULL, 0U);
+         r.mem_access(false, 0U, (1U << 3) | (1U << 17));   // Data bits 3, 17
+     },
+     [](Regression &) {}},
+};
+
+constexpr unsigned kFaultCount = sizeof(kFaults) / sizeof(kFaults[0]);
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    uint32_t rounds = kDefaultRounds;
+    uint32_t passed[kFaultCount] = {};
+    uint32_t injected = 0, failed = 0;
+
+    if (argc > 1 && argv[1][0] != '+') {
+        rounds = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 0));
+    }
+
+    auto ctx = std::make_unique<VerilatedContext>();
+    ctx->commandArgs(argc, argv);
+
+    TopBench tb(ctx.get(), "rtl_fault_regression");
+    Regression reg(tb);
+
+    tb.reset();
+    for (uint64_t n = 0; n < kWarmupCycles; n++) {
+        tb.tick();
+    }
+    reg.apb_write(kEccCtrl, kEccCtrlEnable);
+    bool quiet = reg.lines() == 0U;
+
+    uint64_t start_cycle = tb.cycle();
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t round = 0; round < rounds; round++) {
+        for (unsigned i = 0; i < kFaultCount; i++) {
+            injected++;
+            if (reg.run(kFaults[i])) {
+                passed[i]++;
+            } else {
+                failed++;
+                if (failed <= 10U) {
+                    std::fprintf(stderr, "round %u: %s failed at cycle %llu\n", round,
+                                 kFaults[i].name, static_cast<unsigned long long>(tb.cycle()));
+                }
+            }
+        }
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    double seconds = elapsed.count();
+    uint64_t cycles = tb.cycle() - start_cycle;
+    bool ok = quiet && failed == 0U && reg.apb_errors() == 0U;
+
+    std::printf("{\n");
+    std::printf("  \"profile\": \"%s\",\n", RTL_SIM_PROFILE);
+    std::printf("  \"threads\": %u,\n", ctx->threads());
+    std::printf("  \"rounds\": %u,\n", rounds);
+    std::printf("  \"cycles\": %llu,\n", static_cast<unsigned long long>(cycles));
+    std::printf("  \"seconds\": %.3f,\n", seconds);
+    std::printf("  \"cycles_per_second\": %.0f,\n",
+                seconds > 0.0 ? double(cycles) / seconds : 0.0);
+    std::printf("  \"faults_injected\": %u,\n", injected);
+    std::printf("  \"passed\": {");
+    for (unsigned i = 0; i < kFaultCount; i++) {
+        std::printf("%s\"%s\": %u", i == 0U ? "" : ", ", kFaults[i].name, passed[i]);
+    }
+    std::printf("},\n");
+    std::printf("  \"spurious\": %u,\n", reg.spurious());
+    std::printf("  \"apb_errors\": %u,\n", reg.apb_errors());
+    std::printf("  \"captures\": %u,\n", tb.captures());
+    std::printf("  \"result\": \"%s\"\n", ok ? "PASSED" : "FAILED");
+    std::printf("}\n");
+
+    return ok ? 0 : 1;
+}
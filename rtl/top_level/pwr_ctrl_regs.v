@@ -0,0 +1,130 @@
+/**
+ * @file pwr_ctrl_regs.v
+ * @brief Power Control APB Register Block (0x4001_0000)
+ *
+ * Firmware view of the VDD comparator, VDD monitor and supply sequencer.
+ * Register offsets and bits follow firmware hal/power_api.c.
+ *
+ * Registers:
+ *  - 0x00 POWER_STATUS (RO)
+ *      [0] OK (supplies stable, no VDD fault)   [1] VDD_LOW (fault_vdd)
+ *      [2] BROWNOUT (unfiltered comparator)      [3] SAFE_STATE (sequencer)
+ *      [7:4] sequencer state  [10:8] VDD monitor state  [31:16] VDD faults
+ *  - 0x04 POWER_CONTROL
+ *      [0] SHUTDOWN_REQ (level)   [3] RECOVERY_REQ (write 1: one-cycle
+ *      external_recovery pulse to the VDD monitor, reads 0)
+ *  - 0x08 POWER_MODE [7:0] (0x00 NORMAL, 0x01 SAFE_STATE, 0xFF SHUTDOWN);
+ *      SAFE_STATE drives sw_safe_state
+ *  - 0x0C POWER_INT_MASK [0] VDD_FAULT: gates fault_vdd onto vdd_irq
+ *  - 0x10 / 0x14 / 0x18 SEQ_DELAY1..3 [15:0]: sequencer stage delays
+ *
+ * Zero wait states; pslverr on offsets outside the block.
+ */
+
+`timescale 1ns / 1ps
+
+module pwr_ctrl_regs #(
+    parameter [15:0] SEQ_DELAY_RESET = 16'd400  // 1μs per stage @ 400MHz
+) (
+    input  logic        clk,
+    input  logic        reset_n,
+
+    // APB slave
+    input  logic        psel,
+    input  logic        penable,
+    input  logic [11:0] paddr,
+    input  logic        pwrite,
+    input  logic [31:0] pwdata,
+    output logic [31:0] prdata,
+    output logic        pready,
+    output logic        pslverr,
+
+    // Status from the power monitor blocks
+    input  logic        fault_vdd,
+    input  logic        fault_vdd_raw,
+    input  logic        safe_state_en,
+    input  logic        supply_stable,
+    input  logic [3:0]  seq_state,
+    input  logic [2:0]  vdd_state,
+    input  logic [15:0] vdd_fault_count,
+
+    // Control to the power monitor blocks
+    output logic        sys_shutdown_req,
+    output logic        external_recovery,
+    output logic        sw_safe_state,
+    output logic [15:0] delay_stage1,
+    output logic [15:0] delay_stage2,
+    output logic [15:0] delay_stage3,
+    output logic        vdd_irq
+);
+
+    logic [7:0] power_mode;
+    logic       int_mask_vdd;
+    logic       wr, rd, known;
+
+    assign wr = psel & penable & pwrite;
+    assign rd = psel & penable & ~pwrite;
+
+    // ========================================================================
+    // Writes
+    // ========================================================================
+
+    always_ff @(posedge clk or negedge reset_n) begin
+        if (~reset_n) begin
+            sys_shutdown_req <= 1'b0;
+            external_recovery <= 1'b0;
+            power_mode <= 8'h00;
+            int_mask_vdd <= 1'b0;
+            delay_stage1 <= SEQ_DELAY_RESET;
+            delay_stage2 <= SEQ_DELAY_RESET;
+            delay_stage3 <= SEQ_DELAY_RESET;
+        end else begin
+            external_recovery <= 1'b0;              // Pulse
+            if (wr) begin
+                case (paddr)
+                    12'h004: begin
+                        sys_shutdown_req <= pwdata[0];
+                        external_recovery <= pwdata[3];
+                    end
+                    12'h008: power_mode <= pwdata[7:0];
+                    12'h00C: int_mask_vdd <= pwdata[0];
+                    12'h010: delay_stage1 <= pwdata[15:0];
+                    12'h014: delay_stage2 <= pwdata[15:0];
+                    12'h018: delay_stage3 <= pwdata[15:0];
+                    default: begin end
+                endcase
+            end
+        end
+    end
+
+    assign sw_safe_state = (power_mode == 8'h01);
+    assign vdd_irq = fault_vdd & int_mask_vdd;
+
+    // ========================================================================
+    // Reads
+    // ========================================================================
+
+    always_comb begin
+        prdata = 32'h0000_0000;
+        known = 1'b1;
+        case (paddr)
+            12'h000: prdata = {vdd_fault_count, 5'h00, vdd_state, seq_state,
+                               safe_state_en, fault_vdd_raw, fault_vdd,
+                               supply_stable & ~fault_vdd};
+            12'h004: prdata = {31'h0, sys_shutdown_req};
+            12'h008: prdata = {24'h0, power_mode};
+            12'h00C: prdata = {31'h0, int_mask_vdd};
+            12'h010: prdata = {16'h0, delay_stage1};
+            12'h014: prdata = {16'h0, delay_stage2};
+            12'h018: prdata = {16'h0, delay_stage3};
+            default: known = 1'b0;
+        endcase
+        if (~rd) begin
+            prdata = 32'h0000_0000;
+        end
+    end
+
+    assign pready = psel & penable;
+    assign pslverr = psel & penable & ~known;
+
+endmodule
@@ -0,0 +1,137 @@
+/**
+ * @file sim_main.cpp
+ * @brief Verilator simulation driver for top_power_management_safety
+ *
+ * Runs the top level under a steady mixed workload and reports the
+ * simulation speed in simulated 400MHz cycles per wall-clock second. The
+ * same driver is built once per Verilator --threads count (rtl_sim_t1,
+ * rtl_sim_t2, ...), so the numbers compare model threading only.
+ *
+ * Workload per cycle:
+ *  - clk 400MHz, clk_pll 400MHz (in range), clk_mon 100MHz (watchdog)
+ *  - One ECC memory access (write / read-back), an SBE injected on every
+ *    kSbePeriod-th read
+ *  - One APB status read (clock / power) every kApbPeriod cycles
+ *  - VDD nominal
+ *
+ * After warm-up no fault output may assert, every injected SBE must raise
+ * exactly one mem_fault_irq and every APB read must complete without
+ * pslverr; the exit code reports this, so the driver doubles as a
+ * top-level smoke test.
+ *
+ * Usage: rtl_sim [cycles] [+capture...]   (default 10000000)
+ * Output: JSON on stdout. With +capture (see top_bench.h) each rising
+ * fault output is captured to rtl_sim_capture<n>.fst; in this workload that
+ * is every injected SBE unless +capture_mask excludes mem_fault_irq.
+ *
+ * Feature: 001-Power-Management-Safety
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+#include "top_bench.h"
+
+namespace {
+
+constexpr uint64_t kDefaultCycles = 10000000;  // 25ms @ 400MHz
+constexpr uint64_t kWarmupCycles  = 4000;      // Sequencer ramp, first PLL windows
+constexpr uint32_t kSbePeriod     = 1000;      // Reads between injected SBEs
+constexpr uint32_t kApbPeriod     = 64;
+constexpr uint32_t kMemWords      = 1024;
+
+constexpr uint32_t kEccCtrlEnable = 0x07;      // ECC, SBE IRQ, MBE IRQ enable
+
+using rtl::kClkBase;
+using rtl::kEccBase;
+using rtl::kPwrBase;
+using rtl::Top;
+using rtl::TopBench;
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    uint64_t cycles = kDefaultCycles;
+    uint64_t sbe_injected = 0, irq_pulses = 0, fault_cycles = 0;
+    uint64_t apb_reads = 0, apb_errors = 0;
+    uint32_t reads = 0;
+
+    if (argc > 1 && argv[1][0] != '+') {
+        cycles = std::strtoull(argv[1], nullptr, 0);
+    }
+
+    auto ctx = std::make_unique<VerilatedContext>();
+    ctx->commandArgs(argc, argv);
+
+    TopBench tb(ctx.get(), "rtl_sim");
+    Top *dut = tb.dut();
+
+    tb.reset();
+    tb.apb_write(kEccBase + 0x00, kEccCtrlEnable);
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint64_t n = 0; n < cycles; n++) {
+        uint32_t word = static_cast<uint32_t>(n >> 1) % kMemWords;
+        bool read = (n & 1U) != 0U;
+        bool inject = read && (++reads % kSbePeriod) == 0U;
+        uint32_t apb_phase = static_cast<uint32_t>(n % kApbPeriod);
+
+        // Memory: write a word, read it back next cycle
+        dut->mem_req = 1;
+        dut->mem_we = read ? 0 : 1;
+        dut->mem_addr = word;
+        dut->mem_wdata = 0x0123456789ABCDEFULL ^ word;
+        dut->mem_inject[0] = inject ? (1U << 17) : 0U;   // Data bit 17
+        sbe_injected += inject ? 1U : 0U;
+
+        // APB: alternate clock and power status reads (setup, access)
+        if (apb_phase == 0U) {
+            dut->psel = 1;
+            dut->penable = 0;
+            dut->pwrite = 0;
+            dut->paddr = ((n / kApbPeriod) & 1U) ? (kPwrBase + 0x00) : (kClkBase + 0x0C);
+        } else if (apb_phase == 1U) {
+            dut->penable = 1;
+            dut->eval();
+            apb_reads++;
+            apb_errors += (dut->pready && !dut->pslverr) ? 0U : 1U;
+        } else {
+            dut->psel = 0;
+            dut->penable = 0;
+        }
+
+        tb.tick();
+
+        irq_pulses += dut->mem_fault_irq;
+        if (tb.cycle() > kWarmupCycles &&
+            (dut->fault_vdd | dut->fault_clk | dut->fault_pll_lol | dut->fault_pll_osr)) {
+            fault_cycles++;
+        }
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    double seconds = elapsed.count();
+    bool ok = (irq_pulses == sbe_injected) && (fault_cycles == 0U) && (apb_errors == 0U);
+
+    std::printf("{\n");
+    std::printf("  \"profile\": \"%s\",\n", RTL_SIM_PROFILE);
+    std::printf("  \"threads\": %u,\n", ctx->threads());
+    std::printf("  \"cycles\": %llu,\n", static_cast<unsigned long long>(cycles));
+    std::printf("  \"seconds\": %.3f,\n", seconds);
+    std::printf("  \"cycles_per_second\": %.0f,\n",
+                seconds > 0.0 ? double(cycles) / seconds : 0.0);
+    std::printf("  \"sbe_injected\": %llu,\n", static_cast<unsigned long long>(sbe_injected));
+    std::printf("  \"mem_fault_irq\": %llu,\n", static_cast<unsigned long long>(irq_pulses));
+    std::printf("  \"fault_cycles\": %llu,\n", static_cast<unsigned long long>(fault_cycles));
+    std::printf("  \"apb_reads\": %llu,\n", static_cast<unsigned long long>(apb_reads));
+    std::printf("  \"captures\": %u,\n", tb.captures());
+    std::printf("  \"result\": \"%s\"\n", ok ? "PASSED" : "FAILED");
+    std::printf("}\n");
+
+    return ok ? 0 : 1;
+}
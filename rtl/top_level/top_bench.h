@@ -0,0 +1,216 @@
+/**
+ * @file top_bench.h
+ * @brief Verilator bench for top_power_management_safety
+ *
+ * Clocking, reset and APB access shared by the rtl/ simulation drivers
+ * (sim_main.cpp, fault_regression.cpp):
+ *  - tick(): one 400MHz cycle of clk. clk_pll follows clk (400MHz, in
+ *    range) and clk_mon runs at a quarter of it; either can be stopped to
+ *    inject a clock fault.
+ *  - APB: zero-wait-state transfers (setup, access) on the slave port,
+ *    addresses are peripheral window offsets.
+ *
+ * The model's build profile (RTL_SIM_PROFILE, rtl/verilator_*.cfg) decides
+ * what the bench records: a model built with --trace-fst dumps every cycle
+ * to <name>.fst, one built with --coverage writes coverage_<name>.dat when
+ * the bench is destroyed. The fast profile has neither.
+ *
+ * Fault-triggered capture (fault_capture.h, any profile) is switched on
+ * from the simulation command line; any +capture option enables it:
+ *  - +capture                 defaults below
+ *  - +capture_pre+<cycles>    window before the trigger (4000 = 10μs)
+ *  - +capture_post+<cycles>   cycles after the trigger (4000)
+ *  - +capture_max+<n>         files written at most (8)
+ *  - +capture_mask+<bits>     triggers: 1 fault_vdd, 2 fault_clk,
+ *                             4 fault_pll_lol, 8 fault_pll_osr,
+ *                             0x10 mem_fault_irq (0x1F)
+ *
+ * Feature: 001-Power-Management-Safety
+ */
+
+#ifndef TOP_BENCH_H
+#define TOP_BENCH_H
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#include "Vtop_power_management_safety.h"
+#include "fault_capture.h"
+#include "verilated.h"
+#if VM_TRACE
+#include "verilated_fst_c.h"
+#endif
+
+#ifndef RTL_SIM_PROFILE
+#define RTL_SIM_PROFILE "unknown"
+#endif
+
+namespace rtl {
+
+constexpr uint32_t kPwrBase = 0x10000;          // Peripheral window offsets
+constexpr uint32_t kEccBase = 0x11000;
+constexpr uint32_t kClkBase = 0x12000;
+
+constexpr uint32_t kCapturePreCycles  = 4000;
+constexpr uint32_t kCapturePostCycles = 4000;
+constexpr uint32_t kCaptureMax        = 8;
+
+class TopBench {
+public:
+    TopBench(VerilatedContext *ctx, const char *name)
+        : ctx_(ctx), name_(name), dut_(make_top(ctx))
+    {
+#if VM_TRACE
+        trace_.reset(new VerilatedFstC);
+        dut_->trace(trace_.get(), 99);
+        trace_->open((name_ + ".fst").c_str());
+#endif
+        capture_from_args();
+    }
+
+    ~TopBench()
+    {
+        capture_.reset();
+        dut_->final();
+#if VM_TRACE
+        trace_->close();
+#endif
+#if VM_COVERAGE
+        ctx_->coveragep()->write(("coverage_" + name_ + ".dat").c_str());
+#endif
+    }
+
+    Top *dut() { return dut_.get(); }
+    uint64_t cycle() const { return cycle_; }
+
+    /** Fault-triggered FST files written so far */
+    uint32_t captures() const { return capture_ ? capture_->captures() : 0U; }
+
+    /** Reset with nominal inputs: VDD good, PLL locked, clocks running */
+    void reset()
+    {
+        dut_->clk = 0;
+        dut_->clk_mon = 0;
+        dut_->clk_pll = 0;
+        dut_->rst_n = 0;
+        dut_->vdd_in = 1;     // Above the comparator threshold
+        dut_->vref = 0;
+        dut_->pll_lock = 1;
+        dut_->pll_fdco = 0;
+        dut_->psel = 0;
+        dut_->penable = 0;
+        dut_->pwrite = 0;
+        dut_->mem_req = 0;
+        dut_->mem_we = 0;
+        dut_->mem_inject[0] = 0;
+        dut_->mem_inject[1] = 0;
+        dut_->mem_inject[2] = 0;
+        tick();
+        tick();
+        dut_->rst_n = 1;
+        tick();
+    }
+
+    /** Start / stop the supervised clock (clk_mon = clk / 4) */
+    void set_clk_mon(bool running) { clk_mon_running_ = running; }
+
+    /** Start / stop the PLL output (clk_pll = clk) */
+    void set_clk_pll(bool running) { clk_pll_running_ = running; }
+
+    /** One 400MHz cycle */
+    void tick()
+    {
+        dut_->clk = 0;
+        if (clk_pll_running_) {
+            dut_->clk_pll = 0;
+        }
+        dut_->eval();
+#if VM_TRACE
+        trace_->dump(2 * cycle_ * kHalfPeriodPs);
+#endif
+        dut_->clk = 1;
+        if (clk_pll_running_) {
+            dut_->clk_pll = 1;
+        }
+        if (clk_mon_running_ && (cycle_ & 1U) == 0U) {
+            dut_->clk_mon = !dut_->clk_mon;
+        }
+        dut_->eval();
+#if VM_TRACE
+        trace_->dump((2 * cycle_ + 1) * kHalfPeriodPs);
+#endif
+        cycle_++;
+        if (capture_) {
+            capture_->sample(*dut_, cycle_);
+        }
+    }
+
+    /** APB write; false on pslverr */
+    bool apb_write(uint32_t addr, uint32_t value)
+    {
+        dut_->psel = 1;
+        dut_->penable = 0;
+        dut_->pwrite = 1;
+        dut_->paddr = addr;
+        dut_->pwdata = value;
+        tick();
+        dut_->penable = 1;
+        dut_->eval();
+        bool ok = dut_->pready && !dut_->pslverr;
+        tick();
+        dut_->psel = 0;
+        dut_->penable = 0;
+        dut_->pwrite = 0;
+        return ok;
+    }
+
+private:
+    /** Tracing has to be switched on before the model is built */
+    static Top *make_top(VerilatedContext *ctx)
+    {
+#if VM_TRACE
+        ctx->traceEverOn(true);
+#endif
+        return new Top{ctx};
+    }
+
+    /** Value of +<option>+<n>, or @p fallback */
+    uint32_t plusarg(const char *option, uint32_t fallback)
+    {
+        std::string prefix = std::string(option) + "+";
+        const char *arg = ctx_->commandArgsPlusMatch(prefix.c_str());
+
+        if (arg[0] == '\0') {
+            return fallback;
+        }
+        return static_cast<uint32_t>(std::strtoul(arg + 1 + prefix.size(), nullptr, 0));
+    }
+
+    void capture_from_args()
+    {
+        if (ctx_->commandArgsPlusMatch("capture")[0] == '\0') {
+            return;
+        }
+        capture_.reset(new FaultCapture(
+            name_, plusarg("capture_pre", kCapturePreCycles),
+            plusarg("capture_post", kCapturePostCycles), plusarg("capture_max", kCaptureMax),
+            static_cast<uint8_t>(plusarg("capture_mask", FaultCapture::kTrigAll))));
+    }
+
+    VerilatedContext *ctx_;
+    std::string name_;
+    std::unique_ptr<Top> dut_;
+#if VM_TRACE
+    std::unique_ptr<VerilatedFstC> trace_;
+#endif
+    std::unique_ptr<FaultCapture> capture_;
+    uint64_t cycle_ = 0;
+    bool clk_mon_running_ = true;
+    bool clk_pll_running_ = true;
+};
+
+}  // namespace rtl
+
+#endif /* TOP_BENCH_H */
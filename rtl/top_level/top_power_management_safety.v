@@ -0,0 +1,303 @@
+/**
+ * @file top_power_management_safety.v
+ * @brief Power Management Safety Top Level (Verilator simulation top)
+ *
+ * Integrates the three safety monitors behind one APB3 slave port:
+ *  - Power: comparator -> vdd_monitor -> supply_sequencer
+ *  - Clock: clock_watchdog, pll_monitor
+ *  - Memory: ecc_memory (ecc_encoder, SRAM, ecc_decoder) -> ecc_controller
+ *
+ * APB address map (offsets in the 1 MB peripheral window at 0x4000_0000,
+ * see apb_fabric.v):
+ *  - 0x1_0000 Power control    (pwr_ctrl_regs.v)
+ *  - 0x1_1000 ECC controller   (ecc_controller.v, 8 registers)
+ *  - 0x1_2000 Clock monitor    (clk_ctrl_regs.v)
+ *
+ * Interrupt and fault outputs are levels, one per firmware ISR:
+ *  - fault_vdd / vdd_irq (masked by POWER_INT_MASK) -> VDD fault ISR
+ *  - fault_clk, fault_pll_lol, fault_pll_osr        -> clock fault ISR
+ *  - mem_fault_irq (coalesced per ECC IRQ_COAL)     -> ECC fault ISR
+ *
+ * All logic runs on clk (400MHz) except the PLL edge counter (clk_pll).
+ * clk_mon is the clock under watchdog supervision and must be slower
+ * than clk / 2.
+ */
+
+`timescale 1ns / 1ps
+
+module top_power_management_safety #(
+    parameter MEM_WORDS = 1024
+) (
+    // Clocks and reset
+    input  logic        clk,            // 400MHz system / reference clock
+    input  logic        rst_n,          // Async reset (active-low)
+    input  logic        clk_mon,        // Supervised clock (watchdog)
+    input  logic        clk_pll,        // PLL output (frequency monitor)
+
+    // Analog front end and PLL status (testbench driven)
+    input  logic        vdd_in,         // Divided VDD (comparator +)
+    input  logic        vref,           // Reference (comparator -)
+    input  logic        pll_lock,
+    input  logic        pll_fdco,
+
+    // APB3 slave (peripheral window offset)
+    input  logic        psel,
+    input  logic        penable,
+    input  logic [19:0] paddr,
+    input  logic        pwrite,
+    input  logic [31:0] pwdata,
+    output logic [31:0] prdata,
+    output logic        pready,
+    output logic        pslverr,
+
+    // ECC-protected memory port
+    input  logic        mem_req,
+    input  logic        mem_we,
+    input  logic [$clog2(MEM_WORDS)-1:0] mem_addr,
+    input  logic [63:0] mem_wdata,
+    input  logic [71:0] mem_inject,     // Bit flips applied on read
+    output logic        mem_rvalid,
+    output logic [63:0] mem_rdata,
+
+    // Faults and interrupts
+    output logic        fault_vdd,
+    output logic        vdd_irq,
+    output logic        fault_clk,
+    output logic        fault_pll_lol,
+    output logic        fault_pll_osr,
+    output logic        mem_fault_irq,
+    output logic        sbe_irq,
+    output logic        mbe_irq,
+
+    // Power sequencing
+    output logic        safe_state_en,
+    output logic        safe_state_sw,  // Firmware request (POWER_MODE)
+    output logic        supply_enable,
+    output logic [1:0]  power_stage
+);
+
+    localparam NUM_SLAVES = 3;
+    localparam SLV_PWR = 0;
+    localparam SLV_ECC = 1;
+    localparam SLV_CLK = 2;
+
+    // ========================================================================
+    // APB Fabric
+    // ========================================================================
+
+    logic [NUM_SLAVES-1:0]    s_psel;
+    logic                     s_penable, s_pwrite;
+    logic [11:0]              s_paddr;
+    logic [31:0]              s_pwdata;
+    logic [NUM_SLAVES*32-1:0] s_prdata;
+    logic [NUM_SLAVES-1:0]    s_pready, s_pslverr;
+
+    apb_fabric #(
+        .NUM_SLAVES (NUM_SLAVES),
+        .BASE_PAGE  (8'h10)
+    ) u_apb_fabric (
+        .psel      (psel),
+        .penable   (penable),
+        .paddr     (paddr),
+        .pwrite    (pwrite),
+        .pwdata    (pwdata),
+        .prdata    (prdata),
+        .pready    (pready),
+        .pslverr   (pslverr),
+        .s_psel    (s_psel),
+        .s_penable (s_penable),
+        .s_paddr   (s_paddr),
+        .s_pwrite  (s_pwrite),
+        .s_pwdata  (s_pwdata),
+        .s_prdata  (s_prdata),
+        .s_pready  (s_pready),
+        .s_pslverr (s_pslverr)
+    );
+
+    // ========================================================================
+    // Power Monitoring
+    // ========================================================================
+
+    logic        cmp_fault, cmp_fault_raw;
+    logic        vdd_recovery_ready;
+    logic [2:0]  vdd_state;
+    logic [15:0] vdd_fault_count;
+    logic        seq_safe_state, supply_stable;
+    logic [3:0]  seq_state;
+    logic        sys_shutdown_req, external_recovery, sw_safe_state;
+    logic [15:0] delay_stage1, delay_stage2, delay_stage3;
+
+    comparator u_comparator (
+        .clk              (clk),
+        .reset_n          (rst_n),
+        .vdd_in           (vdd_in),
+        .vref             (vref),
+        .fault_vdd        (cmp_fault),
+        .fault_vdd_raw    (cmp_fault_raw),
+        .filter_state     (),
+        .hysteresis_upper (),
+        .hysteresis_lower ()
+    );
+
+    vdd_monitor u_vdd_monitor (
+        .clk               (clk),
+        .reset_n           (rst_n),
+        .comparator_out    (cmp_fault),
+        .external_recovery (external_recovery),
+        .fault_vdd         (fault_vdd),
+        .recovery_ready    (vdd_recovery_ready),
+        .fsm_state         (vdd_state),
+        .fault_counter     (vdd_fault_count)
+    );
+
+    supply_sequencer u_supply_sequencer (
+        .clk              (clk),
+        .reset_n          (rst_n),
+        .vdd_fault        (fault_vdd),
+        .sys_shutdown_req (sys_shutdown_req),
+        .delay_stage1     (delay_stage1),
+        .delay_stage2     (delay_stage2),
+        .delay_stage3     (delay_stage3),
+        .safe_state_en    (seq_safe_state),
+        .supply_enable    (supply_enable),
+        .power_stage      (power_stage),
+        .fsm_state        (seq_state),
+        .supply_stable    (supply_stable)
+    );
+
+    pwr_ctrl_regs u_pwr_regs (
+        .clk               (clk),
+        .reset_n           (rst_n),
+        .psel              (s_psel[SLV_PWR]),
+        .penable           (s_penable),
+        .paddr             (s_paddr),
+        .pwrite            (s_pwrite),
+        .pwdata            (s_pwdata),
+        .prdata            (s_prdata[SLV_PWR*32 +: 32]),
+        .pready            (s_pready[SLV_PWR]),
+        .pslverr           (s_pslverr[SLV_PWR]),
+        .fault_vdd         (fault_vdd),
+        .fault_vdd_raw     (cmp_fault_raw),
+        .safe_state_en     (seq_safe_state),
+        .supply_stable     (supply_stable),
+        .seq_state         (seq_state),
+        .vdd_state         (vdd_state),
+        .vdd_fault_count   (vdd_fault_count),
+        .sys_shutdown_req  (sys_shutdown_req),
+        .external_recovery (external_recovery),
+        .sw_safe_state     (sw_safe_state),
+        .delay_stage1      (delay_stage1),
+        .delay_stage2      (delay_stage2),
+        .delay_stage3      (delay_stage3),
+        .vdd_irq           (vdd_irq)
+    );
+
+    // Safe state: hardware (sequencer on a VDD fault) or firmware (POWER_MODE)
+    assign safe_state_en = seq_safe_state | sw_safe_state;
+    assign safe_state_sw = sw_safe_state;
+
+    // ========================================================================
+    // Clock Monitoring
+    // ========================================================================
+
+    logic        wdg_enable, pll_enable;
+    logic [19:0] wdg_timeout;
+    logic [9:0]  pll_freq_low, pll_freq_high;
+
+    clock_watchdog u_clock_watchdog (
+        .clk            (clk),
+        .rst_n          (rst_n),
+        .clk_mon        (clk_mon),
+        .timeout_cycles (wdg_timeout),
+        .enable         (wdg_enable),
+        .fault_clk      (fault_clk)
+    );
+
+    pll_monitor #(
+        .REF_CLK_MHZ (400)
+    ) u_pll_monitor (
+        .clk_pll       (clk_pll),
+        .clk_ref       (clk),
+        .rst_n         (rst_n),
+        .pll_lock      (pll_lock),
+        .pll_fdco      (pll_fdco),
+        .enable        (pll_enable),
+        .freq_low      (pll_freq_low),
+        .freq_high     (pll_freq_high),
+        .fault_pll_osr (fault_pll_osr),
+        .fault_pll_lol (fault_pll_lol)
+    );
+
+    clk_ctrl_regs u_clk_regs (
+        .clk           (clk),
+        .reset_n       (rst_n),
+        .psel          (s_psel[SLV_CLK]),
+        .penable       (s_penable),
+        .paddr         (s_paddr),
+        .pwrite        (s_pwrite),
+        .pwdata        (s_pwdata),
+        .prdata        (s_prdata[SLV_CLK*32 +: 32]),
+        .pready        (s_pready[SLV_CLK]),
+        .pslverr       (s_pslverr[SLV_CLK]),
+        .fault_clk     (fault_clk),
+        .fault_pll_lol (fault_pll_lol),
+        .fault_pll_osr (fault_pll_osr),
+        .wdg_enable    (wdg_enable),
+        .wdg_timeout   (wdg_timeout),
+        .pll_enable    (pll_enable),
+        .pll_freq_low  (pll_freq_low),
+        .pll_freq_high (pll_freq_high)
+    );
+
+    // ========================================================================
+    // Memory Protection
+    // ========================================================================
+
+    logic [63:0] rd_data;
+    logic        rd_error, rd_sbe, rd_mbe;
+    logic [6:0]  rd_error_pos;
+    logic [31:0] rd_addr;
+
+    ecc_memory #(
+        .WORDS (MEM_WORDS)
+    ) u_ecc_memory (
+        .clk          (clk),
+        .reset_n      (rst_n),
+        .req          (mem_req),
+        .we           (mem_we),
+        .addr         (mem_addr),
+        .wdata        (mem_wdata),
+        .inject       (mem_inject),
+        .rd_valid     (mem_rvalid),
+        .rd_data      (rd_data),
+        .rd_error     (rd_error),
+        .rd_sbe       (rd_sbe),
+        .rd_mbe       (rd_mbe),
+        .rd_error_pos (rd_error_pos),
+        .rd_addr      (rd_addr)
+    );
+
+    ecc_controller u_ecc_controller (
+        .clk            (clk),
+        .reset_n        (rst_n),
+        .decoded_data   (rd_data),
+        .ecc_error      (rd_error),
+        .ecc_sbe        (rd_sbe),
+        .ecc_mbe        (rd_mbe),
+        .ecc_error_pos  (rd_error_pos),
+        .ecc_error_addr (rd_addr),
+        .psel           (s_psel[SLV_ECC]),
+        .penable        (s_penable),
+        .paddr          (s_paddr[4:0]),
+        .pwrite         (s_pwrite),
+        .pwdata         (s_pwdata),
+        .prdata         (s_prdata[SLV_ECC*32 +: 32]),
+        .pready         (s_pready[SLV_ECC]),
+        .pslverr        (s_pslverr[SLV_ECC]),
+        .mem_fault_irq  (mem_fault_irq),
+        .sbe_irq        (sbe_irq),
+        .mbe_irq        (mbe_irq),
+        .data_out       (mem_rdata)
+    );
+
+endmodule
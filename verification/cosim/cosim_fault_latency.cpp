@@ -0,0 +1,246 @@
+/**
+ * @file cosim_fault_latency.cpp
+ * @brief End-to-end fault-to-safe-state latency, firmware on Verilated RTL
+ *
+ * Boots the host firmware against top_power_management_safety (see
+ * cosim_top.h): the drivers program the real register blocks over APB and
+ * the RTL interrupt outputs run the firmware ISRs. One fault is injected
+ * at the RTL inputs and the complete reaction is timed in simulated clk
+ * cycles:
+ *
+ *   stimulus -> fault output -> ISR entry -> fault event -> safety task
+ *   (fsm_aggregate, NORMAL -> FAULT) -> power_enter_safe_state()
+ *   -> APB write of POWER_MODE -> safe_state_sw
+ *
+ * The safety task is event driven: it runs on the first idle cycle with a
+ * queued fault event, as a task woken by the ISR would.
+ *
+ * Scenarios (one per run, each is its own ctest test):
+ *  - vdd: VDD drops below the comparator reference
+ *  - clk: the supervised clock (clk_mon) stops
+ *  - pll: PLL lock is lost
+ *  - ecc: a double-bit error is read from the ECC memory
+ *
+ * Passes if the fault is detected, its ISR runs, the firmware reaches safe
+ * state within SysReq-002 (10ms) and every APB transfer completes without
+ * pslverr.
+ *
+ * Usage: cosim_fault_latency <vdd|clk|pll|ecc>
+ * Output: JSON on stdout; coverage_cosim_<scenario>.dat as well when built
+ * with the signoff profile.
+ *
+ * Feature: 001-Power-Management-Safety
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "cosim_top.h"
+
+extern "C" {
+#include "hal/interrupt_handler.h"
+#include "hal/power_api.h"
+#include "safety/safety_fsm.h"
+#include "safety/fault_event_queue.h"
+#include "power/pwr_event_handler.h"
+#include "clock/clk_event_handler.h"
+#include "memory/ecc_service.h"
+#include "memory/ecc_handler.h"
+}
+
+namespace {
+
+using cosim::CosimTop;
+using cosim::kNever;
+
+constexpr uint64_t kWarmupCycles   = 4000;      // Sequencer ramp, first PLL windows
+constexpr uint64_t kSettleCycles   = 2000;      // Firmware idle before the stimulus
+constexpr uint64_t kTimeoutCycles  = 4000000;   // SysReq-002: 10ms @ 400MHz
+constexpr double   kNsPerCycle     = 2.5;
+
+constexpr uint32_t kEccWord     = 5;
+constexpr uint32_t kEccMbeFlips = (1U << 3) | (1U << 17);   // Data bits 3, 17
+
+struct Scenario {
+    const char *name;
+    cosim::Probe fault;
+    cosim::Irq irq;
+};
+
+const Scenario kScenarios[] = {
+    {"vdd", cosim::kProbeFaultVdd, cosim::kIrqVdd},
+    {"clk", cosim::kProbeFaultClk, cosim::kIrqClk},
+    {"pll", cosim::kProbeFaultPllLol, cosim::kIrqClk},
+    {"ecc", cosim::kProbeMemFaultIrq, cosim::kIrqMem},
+};
+
+bool g_safe_state_requested = false;
+
+/** Safety task body: aggregate queued events, enter safe state on FAULT */
+void safety_task()
+{
+    fsm_aggregation_t agg;
+
+    if (fsm_aggregate(&agg) && fsm_get_state() == SAFETY_STATE_FAULT &&
+        !g_safe_state_requested) {
+        g_safe_state_requested = power_enter_safe_state();
+    }
+}
+
+/** Boot sequence of the firmware, register accesses on the RTL */
+bool firmware_init()
+{
+    bool ok = true;
+
+    ok = ok && fsm_init();
+    ok = ok && fsm_transition(SAFETY_STATE_NORMAL);
+    ok = ok && interrupt_handler_init();
+    pwr_event_handler_init();
+    ok = ok && (clk_event_handler_init() == SAFETY_OK);
+    ok = ok && ecc_init();
+    ok = ok && ecc_handler_init();
+    ok = ok && power_init();
+    ok = ok && power_enable_fault_irq();
+
+    return ok;
+}
+
+/** Apply the scenario's fault at the RTL inputs */
+void inject(CosimTop &top, const Scenario &s)
+{
+    cosim::Top *dut = top.dut();
+
+    if (std::strcmp(s.name, "vdd") == 0) {
+        dut->vdd_in = 0;    // Below the reference
+        dut->vref = 1;
+    } else if (std::strcmp(s.name, "clk") == 0) {
+        top.set_clk_mon(false);
+    } else if (std::strcmp(s.name, "pll") == 0) {
+        dut->pll_lock = 0;
+    } else {
+        // Read back a word with two bits flipped on the way out
+        dut->mem_req = 1;
+        dut->mem_we = 0;
+        dut->mem_addr = kEccWord;
+        dut->mem_inject[0] = kEccMbeFlips;
+        top.step();
+        dut->mem_req = 0;
+        dut->mem_inject[0] = 0;
+    }
+}
+
+/** Cycles from @p from to @p to, -1 if either never happened */
+long long span(uint64_t from, uint64_t to)
+{
+    if (from == kNever || to == kNever) {
+        return -1;
+    }
+    return static_cast<long long>(to - from);
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    const Scenario *scenario = nullptr;
+
+    for (const Scenario &s : kScenarios) {
+        if (argc > 1 && std::strcmp(argv[1], s.name) == 0) {
+            scenario = &s;
+        }
+    }
+    if (scenario == nullptr) {
+        std::fprintf(stderr, "usage: %s <vdd|clk|pll|ecc>\n", argv[0]);
+        return 2;
+    }
+
+    auto ctx = std::make_unique<VerilatedContext>();
+    ctx->commandArgs(argc, argv);
+
+    CosimTop top(ctx.get());
+    cosim::Top *dut = top.dut();
+
+    top.reset();
+    for (uint64_t n = 0; n < kWarmupCycles; n++) {
+        top.tick();
+    }
+
+    // Boot: interrupts stay masked until the drivers are initialized
+    top.attach_bus();
+    if (!firmware_init()) {
+        std::fprintf(stderr, "firmware init failed at cycle %llu\n",
+                     static_cast<unsigned long long>(top.cycle()));
+        return 1;
+    }
+    top.enable_irqs({pwr_event_handler_vdd_fault,
+                     clk_event_handler_clk_loss_isr,
+                     ecc_fault_isr});
+
+    // ECC scenario: the word under test holds valid data
+    dut->mem_req = 1;
+    dut->mem_we = 1;
+    dut->mem_addr = kEccWord;
+    dut->mem_wdata = 0x0123456789ABCDEFULL;
+    top.step();
+    dut->mem_req = 0;
+    dut->mem_we = 0;
+
+    // Idle with no fault: nothing may fire
+    top.arm_probes();
+    for (uint64_t n = 0; n < kSettleCycles; n++) {
+        top.step();
+    }
+    bool quiet = top.first_rise(cosim::kProbeFaultVdd) == kNever &&
+                 top.first_rise(cosim::kProbeFaultClk) == kNever &&
+                 top.first_rise(cosim::kProbeFaultPllLol) == kNever &&
+                 top.first_rise(cosim::kProbeFaultPllOsr) == kNever &&
+                 top.first_rise(cosim::kProbeMemFaultIrq) == kNever &&
+                 top.first_rise(cosim::kProbeSafeStateEn) == kNever &&
+                 fsm_get_state() == SAFETY_STATE_NORMAL;
+
+    // Fault, then run until the firmware has reached safe state
+    top.arm_probes();
+    uint64_t stimulus = top.cycle();
+    inject(top, *scenario);
+
+    while (top.first_rise(cosim::kProbeSafeStateSw) == kNever &&
+           top.cycle() - stimulus < kTimeoutCycles) {
+        top.step();
+        if (fault_event_pending() != 0U) {
+            safety_task();
+        }
+    }
+
+    uint64_t fault = top.first_rise(scenario->fault);
+    uint64_t isr = top.first_isr(scenario->irq);
+    uint64_t safe_sw = top.first_rise(cosim::kProbeSafeStateSw);
+    uint64_t safe_en = top.first_rise(cosim::kProbeSafeStateEn);
+    long long to_safe = span(fault, safe_sw);
+
+    bool ok = quiet && fault != kNever && isr != kNever && safe_sw != kNever &&
+              fsm_get_state() == SAFETY_STATE_FAULT && !power_write_enabled() &&
+              top.apb_errors() == 0U;
+
+    std::printf("{\n");
+    std::printf("  \"scenario\": \"%s\",\n", scenario->name);
+    std::printf("  \"detect_cycles\": %lld,\n", span(stimulus, fault));
+    std::printf("  \"fault_to_isr_cycles\": %lld,\n", span(fault, isr));
+    std::printf("  \"fault_to_safe_state_cycles\": %lld,\n", to_safe);
+    std::printf("  \"fault_to_safe_state_ns\": %.1f,\n",
+                to_safe < 0 ? -1.0 : double(to_safe) * kNsPerCycle);
+    std::printf("  \"fault_to_hw_safe_state_cycles\": %lld,\n", span(fault, safe_en));
+    std::printf("  \"isr_calls\": %u,\n", top.isr_count(scenario->irq));
+    std::printf("  \"apb_reads\": %llu,\n", static_cast<unsigned long long>(top.apb_reads()));
+    std::printf("  \"apb_writes\": %llu,\n", static_cast<unsigned long long>(top.apb_writes()));
+    std::printf("  \"apb_errors\": %llu,\n", static_cast<unsigned long long>(top.apb_errors()));
+    std::printf("  \"result\": \"%s\"\n", ok ? "PASSED" : "FAILED");
+    std::printf("}\n");
+
+#if VM_COVERAGE
+    ctx->coveragep()->write(("coverage_cosim_" + std::string(scenario->name) + ".dat").c_str());
+#endif
+    return ok ? 0 : 1;
+}
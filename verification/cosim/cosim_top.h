@@ -0,0 +1,309 @@
+/**
+ * @file cosim_top.h
+ * @brief RTL/firmware co-simulation harness for top_power_management_safety
+ *
+ * Runs the host build of the firmware (firmware_lib_host) against the
+ * Verilated top level, in one thread and on one simulated timeline:
+ *
+ *  - MMIO: hal_reg_read32() / hal_reg_write32() are routed to an APB3
+ *    master BFM (hal_sim_bus_attach). Every driver access is one APB
+ *    transfer on the top-level slave port: a setup cycle, then access
+ *    cycles until pready. Addresses are offsets in the 0x4000_0000 window.
+ *  - Interrupts: a rising edge on vdd_irq, on fault_clk | fault_pll_lol |
+ *    fault_pll_osr or on mem_fault_irq pends the VDD, clock or ECC ISR.
+ *    A pending ISR is entered after kIrqEntryCycles (Cortex-M4 exception
+ *    entry) at the next instruction boundary the harness can see: the end
+ *    of a bus access or an idle cycle. Priority VDD > CLK > MEM; a higher
+ *    priority ISR preempts a lower one at its next bus access.
+ *  - Time: simulated clk cycles (400MHz). Firmware code between two bus
+ *    accesses runs natively and costs no simulated time, so measured
+ *    latencies are the part set by hardware detection, exception entry
+ *    and bus traffic.
+ *
+ * Probes record the first rising edge of each fault and safe-state output
+ * after arm_probes(), with the cycle at which it was sampled.
+ *
+ * Feature: 001-Power-Management-Safety
+ */
+
+#ifndef COSIM_TOP_H
+#define COSIM_TOP_H
+
+#include <cstdint>
+#include <memory>
+
+#include "Vtop_power_management_safety.h"
+#include "verilated.h"
+
+extern "C" {
+#include "hal/reg_access.h"
+}
+
+namespace cosim {
+
+using Top = Vtop_power_management_safety;
+using Isr = void (*)(void);
+
+constexpr uint64_t kNever = UINT64_MAX;
+
+constexpr uint32_t kPeriphMask      = 0x000FFFFFU;  // Window offset (paddr)
+constexpr uint32_t kIrqEntryCycles  = 12;           // Cortex-M4 exception entry
+constexpr uint32_t kApbMaxWait      = 16;           // pready timeout
+
+/** Interrupt lines, in priority order */
+enum Irq : unsigned {
+    kIrqVdd = 0,    // vdd_irq
+    kIrqClk,        // fault_clk | fault_pll_lol | fault_pll_osr
+    kIrqMem,        // mem_fault_irq
+    kIrqCount
+};
+
+/** Outputs whose first rising edge is recorded */
+enum Probe : unsigned {
+    kProbeFaultVdd = 0,
+    kProbeFaultClk,
+    kProbeFaultPllLol,
+    kProbeFaultPllOsr,
+    kProbeMemFaultIrq,
+    kProbeSafeStateSw,  // Firmware POWER_MODE = SAFE_STATE
+    kProbeSafeStateEn,  // Sequencer or firmware
+    kProbeCount
+};
+
+class CosimTop {
+public:
+    explicit CosimTop(VerilatedContext *ctx) : dut_(new Top{ctx})
+    {
+        bus_.read = bus_read;
+        bus_.write = bus_write;
+        bus_.ctx = this;
+    }
+
+    ~CosimTop()
+    {
+        hal_sim_bus_attach(nullptr);
+        dut_->final();
+    }
+
+    Top *dut() { return dut_.get(); }
+    uint64_t cycle() const { return cycle_; }
+
+    /** Reset with nominal inputs: VDD good, PLL locked, clocks running */
+    void reset()
+    {
+        dut_->clk = 0;
+        dut_->clk_mon = 0;
+        dut_->clk_pll = 0;
+        dut_->rst_n = 0;
+        dut_->vdd_in = 1;     // Above the comparator threshold
+        dut_->vref = 0;
+        dut_->pll_lock = 1;
+        dut_->pll_fdco = 0;
+        dut_->psel = 0;
+        dut_->penable = 0;
+        dut_->pwrite = 0;
+        dut_->mem_req = 0;
+        dut_->mem_we = 0;
+        dut_->mem_inject[0] = 0;
+        dut_->mem_inject[1] = 0;
+        dut_->mem_inject[2] = 0;
+        tick();
+        tick();
+        dut_->rst_n = 1;
+        tick();
+    }
+
+    /** Start / stop the supervised clock (clk_mon = clk / 4) */
+    void set_clk_mon(bool running) { clk_mon_running_ = running; }
+
+    /** One 400MHz cycle, then sample probes and interrupt lines */
+    void tick()
+    {
+        dut_->clk = 0;
+        dut_->clk_pll = 0;
+        dut_->eval();
+        dut_->clk = 1;
+        dut_->clk_pll = 1;
+        if (clk_mon_running_ && (cycle_ & 1U) == 0U) {
+            dut_->clk_mon = !dut_->clk_mon;
+        }
+        dut_->eval();
+        cycle_++;
+        sample();
+    }
+
+    /** One idle cycle of the firmware: tick, then take pending ISRs */
+    void step()
+    {
+        tick();
+        service_irqs();
+    }
+
+    /** Route firmware register accesses to the APB BFM */
+    void attach_bus() { hal_sim_bus_attach(&bus_); }
+
+    /** Install ISRs and unmask; only edges from now on pend */
+    void enable_irqs(const Isr (&isrs)[kIrqCount])
+    {
+        for (unsigned i = 0; i < kIrqCount; i++) {
+            isr_[i] = isrs[i];
+        }
+        pending_ = 0;
+        irq_enabled_ = true;
+    }
+
+    /** APB3 read transfer (firmware address) */
+    uint32_t apb_read(uint32_t addr) { return transfer(addr, false, 0U); }
+
+    /** APB3 write transfer (firmware address) */
+    void apb_write(uint32_t addr, uint32_t value) { (void)transfer(addr, true, value); }
+
+    /** Forget recorded edges; record the next rise of each probe */
+    void arm_probes()
+    {
+        for (unsigned p = 0; p < kProbeCount; p++) {
+            first_rise_[p] = kNever;
+        }
+        for (unsigned i = 0; i < kIrqCount; i++) {
+            first_isr_[i] = kNever;
+        }
+    }
+
+    uint64_t first_rise(Probe p) const { return first_rise_[p]; }
+    uint64_t first_isr(Irq irq) const { return first_isr_[irq]; }
+    uint32_t isr_count(Irq irq) const { return isr_count_[irq]; }
+
+    uint64_t apb_reads() const { return apb_reads_; }
+    uint64_t apb_writes() const { return apb_writes_; }
+    uint64_t apb_errors() const { return apb_errors_; }
+
+private:
+    static uint32_t bus_read(void *ctx, uint32_t addr)
+    {
+        return static_cast<CosimTop *>(ctx)->apb_read(addr);
+    }
+
+    static void bus_write(void *ctx, uint32_t addr, uint32_t value)
+    {
+        static_cast<CosimTop *>(ctx)->apb_write(addr, value);
+    }
+
+    /** Setup phase, access phase until pready, then take pending ISRs */
+    uint32_t transfer(uint32_t addr, bool write, uint32_t wdata)
+    {
+        uint32_t rdata = 0;
+
+        dut_->psel = 1;
+        dut_->penable = 0;
+        dut_->pwrite = write ? 1 : 0;
+        dut_->paddr = addr & kPeriphMask;
+        dut_->pwdata = write ? wdata : 0U;
+        tick();
+
+        dut_->penable = 1;
+        for (uint32_t wait = 0;; wait++) {
+            dut_->eval();
+            if (dut_->pready) {
+                rdata = dut_->prdata;
+                apb_errors_ += dut_->pslverr ? 1U : 0U;
+                break;
+            }
+            if (wait == kApbMaxWait) {
+                apb_errors_++;
+                break;
+            }
+            tick();
+        }
+        tick();
+
+        dut_->psel = 0;
+        dut_->penable = 0;
+        dut_->pwrite = 0;
+        if (write) {
+            apb_writes_++;
+        } else {
+            apb_reads_++;
+        }
+
+        service_irqs();
+        return rdata;
+    }
+
+    void sample()
+    {
+        const uint8_t lines[kIrqCount] = {
+            dut_->vdd_irq,
+            static_cast<uint8_t>(dut_->fault_clk | dut_->fault_pll_lol | dut_->fault_pll_osr),
+            dut_->mem_fault_irq,
+        };
+        const uint8_t probes[kProbeCount] = {
+            dut_->fault_vdd, dut_->fault_clk, dut_->fault_pll_lol, dut_->fault_pll_osr,
+            dut_->mem_fault_irq, dut_->safe_state_sw, dut_->safe_state_en,
+        };
+
+        for (unsigned i = 0; i < kIrqCount; i++) {
+            if (irq_enabled_ && lines[i] && !irq_line_[i]) {
+                pending_ |= 1U << i;
+            }
+            irq_line_[i] = lines[i];
+        }
+        for (unsigned p = 0; p < kProbeCount; p++) {
+            if (probes[p] && !probe_[p] && first_rise_[p] == kNever) {
+                first_rise_[p] = cycle_;
+            }
+            probe_[p] = probes[p];
+        }
+    }
+
+    /** Enter pending ISRs that outrank the running one, highest first */
+    void service_irqs()
+    {
+        while (pending_ != 0U) {
+            unsigned irq = 0;
+            while ((pending_ & (1U << irq)) == 0U) {
+                irq++;
+            }
+            if (irq >= active_) {
+                return;
+            }
+
+            pending_ &= ~(1U << irq);
+            for (uint32_t i = 0; i < kIrqEntryCycles; i++) {
+                tick();
+            }
+
+            unsigned preempted = active_;
+            active_ = irq;
+            if (first_isr_[irq] == kNever) {
+                first_isr_[irq] = cycle_;
+            }
+            isr_count_[irq]++;
+            if (isr_[irq] != nullptr) {
+                isr_[irq]();
+            }
+            active_ = preempted;
+        }
+    }
+
+    std::unique_ptr<Top> dut_;
+    hal_sim_bus_t bus_{};
+    uint64_t cycle_ = 0;
+    bool clk_mon_running_ = true;
+
+    Isr isr_[kIrqCount] = {};
+    bool irq_enabled_ = false;
+    uint8_t irq_line_[kIrqCount] = {};
+    uint32_t pending_ = 0;
+    unsigned active_ = kIrqCount;   // Priority of the running ISR (none)
+    uint64_t first_isr_[kIrqCount] = {kNever, kNever, kNever};
+    uint32_t isr_count_[kIrqCount] = {};
+
+    uint8_t probe_[kProbeCount] = {};
+    uint64_t first_rise_[kProbeCount] = {kNever, kNever, kNever, kNever, kNever, kNever, kNever};
+
+    uint64_t apb_reads_ = 0, apb_writes_ = 0, apb_errors_ = 0;
+};
+
+}  // namespace cosim
+
+#endif /* COSIM_TOP_H */
@@ -36,6 +36,7 @@ module clock_monitor_tb;
     clock_watchdog u_watchdog (
         .clk(clk_400mhz),
         .rst_n(rst_n),
+        .clk_mon(clk_ref),         // Monitored clock
         .timeout_cycles(20'd400),  // 1μs @ 400MHz
         .enable(clk_watchdog_enable),
         .fault_clk(fault_clk)
@@ -48,8 +49,8 @@ module clock_monitor_tb;
         .pll_lock(pll_lock),
         .pll_fdco(pll_fdco),
         .enable(1'b1),
-        .freq_low(8'd396),
-        .freq_high(8'd404),
+        .freq_low(10'd396),
+        .freq_high(10'd404),
         .fault_pll_osr(fault_pll_osr),
         .fault_pll_lol(fault_pll_lol)
     );
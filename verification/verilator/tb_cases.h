@@ -0,0 +1,98 @@
+/**
+ * @file tb_cases.h
+ * @brief Test-case runner shared by the per-module Verilator testbenches
+ *
+ * A testbench lists its cases (TC01, TC02, ...) in a table and hands it to
+ * run_cases() from main():
+ *
+ *   tb_<module>            runs every case on one model
+ *   tb_<module> TC04       runs TC04 only
+ *
+ * verification/CMakeLists.txt registers one ctest test per case, so
+ * `ctest -j` spreads a module's cases over separate processes. Built with
+ * the signoff profile, each run writes coverage_<bench>[_<case>].dat; the
+ * per-case files merge with verilator_coverage.
+ *
+ * Feature: 001-Power-Management-Safety
+ */
+
+#ifndef TB_CASES_H
+#define TB_CASES_H
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "verilated.h"
+
+namespace tb {
+
+inline int &failures()
+{
+    static int count = 0;
+    return count;
+}
+
+inline void check(bool cond, const char *what)
+{
+    if (!cond) {
+        std::printf("  FAIL: %s\n", what);
+        failures()++;
+    }
+}
+
+/** One test case; the bench is reset before run() */
+template <typename Bench>
+struct TestCase {
+    const char *id;
+    const char *title;
+    void (*run)(Bench &);
+};
+
+/**
+ * Run every case of @p cases, or the one named by argv[1]
+ *
+ * @return Exit code: 0 all checks passed, 1 failures, 2 unknown case
+ */
+template <typename Bench, size_t N>
+int run_cases(const char *name, const TestCase<Bench> (&cases)[N], int argc, char **argv)
+{
+    const char *only = (argc > 1 && argv[1][0] != '+') ? argv[1] : nullptr;
+    unsigned ran = 0;
+
+    auto ctx = std::make_unique<VerilatedContext>();
+    ctx->commandArgs(argc, argv);
+
+    {
+        Bench bench(ctx.get());
+        for (const TestCase<Bench> &tc : cases) {
+            if (only != nullptr && std::strcmp(only, tc.id) != 0) {
+                continue;
+            }
+            std::printf("%s: %s\n", tc.id, tc.title);
+            bench.reset();
+            tc.run(bench);
+            ran++;
+        }
+    }
+    if (ran == 0U) {
+        std::fprintf(stderr, "%s: no test case %s\n", name, only);
+        return 2;
+    }
+#if VM_COVERAGE
+    std::string cov = std::string("coverage_") + name;
+    if (only != nullptr) {
+        cov += std::string("_") + only;
+    }
+    ctx->coveragep()->write((cov + ".dat").c_str());
+#endif
+
+    std::printf("%s (%d failures)\n", failures() ? "FAILED" : "PASSED", failures());
+    return failures() ? 1 : 0;
+}
+
+}  // namespace tb
+
+#endif /* TB_CASES_H */
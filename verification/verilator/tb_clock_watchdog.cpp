@@ -0,0 +1,296 @@
+/**
+ * @file tb_clock_watchdog.cpp
+ * @brief Verilator testbench for clock_watchdog.v
+ *
+ * Runs the test cases listed in clock_watchdog.v ("Coverage Point") on the
+ * RTL: clk at 400MHz, clk_mon generated from it (clk / 4 by default) and
+ * stopped or slowed to inject a clock loss.
+ *
+ * Feature: 001-Power-Management-Safety
+ * User Story: US2 - Clock Monitoring & Fault Detection
+ * ASIL Level: ASIL-B
+ *
+ * Test cases:
+ *  - TC01: Normal operation: no fault for 1000 cycles with clock present
+ *  - TC02: Clock stopped for 410 cycles asserts fault_clk
+ *  - TC03: fault_clk within 100ns (40 cycles) of the timeout
+ *  - TC04: fault_clk clears once the clock resumes (2-edge hysteresis)
+ *  - TC05: Disable clears the fault; re-enable restarts the timeout
+ *  - TC06: Gaps shorter than the timeout raise no fault
+ *  - TC07: Timeout accuracy ±5% for timeout_cycles 200..10000
+ *  - TC08: Five loss/recovery events in a row
+ *  - TC09: timeout_cycles = 1 trips on any gap in clk_mon
+ *  - TC10: timeout_cycles = 0xFFFFF (2.6ms) trips only after 2.6ms
+ *
+ * Usage: tb_clock_watchdog [TCnn]   (all cases by default, see tb_cases.h)
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+
+#include "Vclock_watchdog.h"
+#include "tb_cases.h"
+#include "verilated.h"
+
+namespace {
+
+using tb::check;
+
+constexpr uint32_t kTimeout       = 400;       // 1μs @ 400MHz (TSR-002)
+constexpr uint32_t kMaxTimeout    = 0xFFFFF;   // 20-bit timeout_cycles
+constexpr uint32_t kMonHalf       = 2;         // clk_mon = clk / 4
+constexpr uint64_t kMaxDelay      = 40;        // 100ns fault output delay
+
+class WatchdogBench {
+public:
+    explicit WatchdogBench(VerilatedContext *ctx) : dut_(new Vclock_watchdog{ctx}) {}
+    ~WatchdogBench() { dut_->final(); }
+
+    void reset()
+    {
+        dut_->clk = 0;
+        dut_->clk_mon = 0;
+        dut_->rst_n = 0;
+        dut_->enable = 1;
+        dut_->timeout_cycles = kTimeout;
+        set_clk_mon(kMonHalf);
+        tick();
+        tick();
+        dut_->rst_n = 1;
+        tick();
+    }
+
+    /** clk_mon half period in clk cycles; 0 stops it at its current level */
+    void set_clk_mon(uint32_t half)
+    {
+        mon_half_ = half;
+        mon_phase_ = 0;
+    }
+
+    void set_timeout(uint32_t cycles) { dut_->timeout_cycles = cycles; }
+    void set_enable(bool on) { dut_->enable = on ? 1 : 0; }
+
+    /** One 400MHz cycle; clk_mon changes with the rising edge of clk */
+    void tick()
+    {
+        dut_->clk = 0;
+        dut_->eval();
+        dut_->clk = 1;
+        if (mon_half_ != 0U && ++mon_phase_ >= mon_half_) {
+            mon_phase_ = 0;
+            dut_->clk_mon = !dut_->clk_mon;
+            if (dut_->clk_mon) {
+                last_rise_ = cycle_ + 1;
+            }
+        }
+        dut_->eval();
+        cycle_++;
+    }
+
+    bool fault() const { return dut_->fault_clk != 0; }
+    uint64_t cycle() const { return cycle_; }
+
+    /** Cycle of the last rising edge of clk_mon */
+    uint64_t last_rise() const { return last_rise_; }
+
+    /** Tick until fault_clk == @p level, at most @p limit cycles; cycles run */
+    uint64_t run_until(bool level, uint64_t limit)
+    {
+        uint64_t n = 0;
+
+        while (fault() != level && n < limit) {
+            tick();
+            n++;
+        }
+        return n;
+    }
+
+    /** Tick @p cycles; true if fault_clk stayed at @p level throughout */
+    bool hold(bool level, uint64_t cycles)
+    {
+        bool held = true;
+
+        for (uint64_t n = 0; n < cycles; n++) {
+            tick();
+            held = held && fault() == level;
+        }
+        return held;
+    }
+
+private:
+    std::unique_ptr<Vclock_watchdog> dut_;
+    uint64_t cycle_ = 0;
+    uint64_t last_rise_ = 0;
+    uint32_t mon_half_ = kMonHalf;
+    uint32_t mon_phase_ = 0;
+};
+
+/** Stop clk_mon; cycles from its last rising edge to fault_clk */
+uint64_t loss_latency(WatchdogBench &tb, uint64_t limit)
+{
+    tb.set_clk_mon(0);
+    tb.run_until(true, limit);
+    return tb.cycle() - tb.last_rise();
+}
+
+/** @p latency within ±5% of @p timeout */
+bool within_5pct(uint64_t latency, uint32_t timeout)
+{
+    return latency * 100U >= uint64_t(timeout) * 95U &&
+           latency * 100U <= uint64_t(timeout) * 105U;
+}
+
+void tc01_normal(WatchdogBench &tb)
+{
+    check(tb.hold(false, 1000), "no fault for 1000 cycles at clk / 4");
+    tb.set_clk_mon(100);
+    check(tb.hold(false, 2000), "no fault at clk / 200");
+}
+
+void tc02_clock_loss(WatchdogBench &tb)
+{
+    tb.hold(false, 100);
+    tb.set_clk_mon(0);
+    check(tb.hold(false, 380), "no fault before the timeout");
+    tb.hold(true, 30);
+    check(tb.fault(), "fault_clk after 410 cycles without clk_mon");
+}
+
+void tc03_propagation_delay(WatchdogBench &tb)
+{
+    tb.hold(false, 100);
+    uint64_t latency = loss_latency(tb, 2 * kTimeout);
+    std::printf("  last edge -> fault_clk: %llu cycles (timeout %u)\n",
+                static_cast<unsigned long long>(latency), kTimeout);
+    check(tb.fault(), "fault_clk asserted");
+    check(latency >= kTimeout, "no fault before the timeout");
+    check(latency - kTimeout <= kMaxDelay, "fault_clk within 100ns of the timeout");
+}
+
+void tc04_recovery(WatchdogBench &tb)
+{
+    tb.hold(false, 100);
+    tb.set_clk_mon(0);
+    tb.run_until(true, 2 * kTimeout);
+    check(tb.fault(), "fault_clk asserted");
+
+    tb.set_clk_mon(kMonHalf);
+    uint64_t clear = tb.run_until(false, 100);
+    std::printf("  clock resumed -> fault_clk clear: %llu cycles\n",
+                static_cast<unsigned long long>(clear));
+    check(!tb.fault(), "fault_clk clears after the clock resumes");
+    check(clear >= 2 * kMonHalf, "fault_clk held for at least one clk_mon period");
+    check(tb.hold(false, 1000), "no fault after recovery");
+}
+
+void tc05_enable(WatchdogBench &tb)
+{
+    tb.hold(false, 100);
+    tb.set_clk_mon(0);
+    tb.run_until(true, 2 * kTimeout);
+    check(tb.fault(), "fault_clk asserted");
+
+    tb.set_enable(false);
+    tb.tick();
+    check(!tb.fault(), "disable clears fault_clk");
+    check(tb.hold(false, 2 * kTimeout), "no fault while disabled");
+
+    tb.set_enable(true);
+    uint64_t latency = tb.run_until(true, 2 * kTimeout);
+    std::printf("  re-enable -> fault_clk: %llu cycles\n",
+                static_cast<unsigned long long>(latency));
+    check(tb.fault(), "fault_clk after re-enable with the clock stopped");
+    check(within_5pct(latency, kTimeout), "timeout restarts on re-enable");
+}
+
+void tc06_short_gaps(WatchdogBench &tb)
+{
+    static const uint32_t kGaps[] = {10, 100, 200, 350};
+    bool quiet = tb.hold(false, 100);
+
+    for (uint32_t gap : kGaps) {
+        tb.set_clk_mon(0);
+        quiet = tb.hold(false, gap) && quiet;
+        tb.set_clk_mon(kMonHalf);
+        quiet = tb.hold(false, 100) && quiet;
+    }
+    check(quiet, "gaps of up to 350 cycles raise no fault");
+}
+
+void tc07_timeout_accuracy(WatchdogBench &tb)
+{
+    static const uint32_t kTimeouts[] = {200, 400, 1000, 4000, 10000};
+
+    for (uint32_t timeout : kTimeouts) {
+        tb.set_timeout(timeout);
+        tb.hold(false, 100);
+        uint64_t latency = loss_latency(tb, 2U * timeout);
+        std::printf("  timeout %u: fault_clk after %llu cycles\n", timeout,
+                    static_cast<unsigned long long>(latency));
+        check(tb.fault() && within_5pct(latency, timeout), "timeout within ±5%");
+        tb.set_clk_mon(kMonHalf);
+        tb.run_until(false, 100);
+    }
+}
+
+void tc08_repeated_loss(WatchdogBench &tb)
+{
+    uint32_t detected = 0, cleared = 0;
+    bool quiet = true;
+
+    for (int event = 0; event < 5; event++) {
+        tb.set_clk_mon(0);
+        tb.run_until(true, 2 * kTimeout);
+        detected += tb.fault() ? 1U : 0U;
+        tb.set_clk_mon(kMonHalf);
+        tb.run_until(false, 100);
+        cleared += tb.fault() ? 0U : 1U;
+        quiet = tb.hold(false, 200) && quiet;
+    }
+    std::printf("  5 losses: %u detected, %u cleared\n", detected, cleared);
+    check(detected == 5U, "every loss detected");
+    check(cleared == 5U, "every recovery clears fault_clk");
+    check(quiet, "no fault between events");
+}
+
+void tc09_timeout_one(WatchdogBench &tb)
+{
+    tb.hold(false, 100);
+    tb.set_timeout(1);
+    tb.run_until(true, 20);
+    check(tb.fault(), "timeout 1 trips on the 3-cycle gaps of clk / 4");
+    check(tb.hold(true, 1000), "fault_clk held while every gap times out");
+}
+
+void tc10_timeout_max(WatchdogBench &tb)
+{
+    tb.set_timeout(kMaxTimeout);
+    check(tb.hold(false, 100000), "no fault with the clock present");
+    uint64_t latency = loss_latency(tb, uint64_t(kMaxTimeout) + 1000U);
+    std::printf("  timeout %u: fault_clk after %llu cycles\n", kMaxTimeout,
+                static_cast<unsigned long long>(latency));
+    check(tb.fault(), "fault_clk after the maximum timeout");
+    check(latency >= kMaxTimeout && latency - kMaxTimeout <= kMaxDelay,
+          "no fault before the maximum timeout");
+}
+
+const tb::TestCase<WatchdogBench> kCases[] = {
+    {"TC01", "normal operation", tc01_normal},
+    {"TC02", "clock loss detection", tc02_clock_loss},
+    {"TC03", "fault propagation delay", tc03_propagation_delay},
+    {"TC04", "clock recovery", tc04_recovery},
+    {"TC05", "watchdog enable/disable", tc05_enable},
+    {"TC06", "hysteresis, short gaps", tc06_short_gaps},
+    {"TC07", "timeout accuracy", tc07_timeout_accuracy},
+    {"TC08", "multiple clock loss events", tc08_repeated_loss},
+    {"TC09", "timeout_cycles = 1", tc09_timeout_one},
+    {"TC10", "timeout_cycles = max", tc10_timeout_max},
+};
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    return tb::run_cases("tb_clock_watchdog", kCases, argc, argv);
+}
@@ -0,0 +1,294 @@
+/**
+ * @file tb_pll_monitor.cpp
+ * @brief Verilator testbench for pll_monitor.v
+ *
+ * Runs the test cases listed in pll_monitor.v ("Coverage Point") on the
+ * RTL. clk_ref runs at 400MHz; clk_pll is an independent clock at any
+ * integer MHz, scheduled in femtoseconds from the moment its frequency was
+ * set (edge n at n * 5e8 / f fs, no accumulated rounding), so one 1μs
+ * measurement window holds exactly f PLL edges once it is entirely at the
+ * new frequency.
+ *
+ * The window that spans a frequency change measures a mix of the two
+ * rates; cases on the thresholds let kSettleWindows pass before checking.
+ *
+ * Feature: 001-Power-Management-Safety
+ * User Story: US2 - Clock Monitoring & Fault Detection
+ * ASIL Level: ASIL-B
+ *
+ * Test cases:
+ *  - TC01: Normal operation: no fault from reset on at 400MHz, locked
+ *  - TC02: 394MHz asserts fault_pll_osr within two windows + 100ns
+ *  - TC03: 406MHz asserts fault_pll_osr within two windows + 100ns
+ *  - TC04: 396MHz (low threshold) raises no fault
+ *  - TC05: 404MHz (high threshold) raises no fault
+ *  - TC06: pll_lock low asserts fault_pll_lol within 100ns
+ *  - TC07: fault_pll_lol clears once pll_lock returns
+ *  - TC08: A 1-cycle pll_lock glitch raises no fault
+ *  - TC09: A 3-cycle pll_lock glitch asserts fault_pll_lol
+ *  - TC10: Disable clears both faults; faults injected while disabled
+ *          are not reported, nor after re-enabling on a healthy PLL
+ *
+ * Usage: tb_pll_monitor [TCnn]   (all cases by default, see tb_cases.h)
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+
+#include "Vpll_monitor.h"
+#include "tb_cases.h"
+#include "verilated.h"
+
+namespace {
+
+using tb::check;
+
+constexpr uint64_t kRefHalfFs     = 1250000;   // clk_ref 400MHz
+constexpr uint64_t kFsPerUs       = 1000000000ULL;
+constexpr uint32_t kNominalMhz    = 400;
+constexpr uint32_t kFreqLow       = 396;       // 400MHz -1%
+constexpr uint32_t kFreqHigh      = 404;       // 400MHz +1%
+constexpr uint64_t kWindowCycles  = 400;       // 1μs of clk_ref
+constexpr uint64_t kSettleWindows = 3;
+constexpr uint64_t kMaxDelay      = 40;        // 100ns fault output delay
+
+class PllBench {
+public:
+    explicit PllBench(VerilatedContext *ctx) : dut_(new Vpll_monitor{ctx}) {}
+    ~PllBench() { dut_->final(); }
+
+    void reset()
+    {
+        dut_->clk_ref = 0;
+        dut_->clk_pll = 0;
+        dut_->rst_n = 0;
+        dut_->pll_lock = 1;
+        dut_->pll_fdco = 0;
+        dut_->enable = 1;
+        dut_->freq_low = kFreqLow;
+        dut_->freq_high = kFreqHigh;
+        set_pll_mhz(kNominalMhz);
+        tick();
+        tick();
+        dut_->rst_n = 1;
+        tick();
+    }
+
+    /** clk_pll frequency from now on (MHz) */
+    void set_pll_mhz(uint32_t mhz)
+    {
+        pll_mhz_ = mhz;
+        pll_start_ = now_;
+        pll_toggles_ = 0;
+    }
+
+    void set_lock(bool locked) { dut_->pll_lock = locked ? 1 : 0; }
+    void set_enable(bool on) { dut_->enable = on ? 1 : 0; }
+
+    /** One clk_ref cycle (falling, then rising edge) with the clk_pll
+     *  edges that fall inside it */
+    void tick()
+    {
+        advance(now_ + kRefHalfFs, 0);
+        advance(now_ + kRefHalfFs, 1);
+        cycle_++;
+    }
+
+    bool osr() const { return dut_->fault_pll_osr != 0; }
+    bool lol() const { return dut_->fault_pll_lol != 0; }
+
+    /** Tick until fault_pll_osr or fault_pll_lol rises, at most @p limit
+     *  cycles; cycles run */
+    uint64_t run_until_fault(bool (PllBench::*fault)() const, uint64_t limit)
+    {
+        uint64_t n = 0;
+
+        while (!(this->*fault)() && n < limit) {
+            tick();
+            n++;
+        }
+        return n;
+    }
+
+    /** Tick @p cycles; true if both fault outputs stayed low */
+    bool quiet(uint64_t cycles)
+    {
+        bool held = true;
+
+        for (uint64_t n = 0; n < cycles; n++) {
+            tick();
+            held = held && !osr() && !lol();
+        }
+        return held;
+    }
+
+private:
+    /** Time of clk_pll toggle @p n after the last set_pll_mhz() */
+    uint64_t pll_toggle_fs(uint64_t n) const
+    {
+        return pll_start_ + n * (kFsPerUs / 2U) / pll_mhz_;
+    }
+
+    /** Run the clk_pll toggles before @p until, then drive clk_ref to
+     *  @p ref; a coincident clk_pll toggle shares the evaluation */
+    void advance(uint64_t until, uint8_t ref)
+    {
+        while (pll_toggle_fs(pll_toggles_ + 1U) < until) {
+            pll_toggles_++;
+            dut_->clk_pll = !dut_->clk_pll;
+            dut_->eval();
+        }
+        if (pll_toggle_fs(pll_toggles_ + 1U) == until) {
+            pll_toggles_++;
+            dut_->clk_pll = !dut_->clk_pll;
+        }
+        dut_->clk_ref = ref;
+        dut_->eval();
+        now_ = until;
+    }
+
+    std::unique_ptr<Vpll_monitor> dut_;
+    uint64_t now_ = 0;
+    uint64_t cycle_ = 0;
+    uint32_t pll_mhz_ = kNominalMhz;
+    uint64_t pll_start_ = 0;
+    uint64_t pll_toggles_ = 0;
+};
+
+/** Out-of-range frequency: fault_pll_osr once a full window measured it */
+void out_of_range(PllBench &tb, uint32_t mhz)
+{
+    check(tb.quiet(kSettleWindows * kWindowCycles), "no fault at 400MHz");
+    tb.set_pll_mhz(mhz);
+    uint64_t latency = tb.run_until_fault(&PllBench::osr, 4 * kWindowCycles);
+    std::printf("  %uMHz -> fault_pll_osr: %llu cycles\n", mhz,
+                static_cast<unsigned long long>(latency));
+    check(tb.osr(), "fault_pll_osr asserted");
+    check(latency <= 2 * kWindowCycles + kMaxDelay,
+          "fault_pll_osr within 100ns of the first full window");
+    check(!tb.lol(), "no loss-of-lock fault");
+}
+
+/** Threshold frequency: no fault once the mixed window has passed */
+void on_threshold(PllBench &tb, uint32_t mhz)
+{
+    tb.quiet(kSettleWindows * kWindowCycles);
+    tb.set_pll_mhz(mhz);
+    tb.quiet(kSettleWindows * kWindowCycles);
+    check(tb.quiet(20 * kWindowCycles), "no fault over 20 windows on the threshold");
+}
+
+void tc01_normal(PllBench &tb)
+{
+    check(tb.quiet(50 * kWindowCycles), "no fault for 50 windows from reset");
+}
+
+void tc02_freq_low(PllBench &tb) { out_of_range(tb, 394); }
+
+void tc03_freq_high(PllBench &tb) { out_of_range(tb, 406); }
+
+void tc04_boundary_low(PllBench &tb) { on_threshold(tb, kFreqLow); }
+
+void tc05_boundary_high(PllBench &tb) { on_threshold(tb, kFreqHigh); }
+
+void tc06_loss_of_lock(PllBench &tb)
+{
+    tb.quiet(kWindowCycles);
+    tb.set_lock(false);
+    uint64_t latency = tb.run_until_fault(&PllBench::lol, kWindowCycles);
+    std::printf("  pll_lock low -> fault_pll_lol: %llu cycles\n",
+                static_cast<unsigned long long>(latency));
+    check(tb.lol(), "fault_pll_lol asserted");
+    check(latency <= 5U, "fault_pll_lol within 5 ref cycles");
+    tb.quiet(kWindowCycles);
+    check(tb.lol(), "fault_pll_lol held while unlocked");
+    check(!tb.osr(), "no frequency fault");
+}
+
+void tc07_relock(PllBench &tb)
+{
+    tb.quiet(kWindowCycles);
+    tb.set_lock(false);
+    tb.run_until_fault(&PllBench::lol, kWindowCycles);
+    check(tb.lol(), "fault_pll_lol asserted");
+
+    tb.set_lock(true);
+    uint64_t n = 0;
+    while (tb.lol() && n < kMaxDelay) {
+        tb.tick();
+        n++;
+    }
+    std::printf("  pll_lock high -> fault_pll_lol clear: %llu cycles\n",
+                static_cast<unsigned long long>(n));
+    check(!tb.lol(), "fault_pll_lol clears after relock");
+    check(tb.quiet(5 * kWindowCycles), "no fault after relock");
+}
+
+/** pll_lock low for @p cycles, then high again */
+void lock_glitch(PllBench &tb, uint32_t cycles)
+{
+    tb.set_lock(false);
+    for (uint32_t n = 0; n < cycles; n++) {
+        tb.tick();
+    }
+    tb.set_lock(true);
+}
+
+void tc08_glitch_1(PllBench &tb)
+{
+    tb.quiet(kWindowCycles);
+    lock_glitch(tb, 1);
+    check(tb.quiet(kWindowCycles), "1-cycle pll_lock glitch raises no fault");
+}
+
+void tc09_glitch_3(PllBench &tb)
+{
+    tb.quiet(kWindowCycles);
+    lock_glitch(tb, 3);
+    tb.run_until_fault(&PllBench::lol, 10);
+    check(tb.lol(), "3-cycle pll_lock glitch asserts fault_pll_lol");
+    tb.quiet(kMaxDelay);
+    check(!tb.lol(), "fault_pll_lol clears after the glitch");
+}
+
+void tc10_enable(PllBench &tb)
+{
+    tb.quiet(kSettleWindows * kWindowCycles);
+    tb.set_lock(false);
+    tb.set_pll_mhz(394);
+    tb.run_until_fault(&PllBench::osr, 4 * kWindowCycles);
+    tb.run_until_fault(&PllBench::lol, kWindowCycles);
+    check(tb.osr() && tb.lol(), "both faults asserted while enabled");
+
+    tb.set_enable(false);
+    tb.tick();
+    check(!tb.osr() && !tb.lol(), "disable clears both faults");
+    check(tb.quiet(5 * kWindowCycles), "no fault while disabled, unlocked at 394MHz");
+
+    tb.set_lock(true);
+    tb.set_pll_mhz(kNominalMhz);
+    tb.quiet(kWindowCycles);
+    tb.set_enable(true);
+    check(tb.quiet(10 * kWindowCycles), "no fault after re-enable on a healthy PLL");
+}
+
+const tb::TestCase<PllBench> kCases[] = {
+    {"TC01", "normal operation", tc01_normal},
+    {"TC02", "frequency low (394MHz)", tc02_freq_low},
+    {"TC03", "frequency high (406MHz)", tc03_freq_high},
+    {"TC04", "boundary 396MHz", tc04_boundary_low},
+    {"TC05", "boundary 404MHz", tc05_boundary_high},
+    {"TC06", "loss-of-lock", tc06_loss_of_lock},
+    {"TC07", "lock re-established", tc07_relock},
+    {"TC08", "1-cycle lock glitch", tc08_glitch_1},
+    {"TC09", "3-cycle lock glitch", tc09_glitch_3},
+    {"TC10", "enable/disable", tc10_enable},
+};
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    return tb::run_cases("tb_pll_monitor", kCases, argc, argv);
+}
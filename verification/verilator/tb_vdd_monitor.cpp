@@ -0,0 +1,274 @@
+/**
+ * @file tb_vdd_monitor.cpp
+ * @brief Verilator testbench for vdd_monitor.v
+ *
+ * Runs the test cases listed in vdd_monitor.v ("Coverage Point") on the
+ * RTL, driving comparator_out directly (the comparator filter is covered
+ * by the top-level fault regression). recovery_ready is combinational:
+ * it is checked for the inputs of the coming clock edge.
+ *
+ * Feature: 001-Power-Management-Safety
+ * User Story: US1 - VDD Power Monitoring & Safe State
+ * ASIL Level: ASIL-B
+ *
+ * Test cases:
+ *  - TC01: Normal operation: MONITOR, no fault for 1000 cycles
+ *  - TC02: Sustained undervoltage holds FAULT_DETECTED and fault_vdd
+ *  - TC03: fault_vdd within 4 cycles (10ns) of comparator_out
+ *  - TC04: False alarm: comparator clear returns to MONITOR unassisted
+ *  - TC05: external_recovery moves FAULT_DETECTED -> RECOVERY
+ *  - TC06: RECOVERY -> MONITOR with VDD good, -> FAULT_DETECTED if low
+ *  - TC07: external_recovery without a fault is ignored
+ *  - TC08: fault_counter counts MONITOR -> FAULT_DETECTED entries only
+ *  - TC09: fault_counter saturates at 0xFFFF
+ *  - TC10: Reset during a fault clears state, fault and counter
+ *
+ * Usage: tb_vdd_monitor [TCnn]   (all cases by default, see tb_cases.h)
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+
+#include "Vvdd_monitor.h"
+#include "tb_cases.h"
+#include "verilated.h"
+
+namespace {
+
+using tb::check;
+
+constexpr uint8_t kStateMonitor  = 0x1;   // One-hot FSM encoding
+constexpr uint8_t kStateFault    = 0x2;
+constexpr uint8_t kStateRecovery = 0x4;
+
+constexpr uint32_t kMaxDelay     = 4;     // Formal property 1: ##[1:4]
+
+class VddBench {
+public:
+    explicit VddBench(VerilatedContext *ctx) : dut_(new Vvdd_monitor{ctx}) {}
+    ~VddBench() { dut_->final(); }
+
+    void reset()
+    {
+        dut_->clk = 0;
+        dut_->reset_n = 0;
+        dut_->comparator_out = 0;
+        dut_->external_recovery = 0;
+        tick();
+        tick();
+        dut_->reset_n = 1;
+        tick();
+    }
+
+    void tick()
+    {
+        dut_->clk = 0;
+        dut_->eval();
+        dut_->clk = 1;
+        dut_->eval();
+    }
+
+    void ticks(uint32_t n)
+    {
+        for (uint32_t i = 0; i < n; i++) {
+            tick();
+        }
+    }
+
+    /** comparator_out: true = VDD below the threshold */
+    void set_vdd_low(bool low) { dut_->comparator_out = low ? 1 : 0; }
+    void set_recovery(bool on) { dut_->external_recovery = on ? 1 : 0; }
+
+    /** reset_n is asynchronous: it takes effect without a clock edge */
+    void set_reset(bool asserted)
+    {
+        dut_->reset_n = asserted ? 0 : 1;
+        dut_->eval();
+    }
+
+    bool fault() const { return dut_->fault_vdd != 0; }
+    uint8_t state() const { return dut_->fsm_state; }
+    uint32_t counter() const { return dut_->fault_counter; }
+
+    /** Combinational recovery_ready for the current inputs */
+    bool recovery_ready()
+    {
+        dut_->eval();
+        return dut_->recovery_ready != 0;
+    }
+
+    /** One external_recovery pulse (one clock edge) */
+    void recovery_pulse()
+    {
+        set_recovery(true);
+        tick();
+        set_recovery(false);
+    }
+
+    /** Tick @p cycles; true if the FSM stayed in @p state, fault at @p level */
+    bool hold(uint8_t state, bool level, uint32_t cycles)
+    {
+        bool held = true;
+
+        for (uint32_t n = 0; n < cycles; n++) {
+            tick();
+            held = held && this->state() == state && fault() == level;
+        }
+        return held;
+    }
+
+    /** One fault episode: VDD low for one cycle, then good again */
+    void fault_episode()
+    {
+        set_vdd_low(true);
+        tick();
+        set_vdd_low(false);
+        tick();
+    }
+
+private:
+    std::unique_ptr<Vvdd_monitor> dut_;
+};
+
+/** VDD low until FAULT_DETECTED */
+void enter_fault(VddBench &tb)
+{
+    tb.set_vdd_low(true);
+    tb.tick();
+}
+
+void tc01_normal(VddBench &tb)
+{
+    check(tb.state() == kStateMonitor, "MONITOR after reset");
+    check(tb.hold(kStateMonitor, false, 1000), "MONITOR, no fault for 1000 cycles");
+    check(!tb.recovery_ready(), "recovery_ready low");
+    check(tb.counter() == 0U, "fault_counter 0");
+}
+
+void tc02_sustained_fault(VddBench &tb)
+{
+    enter_fault(tb);
+    check(tb.hold(kStateFault, true, 1000), "FAULT_DETECTED, fault_vdd held for 1000 cycles");
+    check(tb.counter() == 1U, "one fault counted");
+}
+
+void tc03_fault_delay(VddBench &tb)
+{
+    uint32_t latency = 0;
+
+    tb.ticks(10);
+    tb.set_vdd_low(true);
+    while (!tb.fault() && latency < 100U) {
+        tb.tick();
+        latency++;
+    }
+    std::printf("  comparator_out -> fault_vdd: %u cycles\n", latency);
+    check(tb.fault(), "fault_vdd asserted");
+    check(latency >= 1U && latency <= kMaxDelay, "fault_vdd within 4 cycles");
+}
+
+void tc04_false_alarm(VddBench &tb)
+{
+    tb.fault_episode();
+    check(tb.state() == kStateMonitor && !tb.fault(), "back to MONITOR, fault_vdd clear");
+    check(tb.hold(kStateMonitor, false, 100), "no fault after the false alarm");
+}
+
+void tc05_external_recovery(VddBench &tb)
+{
+    enter_fault(tb);
+    tb.set_recovery(true);
+    check(tb.recovery_ready(), "recovery_ready with external_recovery in FAULT_DETECTED");
+    tb.tick();
+    tb.set_recovery(false);
+    check(tb.state() == kStateRecovery, "FAULT_DETECTED -> RECOVERY");
+    check(!tb.fault(), "fault_vdd low in RECOVERY");
+}
+
+void tc06_recovery_exit(VddBench &tb)
+{
+    // VDD still low: back to FAULT_DETECTED
+    enter_fault(tb);
+    tb.recovery_pulse();
+    check(tb.state() == kStateRecovery, "RECOVERY");
+    tb.tick();
+    check(tb.state() == kStateFault && tb.fault(), "RECOVERY -> FAULT_DETECTED, VDD low");
+
+    // VDD good again: back to MONITOR
+    tb.recovery_pulse();
+    tb.set_vdd_low(false);
+    tb.tick();
+    check(tb.state() == kStateMonitor && !tb.fault(), "RECOVERY -> MONITOR, VDD good");
+    check(tb.hold(kStateMonitor, false, 100), "no fault after recovery");
+}
+
+void tc07_recovery_ignored(VddBench &tb)
+{
+    tb.set_recovery(true);
+    check(!tb.recovery_ready(), "no recovery_ready in MONITOR");
+    check(tb.hold(kStateMonitor, false, 100), "external_recovery ignored in MONITOR");
+    tb.set_recovery(false);
+    check(tb.counter() == 0U, "nothing counted");
+}
+
+void tc08_fault_counter(VddBench &tb)
+{
+    for (int n = 0; n < 5; n++) {
+        tb.fault_episode();
+    }
+    check(tb.counter() == 5U, "five episodes counted");
+
+    // RECOVERY -> FAULT_DETECTED re-entries are the same fault
+    enter_fault(tb);
+    for (int n = 0; n < 3; n++) {
+        tb.recovery_pulse();
+        tb.tick();
+    }
+    check(tb.state() == kStateFault, "still FAULT_DETECTED");
+    check(tb.counter() == 6U, "re-entry from RECOVERY not counted");
+}
+
+void tc09_counter_saturation(VddBench &tb)
+{
+    for (uint32_t n = 0; n < 0x10000U + 10U; n++) {
+        tb.fault_episode();
+    }
+    std::printf("  %u episodes -> fault_counter 0x%04X\n", 0x10000U + 10U, tb.counter());
+    check(tb.counter() == 0xFFFFU, "fault_counter saturates at 0xFFFF");
+}
+
+void tc10_reset_in_fault(VddBench &tb)
+{
+    tb.fault_episode();
+    enter_fault(tb);
+    check(tb.fault() && tb.counter() == 2U, "fault active, two counted");
+
+    tb.set_reset(true);
+    check(tb.state() == kStateMonitor && !tb.fault() && tb.counter() == 0U,
+          "reset clears state, fault_vdd and fault_counter");
+    tb.tick();
+    tb.set_reset(false);
+    tb.tick();
+    check(tb.fault() && tb.counter() == 1U, "fault detected again after reset");
+}
+
+const tb::TestCase<VddBench> kCases[] = {
+    {"TC01", "normal operation", tc01_normal},
+    {"TC02", "sustained undervoltage", tc02_sustained_fault},
+    {"TC03", "fault output delay", tc03_fault_delay},
+    {"TC04", "false alarm", tc04_false_alarm},
+    {"TC05", "external recovery", tc05_external_recovery},
+    {"TC06", "recovery exit", tc06_recovery_exit},
+    {"TC07", "recovery without a fault", tc07_recovery_ignored},
+    {"TC08", "fault counter", tc08_fault_counter},
+    {"TC09", "fault counter saturation", tc09_counter_saturation},
+    {"TC10", "reset during a fault", tc10_reset_in_fault},
+};
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    return tb::run_cases("tb_vdd_monitor", kCases, argc, argv);
+}